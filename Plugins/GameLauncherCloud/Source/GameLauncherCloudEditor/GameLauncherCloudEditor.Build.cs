@@ -40,8 +40,15 @@ new string[]
 "DesktopPlatform",
 "ToolMenus",
 "WorkspaceMenuStructure",
-"InputCore"
+"InputCore",
+"DirectoryWatcher",
+"WebSockets",
+"UMG",
+"RenderCore"
 }
 );
+
+// Native ZIP writer
+AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
 }
 }
@@ -1,87 +1,48 @@
 // Copyright Game Launcher Cloud. All Rights Reserved.
 
 #include "GLCApiClient.h"
+#include "GLCApiJson.h"
+#include "GLCBuildStatusStream.h"
+#include "GLCHttpSession.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "GLCUploadStream.h"
+#include "GLCMultipartUploader.h"
+#include "GLCStreamingUploader.h"
+#include "GLCChunkedUploader.h"
+#include "GLCUploadJournal.h"
+#include "HAL/FileManager.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
 
 FGLCApiClient::FGLCApiClient(const FString& InBaseUrl, const FString& InAuthToken)
-	: BaseUrl(InBaseUrl)
+	: Session(MakeShared<FGLCHttpSession, ESPMode::ThreadSafe>(InBaseUrl))
 	, AuthToken(InAuthToken)
+	, bSendPartChecksums(false)
+	, bBatchStatusUnsupported(false)
 {
+	Session->SetAuthToken(AuthToken);
 }
 
 void FGLCApiClient::SetAuthToken(const FString& Token)
 {
 	AuthToken = Token;
-}
-
-TSharedPtr<FJsonObject> FGLCApiClient::ParseJsonResponse(const FString& ResponseString)
-{
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
-	
-	if (FJsonSerializer::Deserialize(Reader, JsonObject))
-	{
-		return JsonObject;
-	}
-	
-	return nullptr;
-}
+	Session->SetAuthToken(AuthToken);
 
-bool FGLCApiClient::ExtractApiResult(TSharedPtr<FJsonObject> JsonObject, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
-{
-	if (!JsonObject.IsValid())
-	{
-		OutError = TEXT("Invalid JSON response");
-		return false;
-	}
-	
-	// Check both camelCase and PascalCase for compatibility
-	bool IsSuccess = false;
-	JsonObject->TryGetBoolField(TEXT("isSuccess"), IsSuccess) || JsonObject->TryGetBoolField(TEXT("IsSuccess"), IsSuccess);
-	
-	if (IsSuccess)
-	{
-		const TSharedPtr<FJsonObject>* ResultObject = nullptr;
-		if (JsonObject->TryGetObjectField(TEXT("result"), ResultObject) || JsonObject->TryGetObjectField(TEXT("Result"), ResultObject))
-		{
-			if (ResultObject && (*ResultObject).IsValid())
-			{
-				OutResult = *ResultObject;
-				return true;
-			}
-		}
-	}
-	
-	// Extract error messages (try both camelCase and PascalCase)
-	const TArray<TSharedPtr<FJsonValue>>* ErrorMessages = nullptr;
-	if ((JsonObject->TryGetArrayField(TEXT("errorMessages"), ErrorMessages) || JsonObject->TryGetArrayField(TEXT("ErrorMessages"), ErrorMessages)) 
-		&& ErrorMessages && ErrorMessages->Num() > 0)
-	{
-		OutError = (*ErrorMessages)[0]->AsString();
-	}
-	else
-	{
-		OutError = TEXT("Request failed");
-	}
-	
-	return false;
+	// Monitors holding the old stream keep it; new ones connect with the new token
+	StatusStream.Reset();
 }
 
 void FGLCApiClient::LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(bool, FString, FGLCLoginResponse)> Callback)
 {
 	UE_LOG(LogTemp, Warning, TEXT("[GLC] === LoginWithApiKey ASYNC Started ==="));
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	FString Url = BaseUrl + TEXT("/api/cli/build/login-interactive");
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/login-interactive"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] URL: %s"), *Url);
+	UE_LOG(LogTemp, Log, TEXT("[GLC] URL: %s"), *Request->GetURL());
 	
 	// Create request body with camelCase to match Unity
 	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
@@ -92,8 +53,6 @@ void FGLCApiClient::LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(b
 	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
 	Request->SetContentAsString(RequestBody);
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Request body: %s"), *RequestBody);
-	
 	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
 		FGLCLoginResponse LoginResponse;
@@ -106,50 +65,22 @@ void FGLCApiClient::LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(b
 		}
 		
 		int32 StatusCode = Response->GetResponseCode();
-		FString ResponseString = Response->GetContentAsString();
 		
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Response status: %d"), StatusCode);
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Response body: %s"), *ResponseString);
+		// The body carries the session token, only its size is logged
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Response status: %d (%d bytes)"), StatusCode, Response->GetContent().Num());
 		
 		if (StatusCode != 200)
 		{
-			TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-			FString ErrorMsg = FString::Printf(TEXT("HTTP %d"), StatusCode);
-			
-			if (JsonObject.IsValid())
-			{
-				const TArray<TSharedPtr<FJsonValue>>* ErrorMessages = nullptr;
-				if (JsonObject->TryGetArrayField(TEXT("errorMessages"), ErrorMessages) && ErrorMessages && ErrorMessages->Num() > 0)
-				{
-					ErrorMsg = (*ErrorMessages)[0]->AsString();
-				}
-			}
-			
+			FString ErrorMsg = GLCApiJson::ReadErrorMessage(Response->GetContent(), FString::Printf(TEXT("HTTP %d"), StatusCode));
 			UE_LOG(LogTemp, Error, TEXT("[GLC] Login failed: %s"), *ErrorMsg);
 			Callback(false, ErrorMsg, LoginResponse);
 			return;
 		}
 		
-		TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-		
-		if (!JsonObject.IsValid())
-		{
-			UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to parse JSON response"));
-			Callback(false, TEXT("Invalid JSON response"), LoginResponse);
-			return;
-		}
-		
-		TSharedPtr<FJsonObject> ResultObject;
 		FString ErrorMessage;
 		
-		if (ExtractApiResult(JsonObject, ResultObject, ErrorMessage))
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), LoginResponse, ErrorMessage))
 		{
-			// Parse login response (camelCase to match backend)
-			ResultObject->TryGetStringField(TEXT("id"), LoginResponse.Id);
-			ResultObject->TryGetStringField(TEXT("username"), LoginResponse.Username);
-			ResultObject->TryGetStringField(TEXT("email"), LoginResponse.Email);
-			ResultObject->TryGetStringField(TEXT("token"), LoginResponse.Token);
-			
 			if (LoginResponse.Token.IsEmpty())
 			{
 				UE_LOG(LogTemp, Error, TEXT("[GLC] Login response missing token"));
@@ -157,27 +88,6 @@ void FGLCApiClient::LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(b
 				return;
 			}
 			
-			// Parse roles
-			const TArray<TSharedPtr<FJsonValue>>* RolesArray = nullptr;
-			if (ResultObject->TryGetArrayField(TEXT("roles"), RolesArray) && RolesArray)
-			{
-				for (const TSharedPtr<FJsonValue>& RoleValue : *RolesArray)
-				{
-					LoginResponse.Roles.Add(RoleValue->AsString());
-				}
-			}
-			
-			// Parse subscription plan
-			const TSharedPtr<FJsonObject>* SubscriptionObject = nullptr;
-			if (ResultObject->TryGetObjectField(TEXT("subscription"), SubscriptionObject) && SubscriptionObject && (*SubscriptionObject).IsValid())
-			{
-				const TSharedPtr<FJsonObject>* PlanObject = nullptr;
-				if ((*SubscriptionObject)->TryGetObjectField(TEXT("plan"), PlanObject) && PlanObject && (*PlanObject).IsValid())
-				{
-					(*PlanObject)->TryGetStringField(TEXT("name"), LoginResponse.PlanName);
-				}
-			}
-			
 			AuthToken = LoginResponse.Token;
 			UE_LOG(LogTemp, Log, TEXT("[GLC] Login successful as %s"), *LoginResponse.Email);
 			Callback(true, TEXT("Login successful"), LoginResponse);
@@ -189,72 +99,63 @@ void FGLCApiClient::LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(b
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
-void FGLCApiClient::GetAppListAsync(TFunction<void(bool, FString, TArray<FGLCAppInfo>)> Callback)
+void FGLCApiClient::GetAppListAsync(const FString& Cursor, int32 Limit, TFunction<void(bool, FString, FGLCAppListPage)> Callback)
 {
 	if (AuthToken.IsEmpty())
 	{
-		Callback(false, TEXT("Not authenticated"), TArray<FGLCAppInfo>());
+		Callback(false, TEXT("Not authenticated"), FGLCAppListPage());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] GetAppList started"));
+	UE_LOG(LogTemp, Log, TEXT("[GLC] GetAppList started%s"), Cursor.IsEmpty() ? TEXT("") : TEXT(" (next page)"));
+	
+	// Servers without paging ignore both parameters and return every app without a cursor
+	TArray<FString> Query;
+	if (Limit > 0)
+	{
+		Query.Add(FString::Printf(TEXT("limit=%d"), Limit));
+	}
+	if (!Cursor.IsEmpty())
+	{
+		Query.Add(FString::Printf(TEXT("cursor=%s"), *FGenericPlatformHttp::UrlEncode(Cursor)));
+	}
+	FString Path = TEXT("/api/cli/build/list-apps");
+	if (Query.Num() > 0)
+	{
+		Path += TEXT("?") + FString::Join(Query, TEXT("&"));
+	}
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(BaseUrl + TEXT("/api/cli/build/list-apps"));
-	Request->SetVerb(TEXT("GET"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("GET"), Path);
 	
 	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
-		TArray<FGLCAppInfo> Apps;
+		FGLCAppListPage Page;
 		
 		if (!bSuccess || !Response.IsValid())
 		{
 			UE_LOG(LogTemp, Error, TEXT("[GLC] GetAppList request failed: No response"));
-			Callback(false, TEXT("Connection error"), Apps);
+			Callback(false, TEXT("Connection error"), Page);
 			return;
 		}
 		
-		FString ResponseString = Response->GetContentAsString();
-		TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-		TSharedPtr<FJsonObject> ResultObject;
 		FString ErrorMessage;
 		
-		if (ExtractApiResult(JsonObject, ResultObject, ErrorMessage))
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), Page, ErrorMessage))
 		{
-			const TArray<TSharedPtr<FJsonValue>>* AppsArray;
-			if (ResultObject->TryGetArrayField(TEXT("apps"), AppsArray))
-			{
-				for (const TSharedPtr<FJsonValue>& AppValue : *AppsArray)
-				{
-					TSharedPtr<FJsonObject> AppObject = AppValue->AsObject();
-					if (AppObject.IsValid())
-					{
-						FGLCAppInfo AppInfo;
-						AppObject->TryGetNumberField(TEXT("id"), AppInfo.Id);
-						AppObject->TryGetStringField(TEXT("name"), AppInfo.Name);
-						AppObject->TryGetStringField(TEXT("description"), AppInfo.Description);
-						AppObject->TryGetNumberField(TEXT("buildCount"), AppInfo.BuildCount);
-						AppObject->TryGetBoolField(TEXT("isOwnedByUser"), AppInfo.IsOwnedByUser);
-						Apps.Add(AppInfo);
-					}
-				}
-			}
-			
-			UE_LOG(LogTemp, Log, TEXT("[GLC] Retrieved %d apps successfully"), Apps.Num());
-			Callback(true, TEXT("Apps retrieved successfully"), Apps);
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Retrieved %d apps successfully%s"), Page.Apps.Num(), Page.NextCursor.IsEmpty() ? TEXT("") : TEXT(", more pages follow"));
+			Callback(true, TEXT("Apps retrieved successfully"), MoveTemp(Page));
 		}
 		else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[GLC] GetAppList failed: %s"), *ErrorMessage);
-			Callback(false, ErrorMessage, Apps);
+			Callback(false, ErrorMessage, Page);
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
 void FGLCApiClient::CanUploadAsync(int64 FileSizeBytes, int64 UncompressedSizeBytes, int64 AppId, TFunction<void(bool, FString, FGLCCanUploadResponse)> Callback)
@@ -267,13 +168,10 @@ void FGLCApiClient::CanUploadAsync(int64 FileSizeBytes, int64 UncompressedSizeBy
 	
 	UE_LOG(LogTemp, Log, TEXT("[GLC] CanUpload started"));
 	
-	FString Url = FString::Printf(TEXT("%s/api/cli/build/can-upload?fileSizeBytes=%lld&uncompressedSizeBytes=%lld&appId=%lld"), 
-		*BaseUrl, FileSizeBytes, UncompressedSizeBytes, AppId);
+	FString Path = FString::Printf(TEXT("/api/cli/build/can-upload?fileSizeBytes=%lld&uncompressedSizeBytes=%lld&appId=%lld"), 
+		FileSizeBytes, UncompressedSizeBytes, AppId);
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("GET"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("GET"), Path);
 	
 	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
@@ -286,20 +184,10 @@ void FGLCApiClient::CanUploadAsync(int64 FileSizeBytes, int64 UncompressedSizeBy
 			return;
 		}
 		
-		FString ResponseString = Response->GetContentAsString();
-		TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-		TSharedPtr<FJsonObject> ResultObject;
 		FString ErrorMessage;
 		
-		if (ExtractApiResult(JsonObject, ResultObject, ErrorMessage))
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), UploadResponse, ErrorMessage))
 		{
-			ResultObject->TryGetBoolField(TEXT("canUpload"), UploadResponse.CanUpload);
-			ResultObject->TryGetNumberField(TEXT("fileSizeBytes"), UploadResponse.FileSizeBytes);
-			ResultObject->TryGetNumberField(TEXT("uncompressedSizeBytes"), UploadResponse.UncompressedSizeBytes);
-			ResultObject->TryGetStringField(TEXT("planName"), UploadResponse.PlanName);
-			ResultObject->TryGetNumberField(TEXT("maxCompressedSizeGB"), UploadResponse.MaxCompressedSizeGB);
-			ResultObject->TryGetNumberField(TEXT("maxUncompressedSizeGB"), UploadResponse.MaxUncompressedSizeGB);
-			
 			UE_LOG(LogTemp, Log, TEXT("[GLC] Upload check successful"));
 			Callback(true, TEXT("Upload check successful"), UploadResponse);
 		}
@@ -310,7 +198,7 @@ void FGLCApiClient::CanUploadAsync(int64 FileSizeBytes, int64 UncompressedSizeBy
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
 void FGLCApiClient::StartUploadAsync(int64 AppId, const FString& FileName, int64 FileSize, int64 UncompressedFileSize, const FString& BuildNotes, TFunction<void(bool, FString, FGLCStartUploadResponse)> Callback)
@@ -323,11 +211,8 @@ void FGLCApiClient::StartUploadAsync(int64 AppId, const FString& FileName, int64
 	
 	UE_LOG(LogTemp, Log, TEXT("[GLC] StartUpload started for file: %s (%lld bytes)"), *FileName, FileSize);
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(BaseUrl + TEXT("/api/cli/build/start-upload"));
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/start-upload"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
 	
 	// Create request body
 	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
@@ -353,18 +238,10 @@ void FGLCApiClient::StartUploadAsync(int64 AppId, const FString& FileName, int64
 			return;
 		}
 		
-		FString ResponseString = Response->GetContentAsString();
-		TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-		TSharedPtr<FJsonObject> ResultObject;
 		FString ErrorMessage;
 		
-		if (ExtractApiResult(JsonObject, ResultObject, ErrorMessage))
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), UploadResponse, ErrorMessage))
 		{
-			ResultObject->TryGetNumberField(TEXT("appBuildId"), UploadResponse.AppBuildId);
-			ResultObject->TryGetStringField(TEXT("uploadUrl"), UploadResponse.UploadUrl);
-			ResultObject->TryGetStringField(TEXT("key"), UploadResponse.Key);
-			ResultObject->TryGetStringField(TEXT("finalUrl"), UploadResponse.FinalUrl);
-			
 			UE_LOG(LogTemp, Log, TEXT("[GLC] Upload started successfully. Build ID: %lld"), UploadResponse.AppBuildId);
 			Callback(true, TEXT("Upload started successfully"), UploadResponse);
 		}
@@ -375,61 +252,65 @@ void FGLCApiClient::StartUploadAsync(int64 AppId, const FString& FileName, int64
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
 void FGLCApiClient::UploadFileAsync(const FString& PresignedUrl, const FString& FilePath, TFunction<void(bool, FString, float)> ProgressCallback)
 {
 	UE_LOG(LogTemp, Log, TEXT("[GLC] UploadFile started for: %s"), *FilePath);
 	
-	// Read file
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (FileSize < 0)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to read file: %s"), *FilePath);
-		ProgressCallback(false, TEXT("Failed to read file"), 0.0f);
+		ProgressCallback(false, TEXT("Failed to read file"), 1.0f);
 		return;
 	}
 	
-	int64 FileSize = FileData.Num();
 	UE_LOG(LogTemp, Log, TEXT("[GLC] File size: %lld bytes (%.2f MB)"), FileSize, FileSize / (1024.0f * 1024.0f));
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	
-	// Store the request so it can be cancelled
-	ActiveUploadRequest = Request;
-	
-	Request->SetURL(PresignedUrl);
-	Request->SetVerb(TEXT("PUT"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/octet-stream"));
-	Request->SetContent(FileData);
-	
-	// Progress callback
-	Request->OnRequestProgress64().BindLambda([ProgressCallback, FileSize](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+	// Every attempt streams the file from disk again instead of loading it into memory
+	FGLCRetryingRequest::FMakeRequest MakeRequest = [PresignedUrl, FilePath, FileSize, ProgressCallback](int32 Attempt) -> FHttpRequestPtr
 	{
-		float Progress = (float)BytesSent / (float)FileSize;
-		ProgressCallback(false, TEXT("Uploading..."), Progress);
-	});
+		TSharedPtr<FGLCFileRangeReader, ESPMode::ThreadSafe> FileStream = FGLCFileRangeReader::Open(FilePath);
+		if (!FileStream.IsValid())
+		{
+			return nullptr;
+		}
+		
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(PresignedUrl);
+		Request->SetVerb(TEXT("PUT"));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/octet-stream"));
+		Request->SetContentFromStream(FileStream.ToSharedRef());
+		
+		// Progress callback
+		Request->OnRequestProgress64().BindLambda([ProgressCallback, FileSize](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+		{
+			float Progress = FileSize > 0 ? (float)BytesSent / (float)FileSize : 1.0f;
+			ProgressCallback(false, TEXT("Uploading..."), Progress);
+		});
+		return Request;
+	};
 	
-	Request->OnProcessRequestComplete().BindLambda([this, ProgressCallback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	FHttpRequestCompleteDelegate OnComplete = FHttpRequestCompleteDelegate::CreateLambda([this, ProgressCallback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
-		// Clear the active request reference
+		// CancelActiveUpload clears the active request before cancelling it
+		bool bCancelled = !ActiveUploadRequest.IsValid();
 		ActiveUploadRequest.Reset();
 		
-		// Check if request was cancelled
-		EHttpRequestStatus::Type Status = Request->GetStatus();
-		if (!bSuccess && (!Response.IsValid() || Status == EHttpRequestStatus::Failed))
+		if (bCancelled)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[GLC] Upload was cancelled or connection failed"));
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] Upload was cancelled"));
 			ProgressCallback(false, TEXT("Upload cancelled"), -1.0f);
 			return;
 		}
 		
 		if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != 200)
 		{
-			FString Error = FString::Printf(TEXT("Upload failed: HTTP %d"), Response.IsValid() ? Response->GetResponseCode() : 0);
+			FString Error = Response.IsValid() ? FString::Printf(TEXT("Upload failed: HTTP %d"), Response->GetResponseCode()) : TEXT("Upload failed: connection error");
 			UE_LOG(LogTemp, Error, TEXT("[GLC] %s"), *Error);
-			ProgressCallback(false, Error, 0.0f);
+			ProgressCallback(false, Error, 1.0f);
 			return;
 		}
 		
@@ -437,7 +318,504 @@ void FGLCApiClient::UploadFileAsync(const FString& PresignedUrl, const FString&
 		ProgressCallback(true, TEXT("Upload completed"), 1.0f);
 	});
 	
-	Request->ProcessRequest();
+	// Store the request so it can be cancelled
+	ActiveUploadRequest = FGLCRetryingRequest::Start(RetryPolicy, MoveTemp(MakeRequest), OnComplete);
+	if (!ActiveUploadRequest.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to read file: %s"), *FilePath);
+		ProgressCallback(false, TEXT("Failed to read file"), 1.0f);
+	}
+}
+
+void FGLCApiClient::StartMultipartUploadAsync(int64 AppId, const FString& FileName, int64 FileSize, int64 UncompressedFileSize, const FString& BuildNotes, int64 PartSize, int32 PartCount, TFunction<void(bool, FString, FGLCStartMultipartUploadResponse)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"), FGLCStartMultipartUploadResponse());
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] StartMultipartUpload started for file: %s (%lld bytes, %d parts)"), *FileName, FileSize, PartCount);
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/start-multipart-upload"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appId"), AppId);
+	RequestObject->SetStringField(TEXT("fileName"), FileName);
+	RequestObject->SetNumberField(TEXT("fileSize"), FileSize);
+	RequestObject->SetNumberField(TEXT("uncompressedFileSize"), UncompressedFileSize);
+	RequestObject->SetStringField(TEXT("buildNotes"), BuildNotes);
+	RequestObject->SetNumberField(TEXT("partSize"), PartSize);
+	RequestObject->SetNumberField(TEXT("partCount"), PartCount);
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback, FileSize, PartSize, PartCount](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		FGLCStartMultipartUploadResponse UploadResponse;
+		UploadResponse.AppBuildId = 0;
+		UploadResponse.PartSize = PartSize;
+		
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] StartMultipartUpload request failed: No response"));
+			Callback(false, TEXT("Connection error"), UploadResponse);
+			return;
+		}
+		
+		FString ErrorMessage;
+		
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), UploadResponse, ErrorMessage))
+		{
+			// Streamed uploads (no part count) ask for their part URLs as they go
+			TArray<int32> PartNumbers;
+			for (const FGLCMultipartPartUrl& Part : UploadResponse.Parts)
+			{
+				PartNumbers.Add(Part.PartNumber);
+			}
+			FString PartsError;
+			const bool bValidParts = PartCount > 0
+				? FGLCMultipartUploader::ValidateParts(UploadResponse.PartSize, FileSize, PartNumbers, PartsError)
+				: FGLCMultipartUploader::ValidatePartSize(UploadResponse.PartSize, FileSize, PartsError);
+			if (!bValidParts)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[GLC] StartMultipartUpload returned invalid parts: %s"), *PartsError);
+				Callback(false, FString::Printf(TEXT("Server returned invalid upload parts (%s)"), *PartsError), UploadResponse);
+				return;
+			}
+			
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Multipart upload started successfully. Build ID: %lld, %d parts"), UploadResponse.AppBuildId, UploadResponse.Parts.Num());
+			Callback(true, TEXT("Upload started successfully"), UploadResponse);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] StartMultipartUpload failed: %s"), *ErrorMessage);
+			Callback(false, ErrorMessage, UploadResponse);
+		}
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+FGLCRetryingRequestPtr FGLCApiClient::UploadPartAsync(const FString& PresignedUrl, const FString& FilePath, int64 Offset, int64 Length, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback, const FString& ChecksumSha256)
+{
+	return ProcessPartRequest([PresignedUrl, FilePath, Offset, Length](int32 Attempt) -> FHttpRequestPtr
+	{
+		TSharedPtr<FGLCFileRangeReader, ESPMode::ThreadSafe> PartStream = FGLCFileRangeReader::Open(FilePath, Offset, Length);
+		if (!PartStream.IsValid())
+		{
+			return nullptr;
+		}
+		
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(PresignedUrl);
+		Request->SetVerb(TEXT("PUT"));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/octet-stream"));
+		Request->SetContentFromStream(PartStream.ToSharedRef());
+		return Request;
+	}, ChecksumSha256, BytesSentCallback, Callback);
+}
+
+FGLCRetryingRequestPtr FGLCApiClient::UploadPartDataAsync(const FString& PresignedUrl, TArray<uint8>&& Data, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback, const FString& ChecksumSha256)
+{
+	// Every attempt streams the same buffer
+	TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> SharedData = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Data));
+	
+	return ProcessPartRequest([PresignedUrl, SharedData](int32 Attempt) -> FHttpRequestPtr
+	{
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(PresignedUrl);
+		Request->SetVerb(TEXT("PUT"));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/octet-stream"));
+		Request->SetContentFromStream(MakeShared<FGLCSharedBufferReader, ESPMode::ThreadSafe>(SharedData));
+		return Request;
+	}, ChecksumSha256, BytesSentCallback, Callback);
+}
+
+FGLCRetryingRequestPtr FGLCApiClient::ProcessPartRequest(FGLCRetryingRequest::FMakeRequest MakeRequest, const FString& ChecksumSha256, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback)
+{
+	const bool bSendChecksum = bSendPartChecksums && !ChecksumSha256.IsEmpty();
+	
+	FGLCRetryingRequest::FMakeRequest MakePartRequest = [MakeRequest, bSendChecksum, ChecksumSha256, BytesSentCallback](int32 Attempt) -> FHttpRequestPtr
+	{
+		FHttpRequestPtr Request = MakeRequest(Attempt);
+		if (!Request.IsValid())
+		{
+			return nullptr;
+		}
+		
+		if (bSendChecksum)
+		{
+			Request->SetHeader(TEXT("x-amz-checksum-sha256"), ChecksumSha256);
+		}
+		
+		// A retry starts the part over
+		Request->OnRequestProgress64().BindLambda([BytesSentCallback](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+		{
+			BytesSentCallback((int64)BytesSent);
+		});
+		return Request;
+	};
+	
+	FHttpRequestCompleteDelegate OnComplete = FHttpRequestCompleteDelegate::CreateLambda([Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != 200)
+		{
+			FString Error = FString::Printf(TEXT("HTTP %d"), Response.IsValid() ? Response->GetResponseCode() : 0);
+			Callback(false, Error, FString());
+			return;
+		}
+		
+		FString ETag = Response->GetHeader(TEXT("ETag"));
+		if (ETag.IsEmpty())
+		{
+			Callback(false, TEXT("Missing ETag in part response"), FString());
+			return;
+		}
+		
+		Callback(true, FString(), ETag);
+	});
+	
+	return FGLCRetryingRequest::Start(RetryPolicy, MoveTemp(MakePartRequest), OnComplete);
+}
+
+void FGLCApiClient::GetMultipartPartUrlsAsync(int64 AppBuildId, const FString& Key, const FString& UploadId, const TArray<int32>& PartNumbers, TFunction<void(bool, FString, TArray<FGLCMultipartPartUrl>, int32)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"), TArray<FGLCMultipartPartUrl>(), 0);
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] GetMultipartPartUrls started for Build ID: %lld (%d parts)"), AppBuildId, PartNumbers.Num());
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/multipart-part-urls"));
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	RequestObject->SetStringField(TEXT("key"), Key);
+	RequestObject->SetStringField(TEXT("uploadId"), UploadId);
+	
+	TArray<TSharedPtr<FJsonValue>> PartNumbersArray;
+	for (int32 PartNumber : PartNumbers)
+	{
+		PartNumbersArray.Add(MakeShareable(new FJsonValueNumber(PartNumber)));
+	}
+	RequestObject->SetArrayField(TEXT("partNumbers"), PartNumbersArray);
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		TArray<FGLCMultipartPartUrl> Parts;
+		
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] GetMultipartPartUrls request failed: No response"));
+			Callback(false, TEXT("Connection error"), Parts, 0);
+			return;
+		}
+		
+		int32 StatusCode = Response->GetResponseCode();
+		FString ErrorMessage;
+		
+		if (GLCApiJson::ReadEnvelope(Response->GetContent(), [&Parts](FGLCJsonReader& Reader) { return GLCApiJson::ReadField(Reader, "parts", Parts); }, ErrorMessage))
+		{
+			Callback(true, TEXT("Part URLs retrieved"), MoveTemp(Parts), StatusCode);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] GetMultipartPartUrls failed (HTTP %d): %s"), StatusCode, *ErrorMessage);
+			Callback(false, ErrorMessage, Parts, StatusCode);
+		}
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::CompleteMultipartUploadAsync(int64 AppBuildId, const FString& Key, const FString& UploadId, const TArray<FGLCCompletedPart>& Parts, TFunction<void(bool, FString)> Callback, int64 FileSize, const FGLCFileHash* FileHash)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"));
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] CompleteMultipartUpload started for Build ID: %lld (%d parts)"), AppBuildId, Parts.Num());
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/complete-multipart-upload"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	RequestObject->SetStringField(TEXT("key"), Key);
+	RequestObject->SetStringField(TEXT("uploadId"), UploadId);
+	
+	TArray<TSharedPtr<FJsonValue>> PartsArray;
+	for (const FGLCCompletedPart& Part : Parts)
+	{
+		TSharedPtr<FJsonObject> PartObject = MakeShareable(new FJsonObject);
+		PartObject->SetNumberField(TEXT("partNumber"), Part.PartNumber);
+		PartObject->SetStringField(TEXT("eTag"), Part.ETag);
+		if (!Part.ChecksumSha256.IsEmpty())
+		{
+			PartObject->SetStringField(TEXT("checksumSha256"), Part.ChecksumSha256);
+		}
+		PartsArray.Add(MakeShareable(new FJsonValueObject(PartObject)));
+	}
+	RequestObject->SetArrayField(TEXT("parts"), PartsArray);
+	
+	// Streamed uploads only know their final size once compression has finished
+	if (FileSize >= 0)
+	{
+		RequestObject->SetNumberField(TEXT("fileSize"), FileSize);
+	}
+	
+	if (FileHash && FileHash->IsSet())
+	{
+		RequestObject->SetStringField(TEXT("sha256"), FileHash->Sha256);
+		RequestObject->SetStringField(TEXT("xxh3"), FileHash->GetXxHash3String());
+	}
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != 200)
+		{
+			FString Error = FString::Printf(TEXT("Request failed: HTTP %d"), Response.IsValid() ? Response->GetResponseCode() : 0);
+			UE_LOG(LogTemp, Error, TEXT("[GLC] CompleteMultipartUpload failed: %s"), *Error);
+			Callback(false, Error);
+			return;
+		}
+		
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Multipart upload completed successfully!"));
+		Callback(true, TEXT("Multipart upload completed"));
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::UploadFileMultipartAsync(const FGLCStartMultipartUploadResponse& Upload, const FString& FilePath, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback, TSharedPtr<FGLCUploadJournal> Journal)
+{
+	int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (FileSize <= 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to read file: %s"), *FilePath);
+		ProgressCallback(false, TEXT("Failed to read file"), 1.0f);
+		return;
+	}
+	
+	// Keep a local reference so the uploader outlives a synchronous failure inside Start()
+	TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> Uploader = MakeShared<FGLCMultipartUploader, ESPMode::ThreadSafe>(this, Upload, FilePath, FileSize, MaxConcurrency, Journal);
+	ActiveMultipartUpload = Uploader;
+	TWeakPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> WeakUploader = Uploader;
+	Uploader->Start([this, WeakUploader, ProgressCallback](bool bSuccess, FString Message, float Progress)
+	{
+		TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> FinishedUploader = WeakUploader.Pin();
+		if (FinishedUploader.IsValid() && FinishedUploader->IsFinished() && ActiveMultipartUpload == FinishedUploader)
+		{
+			ActiveMultipartUpload.Reset();
+		}
+		ProgressCallback(bSuccess, Message, Progress);
+	});
+}
+
+void FGLCApiClient::UploadDirectoryStreamedAsync(const FGLCStartMultipartUploadResponse& Upload, const FString& SourceDirectory, const FGLCCompressionPolicy& Policy, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback)
+{
+	TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> Uploader = MakeShared<FGLCStreamingUploader, ESPMode::ThreadSafe>(this, Upload, MaxConcurrency);
+	ActiveStreamingUpload = Uploader;
+	TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakUploader = Uploader;
+	Uploader->Start(SourceDirectory, Policy, [this, WeakUploader, ProgressCallback](bool bSuccess, FString Message, float Progress)
+	{
+		TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> FinishedUploader = WeakUploader.Pin();
+		if (FinishedUploader.IsValid() && FinishedUploader->IsFinished() && ActiveStreamingUpload == FinishedUploader)
+		{
+			ActiveStreamingUpload.Reset();
+		}
+		ProgressCallback(bSuccess, Message, Progress);
+	});
+}
+
+void FGLCApiClient::StartChunkedUploadAsync(int64 AppId, int64 UncompressedFileSize, const FString& BuildNotes, TFunction<void(bool, FString, FGLCStartChunkedUploadResponse)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"), FGLCStartChunkedUploadResponse());
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] StartChunkedUpload started for App ID: %lld (%lld bytes)"), AppId, UncompressedFileSize);
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/start-chunked-upload"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appId"), AppId);
+	RequestObject->SetNumberField(TEXT("uncompressedFileSize"), UncompressedFileSize);
+	RequestObject->SetStringField(TEXT("buildNotes"), BuildNotes);
+	RequestObject->SetStringField(TEXT("chunkAlgorithm"), FGLCChunker::GetAlgorithmName());
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		FGLCStartChunkedUploadResponse UploadResponse;
+		UploadResponse.AppBuildId = 0;
+		
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] StartChunkedUpload request failed: No response"));
+			Callback(false, TEXT("Connection error"), UploadResponse);
+			return;
+		}
+		
+		FString ErrorMessage;
+		
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), UploadResponse, ErrorMessage))
+		{
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Chunked upload started successfully. Build ID: %lld"), UploadResponse.AppBuildId);
+			Callback(true, TEXT("Upload started successfully"), UploadResponse);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] StartChunkedUpload failed: %s"), *ErrorMessage);
+			Callback(false, ErrorMessage, UploadResponse);
+		}
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::GetMissingChunksAsync(int64 AppBuildId, const TArray<FString>& ChunkHashes, TFunction<void(bool, FString, TArray<FGLCChunkUploadUrl>)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"), TArray<FGLCChunkUploadUrl>());
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] GetMissingChunks started for Build ID: %lld (%d chunks)"), AppBuildId, ChunkHashes.Num());
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/missing-chunks"));
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	
+	TArray<TSharedPtr<FJsonValue>> HashesArray;
+	HashesArray.Reserve(ChunkHashes.Num());
+	for (const FString& Hash : ChunkHashes)
+	{
+		HashesArray.Add(MakeShareable(new FJsonValueString(Hash)));
+	}
+	RequestObject->SetArrayField(TEXT("hashes"), HashesArray);
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		TArray<FGLCChunkUploadUrl> Chunks;
+		
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] GetMissingChunks request failed: No response"));
+			Callback(false, TEXT("Connection error"), Chunks);
+			return;
+		}
+		
+		FString ErrorMessage;
+		
+		if (GLCApiJson::ReadEnvelope(Response->GetContent(), [&Chunks](FGLCJsonReader& Reader) { return GLCApiJson::ReadField(Reader, "chunks", Chunks); }, ErrorMessage))
+		{
+			Callback(true, TEXT("Missing chunks retrieved"), MoveTemp(Chunks));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] GetMissingChunks failed: %s"), *ErrorMessage);
+			Callback(false, ErrorMessage, Chunks);
+		}
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::CompleteChunkedUploadAsync(int64 AppBuildId, const FString& Key, TSharedRef<FJsonObject> Manifest, TFunction<void(bool, FString)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"));
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] CompleteChunkedUpload started for Build ID: %lld"), AppBuildId);
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/complete-chunked-upload"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
+	
+	// Create request body
+	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
+	RequestObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	RequestObject->SetStringField(TEXT("key"), Key);
+	RequestObject->SetObjectField(TEXT("manifest"), Manifest);
+	
+	// The manifest lists every chunk of the build, keep the body compact
+	FString RequestBody;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObject.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+	
+	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != 200)
+		{
+			FString Error = FString::Printf(TEXT("Request failed: HTTP %d"), Response.IsValid() ? Response->GetResponseCode() : 0);
+			UE_LOG(LogTemp, Error, TEXT("[GLC] CompleteChunkedUpload failed: %s"), *Error);
+			Callback(false, Error);
+			return;
+		}
+		
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Chunked upload completed successfully!"));
+		Callback(true, TEXT("Chunked upload completed"));
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::UploadDirectoryChunkedAsync(int64 AppId, const FGLCStartChunkedUploadResponse& Upload, const FString& SourceDirectory, const FGLCChunkingParams& Params, FGLCFileHashesPtr FileHashes, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback)
+{
+	TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> Uploader = MakeShared<FGLCChunkedUploader, ESPMode::ThreadSafe>(this, AppId, Upload, Params, FileHashes, MaxConcurrency);
+	ActiveChunkedUpload = Uploader;
+	TWeakPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> WeakUploader = Uploader;
+	Uploader->Start(SourceDirectory, [this, WeakUploader, ProgressCallback](bool bSuccess, FString Message, float Progress)
+	{
+		TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> FinishedUploader = WeakUploader.Pin();
+		if (FinishedUploader.IsValid() && FinishedUploader->IsFinished() && ActiveChunkedUpload == FinishedUploader)
+		{
+			ActiveChunkedUpload.Reset();
+		}
+		ProgressCallback(bSuccess, Message, Progress);
+	});
 }
 
 void FGLCApiClient::NotifyFileReadyAsync(int64 AppBuildId, const FString& Key, TFunction<void(bool, FString)> Callback)
@@ -450,11 +828,8 @@ void FGLCApiClient::NotifyFileReadyAsync(int64 AppBuildId, const FString& Key, T
 	
 	UE_LOG(LogTemp, Log, TEXT("[GLC] NotifyFileReady started for Build ID: %lld"), AppBuildId);
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(BaseUrl + TEXT("/api/cli/build/file-ready"));
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), TEXT("/api/cli/build/file-ready"));
+	FGLCHttpSession::AddIdempotencyKey(Request);
 	
 	// Create request body
 	TSharedPtr<FJsonObject> RequestObject = MakeShareable(new FJsonObject);
@@ -480,62 +855,177 @@ void FGLCApiClient::NotifyFileReadyAsync(int64 AppBuildId, const FString& Key, T
 		Callback(true, TEXT("File ready notification sent"));
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
 void FGLCApiClient::GetBuildStatusAsync(int64 AppBuildId, TFunction<void(bool, FString, FGLCBuildStatusResponse)> Callback)
+{
+	GetBuildStatusAsync(AppBuildId, FString(), [Callback](bool bSuccess, FString Error, bool bNotModified, FGLCBuildStatusResponse Response, FString ETag)
+	{
+		Callback(bSuccess, Error, Response);
+	});
+}
+
+void FGLCApiClient::GetBuildStatusAsync(int64 AppBuildId, const FString& IfNoneMatch, TFunction<void(bool, FString, bool, FGLCBuildStatusResponse, FString)> Callback)
 {
 	if (AuthToken.IsEmpty())
 	{
-		Callback(false, TEXT("Not authenticated"), FGLCBuildStatusResponse());
+		Callback(false, TEXT("Not authenticated"), false, FGLCBuildStatusResponse(), FString());
 		return;
 	}
 	
-	FString Url = FString::Printf(TEXT("%s/api/cli/build/status/%lld"), *BaseUrl, AppBuildId);
+	FString Path = FString::Printf(TEXT("/api/cli/build/status/%lld"), AppBuildId);
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("GET"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("GET"), Path);
+	if (!IfNoneMatch.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-None-Match"), IfNoneMatch);
+	}
 	
-	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	Request->OnProcessRequestComplete().BindLambda([this, Callback, IfNoneMatch](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
 		FGLCBuildStatusResponse StatusResponse;
 		
 		if (!bSuccess || !Response.IsValid())
 		{
 			UE_LOG(LogTemp, Error, TEXT("[GLC] GetBuildStatus request failed: No response"));
-			Callback(false, TEXT("Connection error"), StatusResponse);
+			Callback(false, TEXT("Connection error"), false, StatusResponse, IfNoneMatch);
+			return;
+		}
+		
+		// Unchanged since the response the ETag came from: no body to decode
+		if (Response->GetResponseCode() == 304)
+		{
+			Callback(true, TEXT("Not modified"), true, StatusResponse, IfNoneMatch);
 			return;
 		}
 		
-		FString ResponseString = Response->GetContentAsString();
-		TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-		TSharedPtr<FJsonObject> ResultObject;
 		FString ErrorMessage;
 		
-		if (ExtractApiResult(JsonObject, ResultObject, ErrorMessage))
-		{
-			ResultObject->TryGetNumberField(TEXT("appBuildId"), StatusResponse.AppBuildId);
-			ResultObject->TryGetNumberField(TEXT("appId"), StatusResponse.AppId);
-			ResultObject->TryGetStringField(TEXT("status"), StatusResponse.Status);
-			ResultObject->TryGetStringField(TEXT("fileName"), StatusResponse.FileName);
-			ResultObject->TryGetStringField(TEXT("buildNotes"), StatusResponse.BuildNotes);
-			ResultObject->TryGetStringField(TEXT("errorMessage"), StatusResponse.ErrorMessage);
-			ResultObject->TryGetNumberField(TEXT("fileSize"), StatusResponse.FileSize);
-			ResultObject->TryGetNumberField(TEXT("compressedFileSize"), StatusResponse.CompressedFileSize);
-			ResultObject->TryGetNumberField(TEXT("stageProgress"), StatusResponse.StageProgress);
-			
-			Callback(true, TEXT("Success"), StatusResponse);
+		if (GLCApiJson::ReadApiResult(Response->GetContent(), StatusResponse, ErrorMessage))
+		{
+			Callback(true, TEXT("Success"), false, StatusResponse, Response->GetHeader(TEXT("ETag")));
 		}
 		else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[GLC] GetBuildStatus failed: %s"), *ErrorMessage);
-			Callback(false, ErrorMessage, StatusResponse);
+			Callback(false, ErrorMessage, false, StatusResponse, IfNoneMatch);
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+void FGLCApiClient::GetBuildStatusesAsync(const TArray<int64>& AppBuildIds, const FString& IfNoneMatch, TFunction<void(bool, FString, bool, TArray<FGLCBuildStatusResponse>, FString)> Callback)
+{
+	if (AuthToken.IsEmpty())
+	{
+		Callback(false, TEXT("Not authenticated"), false, TArray<FGLCBuildStatusResponse>(), FString());
+		return;
+	}
+	
+	if (AppBuildIds.Num() == 0)
+	{
+		Callback(true, TEXT("Success"), false, TArray<FGLCBuildStatusResponse>(), FString());
+		return;
+	}
+	
+	// Servers without the batch endpoint: one request per build, all answered together
+	if (bBatchStatusUnsupported)
+	{
+		struct FPendingStatuses
+		{
+			TArray<FGLCBuildStatusResponse> Statuses;
+			FString Error;
+			int32 Remaining;
+		};
+		TSharedRef<FPendingStatuses> Pending = MakeShared<FPendingStatuses>();
+		Pending->Remaining = AppBuildIds.Num();
+		
+		for (int64 AppBuildId : AppBuildIds)
+		{
+			GetBuildStatusAsync(AppBuildId, [Pending, Callback](bool bSuccess, FString Error, FGLCBuildStatusResponse Response)
+			{
+				if (bSuccess)
+				{
+					Pending->Statuses.Add(Response);
+				}
+				else
+				{
+					Pending->Error = Error;
+				}
+				
+				if (--Pending->Remaining == 0)
+				{
+					const bool bAnySucceeded = Pending->Statuses.Num() > 0 || Pending->Error.IsEmpty();
+					Callback(bAnySucceeded, bAnySucceeded ? TEXT("Success") : Pending->Error, false, MoveTemp(Pending->Statuses), FString());
+				}
+			});
+		}
+		return;
+	}
+	
+	TArray<FString> Ids;
+	for (int64 AppBuildId : AppBuildIds)
+	{
+		Ids.Add(FString::Printf(TEXT("%lld"), AppBuildId));
+	}
+	FString Path = FString::Printf(TEXT("/api/cli/build/statuses?appBuildIds=%s"), *FString::Join(Ids, TEXT(",")));
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("GET"), Path);
+	if (!IfNoneMatch.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-None-Match"), IfNoneMatch);
+	}
+	
+	Request->OnProcessRequestComplete().BindLambda([this, AppBuildIds, IfNoneMatch, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		TArray<FGLCBuildStatusResponse> Statuses;
+		
+		if (!bSuccess || !Response.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] GetBuildStatuses request failed: No response"));
+			Callback(false, TEXT("Connection error"), false, Statuses, IfNoneMatch);
+			return;
+		}
+		
+		if (Response->GetResponseCode() == 404)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Server has no batch build status endpoint, requesting statuses build by build"));
+			bBatchStatusUnsupported = true;
+			GetBuildStatusesAsync(AppBuildIds, FString(), Callback);
+			return;
+		}
+		
+		if (Response->GetResponseCode() == 304)
+		{
+			Callback(true, TEXT("Not modified"), true, Statuses, IfNoneMatch);
+			return;
+		}
+		
+		FString ErrorMessage;
+		
+		if (GLCApiJson::ReadEnvelope(Response->GetContent(), [&Statuses](FGLCJsonReader& Reader) { return GLCApiJson::ReadField(Reader, "builds", Statuses); }, ErrorMessage))
+		{
+			Callback(true, TEXT("Success"), false, MoveTemp(Statuses), Response->GetHeader(TEXT("ETag")));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] GetBuildStatuses failed: %s"), *ErrorMessage);
+			Callback(false, ErrorMessage, false, Statuses, IfNoneMatch);
+		}
+	});
+	
+	Session->ProcessRequest(Request, RetryPolicy);
+}
+
+TSharedRef<FGLCBuildStatusStream, ESPMode::ThreadSafe> FGLCApiClient::GetBuildStatusStream(const FString& StreamUrl)
+{
+	if (!StatusStream.IsValid() || StatusStream->GetUrl() != StreamUrl)
+	{
+		StatusStream = MakeShared<FGLCBuildStatusStream, ESPMode::ThreadSafe>(StreamUrl, AuthToken, RetryPolicy);
+	}
+	return StatusStream.ToSharedRef();
 }
 
 void FGLCApiClient::CancelBuildAsync(int64 AppBuildId, TFunction<void(bool, FString)> Callback)
@@ -548,13 +1038,10 @@ void FGLCApiClient::CancelBuildAsync(int64 AppBuildId, TFunction<void(bool, FStr
 	
 	UE_LOG(LogTemp, Log, TEXT("[GLC] CancelBuild started for Build ID: %lld"), AppBuildId);
 	
-	FString Url = FString::Printf(TEXT("%s/api/AppBuild/cancelByBuildId/%lld"), *BaseUrl, AppBuildId);
+	FString Path = FString::Printf(TEXT("/api/AppBuild/cancelByBuildId/%lld"), AppBuildId);
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Session->CreateRequest(TEXT("POST"), Path);
+	FGLCHttpSession::AddIdempotencyKey(Request);
 	
 	Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	{
@@ -566,7 +1053,6 @@ void FGLCApiClient::CancelBuildAsync(int64 AppBuildId, TFunction<void(bool, FStr
 		}
 		
 		int32 ResponseCode = Response->GetResponseCode();
-		FString ResponseString = Response->GetContentAsString();
 		
 		if (ResponseCode == 200)
 		{
@@ -575,34 +1061,45 @@ void FGLCApiClient::CancelBuildAsync(int64 AppBuildId, TFunction<void(bool, FStr
 		}
 		else
 		{
-			FString ErrorMessage = FString::Printf(TEXT("Failed to cancel build: HTTP %d"), ResponseCode);
-			
-			// Try to extract error message from response
-			TSharedPtr<FJsonObject> JsonObject = ParseJsonResponse(ResponseString);
-			if (JsonObject.IsValid())
-			{
-				const TArray<TSharedPtr<FJsonValue>>* ErrorMessages;
-				if (JsonObject->TryGetArrayField(TEXT("errorMessages"), ErrorMessages) && ErrorMessages->Num() > 0)
-				{
-					ErrorMessage = (*ErrorMessages)[0]->AsString();
-				}
-			}
+			FString ErrorMessage = GLCApiJson::ReadErrorMessage(Response->GetContent(), FString::Printf(TEXT("Failed to cancel build: HTTP %d"), ResponseCode));
 			
 			UE_LOG(LogTemp, Error, TEXT("[GLC] CancelBuild failed: %s"), *ErrorMessage);
 			Callback(false, ErrorMessage);
 		}
 	});
 	
-	Request->ProcessRequest();
+	Session->ProcessRequest(Request, RetryPolicy);
 }
 
 void FGLCApiClient::CancelActiveUpload()
 {
-	if (ActiveUploadRequest.IsValid())
+	if (ActiveChunkedUpload.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling active chunked upload"));
+		TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> Upload = ActiveChunkedUpload;
+		ActiveChunkedUpload.Reset();
+		Upload->Cancel();
+	}
+	else if (ActiveStreamingUpload.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling active streamed upload"));
+		TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> Upload = ActiveStreamingUpload;
+		ActiveStreamingUpload.Reset();
+		Upload->Cancel();
+	}
+	else if (ActiveMultipartUpload.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling active multipart upload"));
+		TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> Upload = ActiveMultipartUpload;
+		ActiveMultipartUpload.Reset();
+		Upload->Cancel();
+	}
+	else if (ActiveUploadRequest.IsValid())
 	{
 		UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling active upload request"));
-		ActiveUploadRequest->CancelRequest();
+		FGLCRetryingRequestPtr Upload = ActiveUploadRequest;
 		ActiveUploadRequest.Reset();
+		Upload->Cancel();
 		UE_LOG(LogTemp, Log, TEXT("[GLC] Active upload request cancelled"));
 	}
 	else
@@ -0,0 +1,400 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCApiJson.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+// ========== Result structs ========== //
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCLoginResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("id")) return Reader.Read(Out.Id);
+		if (Key.Is("username")) return Reader.Read(Out.Username);
+		if (Key.Is("email")) return Reader.Read(Out.Email);
+		if (Key.Is("token")) return Reader.Read(Out.Token);
+		if (Key.Is("roles")) return Read(Reader, Out.Roles);
+		if (Key.Is("subscription"))
+		{
+			return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& SubscriptionKey)
+			{
+				return !SubscriptionKey.Is("plan") || ReadField(Reader, "name", Out.PlanName);
+			});
+		}
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCAppInfo& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("id")) return Reader.Read(Out.Id);
+		if (Key.Is("name")) return Reader.Read(Out.Name);
+		if (Key.Is("description")) return Reader.Read(Out.Description);
+		if (Key.Is("buildCount")) return Reader.Read(Out.BuildCount);
+		if (Key.Is("isOwnedByUser")) return Reader.Read(Out.IsOwnedByUser);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCAppListPage& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("apps")) return Read(Reader, Out.Apps);
+		if (Key.Is("nextCursor")) return Reader.Read(Out.NextCursor);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCCanUploadResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("canUpload")) return Reader.Read(Out.CanUpload);
+		if (Key.Is("fileSizeBytes")) return Reader.Read(Out.FileSizeBytes);
+		if (Key.Is("uncompressedSizeBytes")) return Reader.Read(Out.UncompressedSizeBytes);
+		if (Key.Is("planName")) return Reader.Read(Out.PlanName);
+		if (Key.Is("maxCompressedSizeGB")) return Reader.Read(Out.MaxCompressedSizeGB);
+		if (Key.Is("maxUncompressedSizeGB")) return Reader.Read(Out.MaxUncompressedSizeGB);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCStartUploadResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("appBuildId")) return Reader.Read(Out.AppBuildId);
+		if (Key.Is("uploadUrl")) return Reader.Read(Out.UploadUrl);
+		if (Key.Is("key")) return Reader.Read(Out.Key);
+		if (Key.Is("finalUrl")) return Reader.Read(Out.FinalUrl);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCMultipartPartUrl& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("partNumber")) return Reader.Read(Out.PartNumber);
+		if (Key.Is("url")) return Reader.Read(Out.Url);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCStartMultipartUploadResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("appBuildId")) return Reader.Read(Out.AppBuildId);
+		if (Key.Is("key")) return Reader.Read(Out.Key);
+		if (Key.Is("uploadId")) return Reader.Read(Out.UploadId);
+		if (Key.Is("partSize")) return Reader.Read(Out.PartSize);
+		if (Key.Is("parts")) return Read(Reader, Out.Parts);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCStartChunkedUploadResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("appBuildId")) return Reader.Read(Out.AppBuildId);
+		if (Key.Is("key")) return Reader.Read(Out.Key);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCChunkUploadUrl& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("hash")) return Reader.Read(Out.Hash);
+		if (Key.Is("url")) return Reader.Read(Out.Url);
+		return true;
+	});
+}
+
+bool GLCApiJson::Read(FGLCJsonReader& Reader, FGLCBuildStatusResponse& Out)
+{
+	return Reader.ReadObject([&Reader, &Out](const FGLCJsonKey& Key)
+	{
+		if (Key.Is("appBuildId")) return Reader.Read(Out.AppBuildId);
+		if (Key.Is("appId")) return Reader.Read(Out.AppId);
+		if (Key.Is("status")) return Reader.Read(Out.Status);
+		if (Key.Is("fileName")) return Reader.Read(Out.FileName);
+		if (Key.Is("buildNotes")) return Reader.Read(Out.BuildNotes);
+		if (Key.Is("errorMessage")) return Reader.Read(Out.ErrorMessage);
+		if (Key.Is("fileSize")) return Reader.Read(Out.FileSize);
+		if (Key.Is("compressedFileSize")) return Reader.Read(Out.CompressedFileSize);
+		if (Key.Is("stageProgress")) return Reader.Read(Out.StageProgress);
+		return true;
+	});
+}
+
+// ========== Envelope ========== //
+
+namespace GLCApiJson
+{
+	/** Reads the envelope fields; the result, if any, goes to ReadResult */
+	bool ReadEnvelopeFields(FGLCJsonReader& Reader, TFunctionRef<bool(FGLCJsonReader&)> ReadResult, bool& bOutIsSuccess, bool& bOutHasResult, FString& OutFirstError)
+	{
+		return Reader.ReadObject([&](const FGLCJsonKey& Key)
+		{
+			if (Key.Is("isSuccess"))
+			{
+				return Reader.Read(bOutIsSuccess);
+			}
+			if (Key.Is("result"))
+			{
+				if (Reader.TryReadNull())
+				{
+					return true;
+				}
+				bOutHasResult = true;
+				return ReadResult(Reader);
+			}
+			if (Key.Is("errorMessages"))
+			{
+				int32 Index = 0;
+				return Reader.ReadArray([&Reader, &Index, &OutFirstError]()
+				{
+					return Index++ > 0 || Reader.Read(OutFirstError);
+				});
+			}
+			return true;
+		});
+	}
+}
+
+bool GLCApiJson::ReadEnvelope(TConstArrayView<uint8> Payload, TFunctionRef<bool(FGLCJsonReader&)> ReadResult, FString& OutError)
+{
+	FGLCJsonReader Reader(Payload);
+	bool bIsSuccess = false;
+	bool bHasResult = false;
+	FString FirstError;
+
+	if (!ReadEnvelopeFields(Reader, ReadResult, bIsSuccess, bHasResult, FirstError) || !Reader.IsAtEnd())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[GLC] Invalid JSON response (%d bytes): %s"), Payload.Num(), *Reader.GetError());
+		OutError = TEXT("Invalid JSON response");
+		return false;
+	}
+
+	if (bIsSuccess && bHasResult)
+	{
+		return true;
+	}
+
+	OutError = FirstError.IsEmpty() ? FString(TEXT("Request failed")) : FirstError;
+	return false;
+}
+
+FString GLCApiJson::ReadErrorMessage(TConstArrayView<uint8> Payload, const FString& Fallback)
+{
+	FGLCJsonReader Reader(Payload);
+	bool bIsSuccess = false;
+	bool bHasResult = false;
+	FString FirstError;
+
+	if (!ReadEnvelopeFields(Reader, [](FGLCJsonReader&) { return true; }, bIsSuccess, bHasResult, FirstError) || FirstError.IsEmpty())
+	{
+		return Fallback;
+	}
+	return FirstError;
+}
+
+// ========== Benchmark ========== //
+
+namespace GLCApiJsonBenchmark
+{
+	/** Response body of the app list with AppCount apps, shaped like the backend's */
+	TArray<uint8> MakeAppListPayload(int32 AppCount)
+	{
+		FString Json = TEXT("{\"isSuccess\":true,\"result\":{\"apps\":[");
+		for (int32 Index = 0; Index < AppCount; ++Index)
+		{
+			Json += FString::Printf(TEXT("%s{\"id\":%d,\"name\":\"Game %d\",\"description\":\"Build \\\"%d\\\" of the game \\u00e9t\\u00e9 edition, with a description long enough to matter\",")
+				TEXT("\"buildCount\":%d,\"isOwnedByUser\":%s,\"createdAt\":\"2025-01-01T00:00:00Z\",\"tags\":[\"pc\",\"steam\"]}"),
+				Index > 0 ? TEXT(",") : TEXT(""), 1000 + Index, Index, Index, Index % 50, Index % 3 == 0 ? TEXT("false") : TEXT("true"));
+		}
+		Json += TEXT("]},\"errorMessages\":[]}");
+
+		FTCHARToUTF8 Utf8(*Json);
+		return TArray<uint8>((const uint8*)Utf8.Get(), Utf8.Length());
+	}
+
+	TArray<uint8> MakeBuildStatusPayload()
+	{
+		const TCHAR* Json = TEXT("{\"isSuccess\":true,\"result\":{\"appBuildId\":123456,\"appId\":42,\"status\":\"Processing\",")
+			TEXT("\"fileName\":\"MyGame-Win64-Shipping.zip\",\"buildNotes\":\"Nightly build\",\"errorMessage\":null,")
+			TEXT("\"fileSize\":5368709120,\"compressedFileSize\":2147483648,\"stageProgress\":57},\"errorMessages\":[]}");
+
+		FTCHARToUTF8 Utf8(Json);
+		return TArray<uint8>((const uint8*)Utf8.Get(), Utf8.Length());
+	}
+
+	/** The former decoding path: body converted to a string, parsed into a DOM, then looked up */
+	TSharedPtr<FJsonObject> ParseDomResult(const TArray<uint8>& Payload)
+	{
+		FUTF8ToTCHAR Converted((const ANSICHAR*)Payload.GetData(), Payload.Num());
+		FString ResponseString;
+		ResponseString.AppendChars(Converted.Get(), Converted.Length());
+
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
+		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+		{
+			return nullptr;
+		}
+
+		bool IsSuccess = false;
+		JsonObject->TryGetBoolField(TEXT("isSuccess"), IsSuccess) || JsonObject->TryGetBoolField(TEXT("IsSuccess"), IsSuccess);
+
+		const TSharedPtr<FJsonObject>* ResultObject = nullptr;
+		if (IsSuccess && (JsonObject->TryGetObjectField(TEXT("result"), ResultObject) || JsonObject->TryGetObjectField(TEXT("Result"), ResultObject)))
+		{
+			return *ResultObject;
+		}
+		return nullptr;
+	}
+
+	bool DecodeAppListDom(const TArray<uint8>& Payload, TArray<FGLCAppInfo>& OutApps)
+	{
+		TSharedPtr<FJsonObject> ResultObject = ParseDomResult(Payload);
+		const TArray<TSharedPtr<FJsonValue>>* AppsArray = nullptr;
+		if (!ResultObject.IsValid() || !ResultObject->TryGetArrayField(TEXT("apps"), AppsArray))
+		{
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& AppValue : *AppsArray)
+		{
+			TSharedPtr<FJsonObject> AppObject = AppValue->AsObject();
+			if (AppObject.IsValid())
+			{
+				FGLCAppInfo AppInfo = FGLCAppInfo();
+				AppObject->TryGetNumberField(TEXT("id"), AppInfo.Id);
+				AppObject->TryGetStringField(TEXT("name"), AppInfo.Name);
+				AppObject->TryGetStringField(TEXT("description"), AppInfo.Description);
+				AppObject->TryGetNumberField(TEXT("buildCount"), AppInfo.BuildCount);
+				AppObject->TryGetBoolField(TEXT("isOwnedByUser"), AppInfo.IsOwnedByUser);
+				OutApps.Add(AppInfo);
+			}
+		}
+		return true;
+	}
+
+	bool DecodeBuildStatusDom(const TArray<uint8>& Payload, FGLCBuildStatusResponse& OutStatus)
+	{
+		TSharedPtr<FJsonObject> ResultObject = ParseDomResult(Payload);
+		if (!ResultObject.IsValid())
+		{
+			return false;
+		}
+
+		ResultObject->TryGetNumberField(TEXT("appBuildId"), OutStatus.AppBuildId);
+		ResultObject->TryGetNumberField(TEXT("appId"), OutStatus.AppId);
+		ResultObject->TryGetStringField(TEXT("status"), OutStatus.Status);
+		ResultObject->TryGetStringField(TEXT("fileName"), OutStatus.FileName);
+		ResultObject->TryGetStringField(TEXT("buildNotes"), OutStatus.BuildNotes);
+		ResultObject->TryGetStringField(TEXT("errorMessage"), OutStatus.ErrorMessage);
+		ResultObject->TryGetNumberField(TEXT("fileSize"), OutStatus.FileSize);
+		ResultObject->TryGetNumberField(TEXT("compressedFileSize"), OutStatus.CompressedFileSize);
+		ResultObject->TryGetNumberField(TEXT("stageProgress"), OutStatus.StageProgress);
+		return true;
+	}
+
+	bool DecodeAppListTyped(const TArray<uint8>& Payload, TArray<FGLCAppInfo>& OutApps)
+	{
+		FString Error;
+		return GLCApiJson::ReadEnvelope(Payload, [&OutApps](FGLCJsonReader& Reader)
+		{
+			return GLCApiJson::ReadField(Reader, "apps", OutApps);
+		}, Error);
+	}
+
+	bool DecodeBuildStatusTyped(const TArray<uint8>& Payload, FGLCBuildStatusResponse& OutStatus)
+	{
+		FString Error;
+		return GLCApiJson::ReadApiResult(Payload, OutStatus, Error);
+	}
+
+	/** Mean microseconds per call of Decode over Iterations runs */
+	double TimeDecode(int32 Iterations, TFunctionRef<bool()> Decode)
+	{
+		// Warm up caches and the allocator
+		Decode();
+
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Decode();
+		}
+		return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0 / Iterations;
+	}
+
+	void Report(const TCHAR* Name, int32 PayloadSize, double DomMicroseconds, double TypedMicroseconds)
+	{
+		UE_LOG(LogTemp, Display, TEXT("[GLC] %s (%d bytes): DOM %.1f us (%.0f MB/s), typed %.1f us (%.0f MB/s), %.1fx faster"),
+			Name, PayloadSize,
+			DomMicroseconds, PayloadSize / FMath::Max(DomMicroseconds, 0.001),
+			TypedMicroseconds, PayloadSize / FMath::Max(TypedMicroseconds, 0.001),
+			DomMicroseconds / FMath::Max(TypedMicroseconds, 0.001));
+	}
+
+	void Run(const TArray<FString>& Args)
+	{
+		const int32 AppCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+
+		// App list
+		TArray<uint8> AppListPayload = MakeAppListPayload(AppCount);
+
+		TArray<FGLCAppInfo> DomApps;
+		TArray<FGLCAppInfo> TypedApps;
+		if (!DecodeAppListDom(AppListPayload, DomApps) || !DecodeAppListTyped(AppListPayload, TypedApps)
+			|| DomApps.Num() != TypedApps.Num() || DomApps.Last().Description != TypedApps.Last().Description || DomApps.Last().Id != TypedApps.Last().Id)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] JSON benchmark: DOM and typed decoding of the app list differ"));
+			return;
+		}
+
+		double DomMicroseconds = TimeDecode(Iterations, [&AppListPayload]()
+		{
+			TArray<FGLCAppInfo> Apps;
+			return DecodeAppListDom(AppListPayload, Apps);
+		});
+		double TypedMicroseconds = TimeDecode(Iterations, [&AppListPayload]()
+		{
+			TArray<FGLCAppInfo> Apps;
+			return DecodeAppListTyped(AppListPayload, Apps);
+		});
+		Report(*FString::Printf(TEXT("App list, %d apps"), AppCount), AppListPayload.Num(), DomMicroseconds, TypedMicroseconds);
+
+		// Build status, the response polled while a build is processed
+		TArray<uint8> StatusPayload = MakeBuildStatusPayload();
+		const int32 StatusIterations = Iterations * 100;
+
+		DomMicroseconds = TimeDecode(StatusIterations, [&StatusPayload]()
+		{
+			FGLCBuildStatusResponse Status = FGLCBuildStatusResponse();
+			return DecodeBuildStatusDom(StatusPayload, Status);
+		});
+		TypedMicroseconds = TimeDecode(StatusIterations, [&StatusPayload]()
+		{
+			FGLCBuildStatusResponse Status = FGLCBuildStatusResponse();
+			return DecodeBuildStatusTyped(StatusPayload, Status);
+		});
+		Report(TEXT("Build status"), StatusPayload.Num(), DomMicroseconds, TypedMicroseconds);
+	}
+}
+
+static FAutoConsoleCommand GLCBenchmarkJsonCommand(
+	TEXT("GLC.BenchmarkJson"),
+	TEXT("Times decoding of API responses, DOM against typed. Usage: GLC.BenchmarkJson [AppCount=1000] [Iterations=100]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&GLCApiJsonBenchmark::Run));
@@ -0,0 +1,517 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildManifest.h"
+#include "DirectoryWatcherModule.h"
+#include "Async/ParallelFor.h"
+#include "IDirectoryWatcher.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGLCBuildManifest::FGLCBuildManifest(const FString& InRootDirectory)
+	: RootDirectory(FPaths::ConvertRelativePathToFull(InRootDirectory))
+	, TotalSize(0)
+	, bNeedsFullScan(true)
+	, bWatching(false)
+	, bLoaded(false)
+	, bRootExists(false)
+	, bDirty(false)
+{
+	FPaths::NormalizeDirectoryName(RootDirectory);
+}
+
+FGLCBuildManifest::~FGLCBuildManifest()
+{
+	StopWatching();
+
+	if (bDirty)
+	{
+		Save();
+	}
+}
+
+FString FGLCBuildManifest::GetManifestPath() const
+{
+	// Keyed by the full, normalised root, so manifests of different build directories never replace each other
+	FString Key = RootDirectory;
+#if PLATFORM_WINDOWS || PLATFORM_MAC
+	// Case-insensitive file systems, as in FPaths::IsSamePath
+	Key.ToLowerInline();
+#endif
+	const uint64 Hash = FXxHash64::HashBuffer(*Key, Key.Len() * sizeof(TCHAR)).Hash;
+	return FPaths::ProjectIntermediateDir() / FString::Printf(TEXT("GameLauncherCloud/build_manifest_%016llx.json"), Hash);
+}
+
+bool FGLCBuildManifest::Refresh(const TAtomic<bool>* bCancelRequested)
+{
+	// Entries from the previous session keep their hashes if the files did not change
+	if (!bLoaded)
+	{
+		bLoaded = true;
+		Load();
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	if (!PlatformFile.DirectoryExists(*RootDirectory))
+	{
+		if (Entries.Num() > 0)
+		{
+			Entries.Empty();
+			TotalSize = 0;
+			bDirty = true;
+		}
+
+		// The directory may be recreated by the next package; rescan it then
+		FScopeLock Lock(&ChangesLock);
+		PendingChanges.Empty();
+		bNeedsFullScan = true;
+		bRootExists = false;
+	}
+	else
+	{
+		bRootExists = true;
+
+		bool bFullScan = false;
+		TSet<FString> Changes;
+		{
+			FScopeLock Lock(&ChangesLock);
+			bFullScan = bNeedsFullScan || !bWatching;
+			bNeedsFullScan = false;
+			Changes = MoveTemp(PendingChanges);
+			PendingChanges.Reset();
+		}
+
+		if (bFullScan)
+		{
+			if (!FullScan(bCancelRequested))
+			{
+				FScopeLock Lock(&ChangesLock);
+				bNeedsFullScan = true;
+				return false;
+			}
+		}
+		else
+		{
+			for (const FString& Path : Changes)
+			{
+				UpdatePath(Path);
+			}
+		}
+	}
+
+	if (bDirty)
+	{
+		Save();
+	}
+
+	return true;
+}
+
+void FGLCBuildManifest::UpdateWatcher()
+{
+	bool bExists = FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*RootDirectory);
+	if (bExists && !WatcherHandle.IsValid())
+	{
+		StartWatching();
+
+		// Anything that happened while nobody was watching is unknown
+		FScopeLock Lock(&ChangesLock);
+		bNeedsFullScan = true;
+	}
+	else if (!bExists && WatcherHandle.IsValid())
+	{
+		StopWatching();
+	}
+}
+
+void FGLCBuildManifest::SetHash(const FString& RelativePath, const FGLCFileHash& Hash)
+{
+	if (FEntry* Entry = Entries.Find(RelativePath))
+	{
+		if (Entry->Hash.Sha256 != Hash.Sha256 || Entry->Hash.XxHash3 != Hash.XxHash3)
+		{
+			Entry->Hash = Hash;
+			bDirty = true;
+		}
+	}
+}
+
+bool FGLCBuildManifest::UpdateHashes(const TAtomic<bool>* bCancelRequested)
+{
+	TArray<FString> RelativePaths;
+	TArray<FString> FilePaths;
+	int64 BytesToHash = 0;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (!Pair.Value.Hash.IsSet())
+		{
+			RelativePaths.Add(Pair.Key);
+			FilePaths.Add(RootDirectory / Pair.Key);
+			BytesToHash += Pair.Value.Size;
+		}
+	}
+
+	if (FilePaths.Num() == 0)
+	{
+		return true;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FGLCFileHash> Hashes;
+	bool bSuccess = FGLCFileHasher::HashFiles(FilePaths, Hashes, bCancelRequested);
+
+	// Keep whatever was hashed, even when another file failed
+	for (int32 Index = 0; Index < RelativePaths.Num(); Index++)
+	{
+		if (Hashes[Index].IsSet())
+		{
+			SetHash(RelativePaths[Index], Hashes[Index]);
+		}
+	}
+
+	if (bDirty)
+	{
+		Save();
+	}
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Hashed %d files (%.2f MB) in %.2f s (%.0f MB/s)"), FilePaths.Num(), BytesToHash / (1024.0 * 1024.0), Elapsed, Elapsed > 0.0 ? BytesToHash / (1024.0 * 1024.0) / Elapsed : 0.0);
+
+	return bSuccess;
+}
+
+// ========== SCANNING ========== //
+
+bool FGLCBuildManifest::CollectFiles(const FString& Directory, TArray<TPair<FString, FFileStatData>>& OutFiles, const TAtomic<bool>* bCancelRequested)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Breadth-first: every directory of a level is listed on its own worker
+	TArray<FString> Level = { Directory };
+	while (Level.Num() > 0)
+	{
+		if (bCancelRequested && bCancelRequested->Load())
+		{
+			return false;
+		}
+
+		TArray<TArray<TPair<FString, FFileStatData>>> LevelFiles;
+		TArray<TArray<FString>> LevelDirectories;
+		LevelFiles.SetNum(Level.Num());
+		LevelDirectories.SetNum(Level.Num());
+
+		ParallelFor(Level.Num(), [&](int32 Index)
+		{
+			if (bCancelRequested && bCancelRequested->Load())
+			{
+				return;
+			}
+
+			PlatformFile.IterateDirectoryStat(*Level[Index], [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+			{
+				if (StatData.bIsDirectory)
+				{
+					LevelDirectories[Index].Add(FilenameOrDirectory);
+				}
+				else
+				{
+					LevelFiles[Index].Emplace(FilenameOrDirectory, StatData);
+				}
+				return true;
+			});
+		});
+
+		Level.Reset();
+		for (int32 Index = 0; Index < LevelFiles.Num(); Index++)
+		{
+			OutFiles.Append(MoveTemp(LevelFiles[Index]));
+			Level.Append(MoveTemp(LevelDirectories[Index]));
+		}
+	}
+
+	return !(bCancelRequested && bCancelRequested->Load());
+}
+
+bool FGLCBuildManifest::FullScan(const TAtomic<bool>* bCancelRequested)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TPair<FString, FFileStatData>> Files;
+	if (!CollectFiles(RootDirectory, Files, bCancelRequested))
+	{
+		return false;
+	}
+
+	TMap<FString, FEntry> PreviousEntries = MoveTemp(Entries);
+	Entries.Reset();
+	Entries.Reserve(Files.Num());
+	TotalSize = 0;
+
+	for (const TPair<FString, FFileStatData>& File : Files)
+	{
+		FString RelativePath = ToRelativePath(File.Key);
+		FEntry& Entry = Entries.Add(RelativePath);
+		Entry.Size = File.Value.FileSize;
+		Entry.ModifiedTime = File.Value.ModificationTime;
+		TotalSize += Entry.Size;
+
+		const FEntry* Previous = PreviousEntries.Find(RelativePath);
+		if (Previous && Previous->Size == Entry.Size && Previous->ModifiedTime == Entry.ModifiedTime)
+		{
+			Entry.Hash = Previous->Hash;
+		}
+		else
+		{
+			bDirty = true;
+		}
+	}
+
+	if (PreviousEntries.Num() != Entries.Num())
+	{
+		bDirty = true;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Build manifest scanned: %d files, %.2f MB in %.3f s"), Entries.Num(), TotalSize / (1024.0 * 1024.0), FPlatformTime::Seconds() - StartTime);
+	return true;
+}
+
+void FGLCBuildManifest::UpdatePath(const FString& AbsolutePath)
+{
+	FString RelativePath = ToRelativePath(AbsolutePath);
+	if (RelativePath.IsEmpty())
+	{
+		return;
+	}
+
+	FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*AbsolutePath);
+	if (!StatData.bIsValid)
+	{
+		RemoveEntries(RelativePath);
+	}
+	else if (StatData.bIsDirectory)
+	{
+		// A directory moved or copied in at once may only be reported as a single event
+		TArray<TPair<FString, FFileStatData>> Files;
+		CollectFiles(AbsolutePath, Files);
+		for (const TPair<FString, FFileStatData>& File : Files)
+		{
+			SetEntry(ToRelativePath(File.Key), File.Value.FileSize, File.Value.ModificationTime);
+		}
+	}
+	else
+	{
+		SetEntry(RelativePath, StatData.FileSize, StatData.ModificationTime);
+	}
+}
+
+void FGLCBuildManifest::SetEntry(const FString& RelativePath, int64 Size, const FDateTime& ModifiedTime)
+{
+	FEntry& Entry = Entries.FindOrAdd(RelativePath);
+	if (Entry.Size == Size && Entry.ModifiedTime == ModifiedTime)
+	{
+		return;
+	}
+
+	TotalSize += Size - Entry.Size;
+	Entry.Size = Size;
+	Entry.ModifiedTime = ModifiedTime;
+	Entry.Hash = FGLCFileHash();
+	bDirty = true;
+}
+
+void FGLCBuildManifest::RemoveEntries(const FString& RelativePath)
+{
+	// The path may be a file or a whole directory
+	FString DirectoryPrefix = RelativePath + TEXT("/");
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() == RelativePath || It.Key().StartsWith(DirectoryPrefix))
+		{
+			TotalSize -= It.Value().Size;
+			It.RemoveCurrent();
+			bDirty = true;
+		}
+	}
+}
+
+FString FGLCBuildManifest::ToRelativePath(const FString& AbsolutePath) const
+{
+	FString Path = AbsolutePath;
+	FPaths::NormalizeFilename(Path);
+
+	if (!Path.StartsWith(RootDirectory) || Path.Len() <= RootDirectory.Len() + 1)
+	{
+		return FString();
+	}
+
+	return Path.RightChop(RootDirectory.Len() + 1);
+}
+
+// ========== DIRECTORY WATCHER ========== //
+
+void FGLCBuildManifest::StartWatching()
+{
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+	if (!DirectoryWatcher)
+	{
+		return;
+	}
+
+	DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+		RootDirectory,
+		IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FGLCBuildManifest::OnDirectoryChanged),
+		WatcherHandle,
+		IDirectoryWatcher::WatchOptions::IncludeDirectoryChanges);
+
+	FScopeLock Lock(&ChangesLock);
+	bWatching = WatcherHandle.IsValid();
+
+	if (!WatcherHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Could not watch %s, the build manifest will be rescanned on every refresh"), *RootDirectory);
+	}
+}
+
+void FGLCBuildManifest::StopWatching()
+{
+	if (!WatcherHandle.IsValid())
+	{
+		return;
+	}
+
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(RootDirectory, WatcherHandle);
+		}
+	}
+	WatcherHandle.Reset();
+
+	FScopeLock Lock(&ChangesLock);
+	bWatching = false;
+}
+
+void FGLCBuildManifest::OnDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	FScopeLock Lock(&ChangesLock);
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (Change.Action == FFileChangeData::FCA_RescanRequired)
+		{
+			bNeedsFullScan = true;
+			continue;
+		}
+
+		PendingChanges.Add(Change.Filename);
+	}
+}
+
+// ========== PERSISTENCE ========== //
+
+bool FGLCBuildManifest::Load()
+{
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetManifestPath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Build manifest is corrupted, ignoring it"));
+		return false;
+	}
+
+	FString SavedRoot;
+	if (!JsonObject->TryGetStringField(TEXT("root"), SavedRoot) || !FPaths::IsSamePath(SavedRoot, RootDirectory))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* FilesObject = nullptr;
+	if (!JsonObject->TryGetObjectField(TEXT("files"), FilesObject) || !FilesObject)
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*FilesObject)->Values)
+	{
+		TSharedPtr<FJsonObject> FileObject = Pair.Value->AsObject();
+		if (!FileObject.IsValid())
+		{
+			continue;
+		}
+
+		// Ticks exceed the precision of a JSON number, so they are stored as a string
+		FString ModifiedTicks;
+		FEntry Entry;
+		FileObject->TryGetNumberField(TEXT("size"), Entry.Size);
+		FileObject->TryGetStringField(TEXT("modified"), ModifiedTicks);
+		FString XxHash3;
+		if (FileObject->TryGetStringField(TEXT("xxh3"), XxHash3) && FileObject->TryGetStringField(TEXT("sha256"), Entry.Hash.Sha256))
+		{
+			Entry.Hash.XxHash3 = FGLCFileHash::ParseXxHash3(XxHash3);
+		}
+		Entry.ModifiedTime = FDateTime(FCString::Atoi64(*ModifiedTicks));
+
+		TotalSize += Entry.Size;
+		Entries.Add(Pair.Key, MoveTemp(Entry));
+	}
+
+	return true;
+}
+
+bool FGLCBuildManifest::Save()
+{
+	TSharedPtr<FJsonObject> FilesObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		TSharedPtr<FJsonObject> FileObject = MakeShareable(new FJsonObject);
+		FileObject->SetNumberField(TEXT("size"), Pair.Value.Size);
+		FileObject->SetStringField(TEXT("modified"), LexToString(Pair.Value.ModifiedTime.GetTicks()));
+		if (Pair.Value.Hash.IsSet())
+		{
+			FileObject->SetStringField(TEXT("xxh3"), Pair.Value.Hash.GetXxHash3String());
+			FileObject->SetStringField(TEXT("sha256"), Pair.Value.Hash.Sha256);
+		}
+		FilesObject->SetObjectField(Pair.Key, FileObject);
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("root"), RootDirectory);
+	JsonObject->SetObjectField(TEXT("files"), FilesObject);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+	// Write to a temp file first so a crash mid-write never leaves a truncated manifest
+	FString ManifestPath = GetManifestPath();
+	FString TempPath = ManifestPath + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(OutputString, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to write build manifest: %s"), *TempPath);
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*ManifestPath, *TempPath, true, true))
+	{
+		return false;
+	}
+
+	bDirty = false;
+	return true;
+}
@@ -0,0 +1,64 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildMatrix.h"
+#include "GLCJobScheduler.h"
+#include "GLCJobs.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+
+TArray<FGLCBuildMatrixJobs> FGLCBuildMatrix::Submit(FGLCJobScheduler& Scheduler, int64 AppId, const FString& BuildNotes, EGLCBuildMode Mode, const TArray<FGLCBuildMatrixEntry>& Entries, const FGLCSettings& Settings)
+{
+	check(IsInGameThread());
+
+	// Chunked uploads reuse the hashes of the window's build folder, so matrix entries are streamed or archived
+	const bool bStreamed = Settings.bStreamCompressedUpload && Settings.bUseMultipartUpload;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Queueing build matrix: %d entries, %s uploads"), Entries.Num(), bStreamed ? TEXT("streamed") : TEXT("archive"));
+
+	TArray<FGLCBuildMatrixJobs> Submitted;
+	for (const FGLCBuildMatrixEntry& Entry : Entries)
+	{
+		FGLCBuildProfile Profile;
+		Profile.Mode = Mode;
+		Profile.Configuration = Entry.Configuration;
+
+		const FString ZipPath = GetZipPath(Entry);
+		const FString Notes = FString::Printf(TEXT("[%s] %s"), *Entry.GetName(), *BuildNotes);
+
+		FGLCBuildMatrixJobs& Jobs = Submitted.AddDefaulted_GetRef();
+		Jobs.Entry = Entry;
+
+		// The build path reaches the next job through the build job's output
+		Jobs.JobIds.Add(Scheduler.Submit(MakeShared<FGLCBuildJob, ESPMode::ThreadSafe>(Profile, Entry.Platform, GetArchiveDirectory(Entry))));
+		if (!bStreamed)
+		{
+			Jobs.JobIds.Add(Scheduler.Submit(MakeShared<FGLCCompressJob, ESPMode::ThreadSafe>(FString(), ZipPath), { Jobs.JobIds.Last() }));
+		}
+		Jobs.JobIds.Add(Scheduler.Submit(MakeShared<FGLCUploadJob, ESPMode::ThreadSafe>(AppId, Notes, bStreamed ? EGLCUploadMethod::Streamed : EGLCUploadMethod::Archive, FString(), ZipPath, 0), { Jobs.JobIds.Last() }));
+	}
+
+	return Submitted;
+}
+
+const TArray<FString>& FGLCBuildMatrix::GetSupportedPlatforms()
+{
+#if PLATFORM_MAC
+	static const TArray<FString> Platforms = { TEXT("Mac") };
+#elif PLATFORM_LINUX
+	static const TArray<FString> Platforms = { TEXT("Linux") };
+#else
+	// Windows hosts cross-compile Linux when the toolchain is installed
+	static const TArray<FString> Platforms = { TEXT("Win64"), TEXT("Linux") };
+#endif
+	return Platforms;
+}
+
+FString FGLCBuildMatrix::GetArchiveDirectory(const FGLCBuildMatrixEntry& Entry)
+{
+	return FPaths::ProjectDir() / TEXT("Builds") / TEXT("GLC_Matrix") / FString::Printf(TEXT("%s_%s"), *Entry.Platform, *Entry.Configuration);
+}
+
+FString FGLCBuildMatrix::GetZipPath(const FGLCBuildMatrixEntry& Entry)
+{
+	return FPaths::ProjectDir() / TEXT("Builds") / TEXT("GLC_Matrix") / FString::Printf(TEXT("%s_%s_%s.zip"), FApp::GetProjectName(), *Entry.Platform, *Entry.Configuration);
+}
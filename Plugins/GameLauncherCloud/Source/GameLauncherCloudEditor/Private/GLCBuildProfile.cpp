@@ -0,0 +1,321 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildProfile.h"
+#include "GLCBuildManifest.h"
+#include "GLCSettings.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace GLCBuildProfile
+{
+	enum class EInputKind : uint8
+	{
+		None,
+		Code,
+		Content
+	};
+
+	/** Classifies a path relative to the project directory */
+	static EInputKind Classify(const FString& RelativePath)
+	{
+		if (RelativePath.Contains(TEXT("/Intermediate/")) || RelativePath.Contains(TEXT("/Binaries/")) || RelativePath.Contains(TEXT("/Saved/")))
+		{
+			return EInputKind::None;
+		}
+
+		if (RelativePath.EndsWith(TEXT(".uproject")) || RelativePath.EndsWith(TEXT(".uplugin"))
+			|| RelativePath.StartsWith(TEXT("Source/")) || RelativePath.Contains(TEXT("/Source/")))
+		{
+			return EInputKind::Code;
+		}
+
+		if (RelativePath.StartsWith(TEXT("Content/")) || RelativePath.StartsWith(TEXT("Config/"))
+			|| RelativePath.Contains(TEXT("/Content/")) || RelativePath.Contains(TEXT("/Config/")))
+		{
+			// This plugin's own config (auth token, tuning) does not affect the packaged game
+			return FPaths::GetCleanFilename(RelativePath).StartsWith(TEXT("glc_")) ? EInputKind::None : EInputKind::Content;
+		}
+
+		return EInputKind::None;
+	}
+
+	static void HashEntry(FXxHash64Builder& Builder, const FString& RelativePath, const FFileStatData& StatData)
+	{
+		Builder.Update(*RelativePath, RelativePath.Len() * sizeof(TCHAR));
+		Builder.Update(&StatData.FileSize, sizeof(StatData.FileSize));
+		int64 Ticks = StatData.ModificationTime.GetTicks();
+		Builder.Update(&Ticks, sizeof(Ticks));
+	}
+}
+
+// ========== PROFILE ========== //
+
+const TArray<FString>& FGLCBuildProfile::GetConfigurations()
+{
+	static const TArray<FString> Configurations = { TEXT("Development"), TEXT("Shipping"), TEXT("DebugGame") };
+	return Configurations;
+}
+
+FString FGLCBuildProfile::GetModeDisplayName(EGLCBuildMode InMode)
+{
+	return InMode == EGLCBuildMode::FastIteration ? TEXT("Fast iteration") : TEXT("Full build");
+}
+
+FString FGLCBuildProfile::GetKey(const FString& Platform) const
+{
+	return FString::Printf(TEXT("%s|%s|%s|%s"), *Platform, *Configuration, IsFastIteration() ? TEXT("iterative") : TEXT("full"), *FEngineVersion::Current().ToString());
+}
+
+FString FGLCBuildProfile::MakeArguments(const FString& ProjectFile, const FString& Platform, const FString& ArchiveDirectory, bool bCompile) const
+{
+	FString Arguments = FString::Printf(
+		TEXT("BuildCookRun -project=\"%s\" -platform=%s -clientconfig=%s -cook -stage -archive -archivedirectory=\"%s\" -noP4"),
+		*ProjectFile,
+		*Platform,
+		*Configuration,
+		*ArchiveDirectory
+	);
+
+	if (bCompile)
+	{
+		Arguments += TEXT(" -build");
+	}
+
+	if (IsFastIteration())
+	{
+		// Only recook packages whose sources changed; the running editor's binaries are already built
+		Arguments += TEXT(" -cookincremental -nocompileeditor");
+	}
+
+	return Arguments;
+}
+
+FString FGLCBuildProfile::GetProfilesPath()
+{
+	return FPaths::GetPath(FGLCSettings::GetConfigPath()) / TEXT("glc_build_profiles.json");
+}
+
+FGLCBuildProfile FGLCBuildProfile::LoadForApp(int64 AppId)
+{
+	FGLCBuildProfile Profile;
+
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetProfilesPath()))
+	{
+		return Profile;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return Profile;
+	}
+
+	const TSharedPtr<FJsonObject>* AppsObject = nullptr;
+	const TSharedPtr<FJsonObject>* AppObject = nullptr;
+	if (!JsonObject->TryGetObjectField(TEXT("apps"), AppsObject) || !(*AppsObject)->TryGetObjectField(LexToString(AppId), AppObject))
+	{
+		return Profile;
+	}
+
+	FString Mode;
+	if ((*AppObject)->TryGetStringField(TEXT("mode"), Mode))
+	{
+		Profile.Mode = Mode == TEXT("fastIteration") ? EGLCBuildMode::FastIteration : EGLCBuildMode::Full;
+	}
+
+	FString Configuration;
+	if ((*AppObject)->TryGetStringField(TEXT("configuration"), Configuration) && GetConfigurations().Contains(Configuration))
+	{
+		Profile.Configuration = Configuration;
+	}
+
+	return Profile;
+}
+
+bool FGLCBuildProfile::SaveForApp(int64 AppId, const FGLCBuildProfile& Profile)
+{
+	const FString ProfilesPath = GetProfilesPath();
+
+	// Keep the profiles of other apps
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	FString ExistingContent;
+	if (FFileHelper::LoadFileToString(ExistingContent, *ProfilesPath))
+	{
+		TSharedPtr<FJsonObject> ExistingJson;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ExistingContent);
+		if (FJsonSerializer::Deserialize(Reader, ExistingJson) && ExistingJson.IsValid())
+		{
+			JsonObject = ExistingJson;
+		}
+	}
+
+	TSharedPtr<FJsonObject> AppsObject;
+	const TSharedPtr<FJsonObject>* ExistingApps = nullptr;
+	if (JsonObject->TryGetObjectField(TEXT("apps"), ExistingApps))
+	{
+		AppsObject = *ExistingApps;
+	}
+	else
+	{
+		AppsObject = MakeShareable(new FJsonObject);
+		JsonObject->SetObjectField(TEXT("apps"), AppsObject);
+	}
+
+	TSharedPtr<FJsonObject> AppObject = MakeShareable(new FJsonObject);
+	AppObject->SetStringField(TEXT("mode"), Profile.IsFastIteration() ? TEXT("fastIteration") : TEXT("full"));
+	AppObject->SetStringField(TEXT("configuration"), Profile.Configuration);
+	AppsObject->SetObjectField(LexToString(AppId), AppObject);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+	return FFileHelper::SaveStringToFile(OutputString, *ProfilesPath);
+}
+
+// ========== BUILD STAMP ========== //
+
+FString FGLCBuildStamp::GetStampPath(const FString& Platform, const FString& Configuration)
+{
+	return FPaths::ProjectIntermediateDir() / FString::Printf(TEXT("GameLauncherCloud/build_stamp_%s_%s.json"), *Platform, *Configuration);
+}
+
+bool FGLCBuildStamp::Compute(const FString& ProfileKey, FGLCBuildStamp& OutStamp, const TAtomic<bool>* bCancelRequested)
+{
+	using namespace GLCBuildProfile;
+
+	const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+	const FString ProjectDirWithSlash = ProjectDir.EndsWith(TEXT("/")) ? ProjectDir : ProjectDir + TEXT("/");
+
+	TArray<TPair<FString, FFileStatData>> Files;
+	for (const TCHAR* Directory : { TEXT("Source"), TEXT("Content"), TEXT("Config"), TEXT("Plugins") })
+	{
+		const FString FullDirectory = ProjectDirWithSlash + Directory;
+		if (IFileManager::Get().DirectoryExists(*FullDirectory) && !FGLCBuildManifest::CollectFiles(FullDirectory, Files, bCancelRequested))
+		{
+			return false;
+		}
+	}
+
+	const FString ProjectFile = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	Files.Emplace(ProjectFile, IFileManager::Get().GetStatData(*ProjectFile));
+
+	// Relative paths, sorted, so the hash does not depend on listing order
+	TArray<TPair<FString, FFileStatData>> CodeFiles;
+	TArray<TPair<FString, FFileStatData>> ContentFiles;
+	for (TPair<FString, FFileStatData>& File : Files)
+	{
+		FString RelativePath = File.Key;
+		FPaths::MakePathRelativeTo(RelativePath, *ProjectDirWithSlash);
+
+		switch (Classify(RelativePath))
+		{
+		case EInputKind::Code:
+			CodeFiles.Emplace(MoveTemp(RelativePath), File.Value);
+			break;
+		case EInputKind::Content:
+			ContentFiles.Emplace(MoveTemp(RelativePath), File.Value);
+			break;
+		default:
+			break;
+		}
+	}
+
+	auto ByPath = [](const TPair<FString, FFileStatData>& A, const TPair<FString, FFileStatData>& B) { return A.Key < B.Key; };
+	CodeFiles.Sort(ByPath);
+	ContentFiles.Sort(ByPath);
+
+	FXxHash64Builder CodeBuilder;
+	for (const TPair<FString, FFileStatData>& File : CodeFiles)
+	{
+		HashEntry(CodeBuilder, File.Key, File.Value);
+	}
+
+	FXxHash64Builder ContentBuilder;
+	for (const TPair<FString, FFileStatData>& File : ContentFiles)
+	{
+		HashEntry(ContentBuilder, File.Key, File.Value);
+	}
+
+	OutStamp.CodeHash = CodeBuilder.Finalize().Hash;
+	OutStamp.ContentHash = ContentBuilder.Finalize().Hash;
+	OutStamp.ProfileKey = ProfileKey;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Build stamp: %d code files, %d content files"), CodeFiles.Num(), ContentFiles.Num());
+	return true;
+}
+
+bool FGLCBuildStamp::LoadLast(const FString& Platform, const FString& Configuration, const FString& InArchiveDirectory, FGLCBuildStamp& OutStamp)
+{
+	return LoadFile(GetStampPath(Platform, Configuration), OutStamp) && FPaths::IsSamePath(OutStamp.ArchiveDirectory, InArchiveDirectory);
+}
+
+bool FGLCBuildStamp::LoadFile(const FString& StampPath, FGLCBuildStamp& OutStamp)
+{
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *StampPath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	FString CodeHash;
+	FString ContentHash;
+	if (!JsonObject->TryGetStringField(TEXT("code"), CodeHash) || !JsonObject->TryGetStringField(TEXT("content"), ContentHash)
+		|| !JsonObject->TryGetStringField(TEXT("profile"), OutStamp.ProfileKey) || !JsonObject->TryGetStringField(TEXT("archive"), OutStamp.ArchiveDirectory))
+	{
+		return false;
+	}
+
+	OutStamp.CodeHash = FCString::Strtoui64(*CodeHash, nullptr, 16);
+	OutStamp.ContentHash = FCString::Strtoui64(*ContentHash, nullptr, 16);
+	return true;
+}
+
+bool FGLCBuildStamp::SaveAsLast(const FString& Platform, const FString& Configuration, const FString& InArchiveDirectory)
+{
+	ArchiveDirectory = FPaths::ConvertRelativePathToFull(InArchiveDirectory);
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("code"), FString::Printf(TEXT("%016llx"), CodeHash));
+	JsonObject->SetStringField(TEXT("content"), FString::Printf(TEXT("%016llx"), ContentHash));
+	JsonObject->SetStringField(TEXT("profile"), ProfileKey);
+	JsonObject->SetStringField(TEXT("archive"), ArchiveDirectory);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+	return FFileHelper::SaveStringToFile(OutputString, *GetStampPath(Platform, Configuration));
+}
+
+void FGLCBuildStamp::DeleteForArchive(const FString& InArchiveDirectory)
+{
+	// Several platforms and configurations may archive to the same directory; none of their outputs survives the next build
+	const FString StampDirectory = FPaths::ProjectIntermediateDir() / TEXT("GameLauncherCloud");
+	TArray<FString> StampFiles;
+	IFileManager::Get().FindFiles(StampFiles, *(StampDirectory / TEXT("build_stamp_*.json")), true, false);
+
+	for (const FString& StampFile : StampFiles)
+	{
+		FGLCBuildStamp Stamp;
+		const FString StampPath = StampDirectory / StampFile;
+		if (!LoadFile(StampPath, Stamp) || FPaths::IsSamePath(Stamp.ArchiveDirectory, InArchiveDirectory))
+		{
+			IFileManager::Get().Delete(*StampPath, false, true, true);
+		}
+	}
+}
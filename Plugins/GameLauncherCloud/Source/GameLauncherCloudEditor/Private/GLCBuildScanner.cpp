@@ -0,0 +1,193 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildScanner.h"
+#include "GLCBuildManifest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+FGLCBuildScanner::FGLCBuildScanner()
+	: ScanGeneration(0)
+	, bIsScanning(false)
+{
+}
+
+void FGLCBuildScanner::RequestScan(const FString& ZipPath, const FString& BuildPath, TFunction<void(FSnapshotPtr)> OnComplete)
+{
+	check(IsInGameThread());
+
+	// Hashing keeps running, an upload may be waiting for it
+	if (ActiveCancelToken.IsValid())
+	{
+		*ActiveCancelToken = true;
+	}
+
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> CancelToken = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+	ActiveCancelToken = CancelToken;
+	const int32 Generation = ++ScanGeneration;
+	bIsScanning = true;
+
+	// The manifest and its directory watcher are managed on the game thread
+	if (BuildPath.IsEmpty())
+	{
+		Manifest.Reset();
+	}
+	else if (!Manifest.IsValid() || !FPaths::IsSamePath(Manifest->GetRootDirectory(), FPaths::ConvertRelativePathToFull(BuildPath)))
+	{
+		Manifest = MakeShared<FGLCBuildManifest, ESPMode::ThreadSafe>(BuildPath);
+	}
+
+	if (Manifest.IsValid())
+	{
+		Manifest->UpdateWatcher();
+	}
+
+	TSharedRef<FGLCBuildScanner, ESPMode::ThreadSafe> This = AsShared();
+	TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> BuildManifest = Manifest;
+	Async(EAsyncExecution::ThreadPool, [This, ZipPath, BuildManifest, CancelToken, Generation, OnComplete]()
+	{
+		FGLCBuildSnapshot Result;
+		bool bCompleted = false;
+		{
+			FScopeLock Lock(&This->ScanLock);
+			bCompleted = !*CancelToken && Scan(ZipPath, BuildManifest, *CancelToken, Result);
+		}
+
+		// Publish (and release the references) on the game thread
+		AsyncTask(ENamedThreads::GameThread, [This, BuildManifest, CancelToken, Generation, OnComplete, bCompleted, Result = MoveTemp(Result)]()
+		{
+			if (!bCompleted || *CancelToken || Generation != This->ScanGeneration)
+			{
+				return;
+			}
+
+			FSnapshotPtr NewSnapshot = MakeShared<const FGLCBuildSnapshot, ESPMode::ThreadSafe>(Result);
+			{
+				FScopeLock Lock(&This->SnapshotLock);
+				This->Snapshot = NewSnapshot;
+			}
+			This->bIsScanning = false;
+
+			if (OnComplete)
+			{
+				OnComplete(NewSnapshot);
+			}
+		});
+	});
+}
+
+void FGLCBuildScanner::RequestHashes(TFunction<void(FGLCFileHashesPtr)> OnComplete, const FString& BuildPath)
+{
+	check(IsInGameThread());
+
+	if (!BuildPath.IsEmpty() && (!Manifest.IsValid() || !FPaths::IsSamePath(Manifest->GetRootDirectory(), FPaths::ConvertRelativePathToFull(BuildPath))))
+	{
+		Manifest = MakeShared<FGLCBuildManifest, ESPMode::ThreadSafe>(BuildPath);
+		Manifest->UpdateWatcher();
+	}
+
+	if (HashCancelToken.IsValid())
+	{
+		*HashCancelToken = true;
+	}
+
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> CancelToken = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+	HashCancelToken = CancelToken;
+
+	TSharedRef<FGLCBuildScanner, ESPMode::ThreadSafe> This = AsShared();
+	TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> BuildManifest = Manifest;
+	Async(EAsyncExecution::ThreadPool, [This, BuildManifest, CancelToken, OnComplete]()
+	{
+		TSharedPtr<TMap<FString, FGLCFileHash>, ESPMode::ThreadSafe> Hashes;
+		if (BuildManifest.IsValid())
+		{
+			FScopeLock Lock(&This->ScanLock);
+			if (BuildManifest->Refresh(CancelToken.Get()) && BuildManifest->RootExists() && BuildManifest->UpdateHashes(CancelToken.Get()))
+			{
+				Hashes = MakeShared<TMap<FString, FGLCFileHash>, ESPMode::ThreadSafe>();
+				Hashes->Reserve(BuildManifest->GetFileCount());
+				for (const TPair<FString, FGLCBuildManifest::FEntry>& Pair : BuildManifest->GetEntries())
+				{
+					Hashes->Add(Pair.Key, Pair.Value.Hash);
+				}
+			}
+		}
+
+		// Release the manifest reference on the game thread
+		AsyncTask(ENamedThreads::GameThread, [This, BuildManifest, CancelToken, OnComplete, Hashes]()
+		{
+			if (This->HashCancelToken == CancelToken)
+			{
+				This->HashCancelToken.Reset();
+			}
+			OnComplete(*CancelToken ? nullptr : Hashes);
+		});
+	});
+}
+
+void FGLCBuildScanner::Cancel()
+{
+	if (ActiveCancelToken.IsValid())
+	{
+		*ActiveCancelToken = true;
+		ActiveCancelToken.Reset();
+	}
+	if (HashCancelToken.IsValid())
+	{
+		*HashCancelToken = true;
+		HashCancelToken.Reset();
+	}
+	bIsScanning = false;
+}
+
+FGLCBuildScanner::FSnapshotPtr FGLCBuildScanner::GetSnapshot() const
+{
+	FScopeLock Lock(&SnapshotLock);
+	return Snapshot;
+}
+
+bool FGLCBuildScanner::Scan(const FString& ZipPath, TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> BuildManifest, const TAtomic<bool>& bCancelRequested, FGLCBuildSnapshot& OutSnapshot)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Size and file count come from the manifest, which only rescans files that changed
+	bool bHasBuildDirectory = false;
+	if (BuildManifest.IsValid())
+	{
+		if (!BuildManifest->Refresh(&bCancelRequested))
+		{
+			return false;
+		}
+		bHasBuildDirectory = BuildManifest->RootExists();
+	}
+
+	// Check if compressed build exists
+	FFileStatData ZipStat = PlatformFile.GetStatData(*ZipPath);
+	if (ZipStat.bIsValid && !ZipStat.bIsDirectory)
+	{
+		OutSnapshot.bHasBuildReady = true;
+		OutSnapshot.LastBuildDate = ZipStat.ModificationTime;
+		OutSnapshot.LastBuildPath = ZipPath;
+		OutSnapshot.LastBuildSize = ZipStat.FileSize;
+		OutSnapshot.bIsCompressed = true;
+
+		// Uncompressed size and file count from the build directory if it exists
+		OutSnapshot.TotalFileCount = bHasBuildDirectory ? BuildManifest->GetFileCount() : 0;
+		OutSnapshot.UncompressedBuildSize = bHasBuildDirectory ? BuildManifest->GetTotalSize() : 0;
+	}
+	// Check if uncompressed build exists
+	else if (bHasBuildDirectory)
+	{
+		OutSnapshot.bHasBuildReady = true;
+		OutSnapshot.LastBuildDate = PlatformFile.GetTimeStamp(*BuildManifest->GetRootDirectory());
+		OutSnapshot.LastBuildPath = BuildManifest->GetRootDirectory();
+		OutSnapshot.bIsCompressed = false;
+		OutSnapshot.TotalFileCount = BuildManifest->GetFileCount();
+		OutSnapshot.LastBuildSize = BuildManifest->GetTotalSize();
+		OutSnapshot.UncompressedBuildSize = OutSnapshot.LastBuildSize;
+	}
+
+	return true;
+}
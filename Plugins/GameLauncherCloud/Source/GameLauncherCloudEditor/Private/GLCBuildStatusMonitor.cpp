@@ -0,0 +1,277 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildStatusMonitor.h"
+#include "GLCBuildStatusStream.h"
+#include "GLCSettings.h"
+#include "Misc/App.h"
+
+FGLCBuildStatusMonitor::FGLCBuildStatusMonitor(TSharedPtr<FGLCApiClient> InApiClient)
+	: ApiClient(InApiClient)
+	, bRequestInFlight(false)
+	, MaxPollInterval(60.0f)
+{
+}
+
+FGLCBuildStatusMonitor::~FGLCBuildStatusMonitor()
+{
+	Stop();
+}
+
+FDelegateHandle FGLCBuildStatusMonitor::Subscribe(int64 AppBuildId, FOnStatus OnStatus)
+{
+	if (Builds.Num() == 0)
+	{
+		Start();
+	}
+
+	FWatchedBuild* Build = FindBuild(AppBuildId);
+	if (Build == nullptr)
+	{
+		Build = &Builds.AddDefaulted_GetRef();
+		Build->AppBuildId = AppBuildId;
+		Build->LastStageProgress = 0;
+		Build->UnchangedPolls = 0;
+		Build->PollJitter = 1.0f;
+
+		if (StatusStream.IsValid())
+		{
+			TWeakPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> WeakThis = AsShared();
+			Build->StreamHandle = StatusStream->Subscribe(AppBuildId, [WeakThis](const FGLCBuildStatusResponse& Response)
+			{
+				if (TSharedPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->HandleStatus(Response);
+				}
+			});
+		}
+	}
+
+	// A new subscriber has no status yet, even if the build was watched already
+	Build->LastPollTime = 0.0;
+
+	FSubscriber& Subscriber = Build->Subscribers.AddDefaulted_GetRef();
+	Subscriber.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscriber.OnStatus = MoveTemp(OnStatus);
+	return Subscriber.Handle;
+}
+
+void FGLCBuildStatusMonitor::Unsubscribe(FDelegateHandle Handle)
+{
+	for (int32 BuildIndex = 0; BuildIndex < Builds.Num(); BuildIndex++)
+	{
+		FWatchedBuild& Build = Builds[BuildIndex];
+		int32 Removed = Build.Subscribers.RemoveAll([&Handle](const FSubscriber& Subscriber) { return Subscriber.Handle == Handle; });
+		if (Removed == 0)
+		{
+			continue;
+		}
+
+		if (Build.Subscribers.Num() == 0)
+		{
+			if (StatusStream.IsValid())
+			{
+				StatusStream->Unsubscribe(Build.StreamHandle);
+			}
+			Builds.RemoveAt(BuildIndex);
+		}
+		break;
+	}
+
+	if (Builds.Num() == 0)
+	{
+		Stop();
+	}
+}
+
+void FGLCBuildStatusMonitor::Start()
+{
+	FGLCSettings Settings = FGLCSettings::Load();
+	MaxPollInterval = Settings.StatusPollMaxIntervalSeconds;
+
+	// Pushed statuses replace polling while the stream is connected
+	if (Settings.bUseStatusStream && ApiClient.IsValid())
+	{
+		StatusStream = ApiClient->GetBuildStatusStream(Settings.GetStatusStreamUrl());
+	}
+
+	// The ticker keeps polling while the manager window is closed
+	PollTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FGLCBuildStatusMonitor::OnPollTick), PollTickInterval);
+}
+
+void FGLCBuildStatusMonitor::Stop()
+{
+	if (StatusStream.IsValid())
+	{
+		for (const FWatchedBuild& Build : Builds)
+		{
+			StatusStream->Unsubscribe(Build.StreamHandle);
+		}
+		StatusStream.Reset();
+	}
+	Builds.Empty();
+
+	if (PollTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PollTickerHandle);
+		PollTickerHandle.Reset();
+	}
+
+	BatchETag.Empty();
+	BatchETagBuilds.Empty();
+}
+
+bool FGLCBuildStatusMonitor::OnPollTick(float DeltaTime)
+{
+	// A slow response must not pile up requests
+	if (bRequestInFlight || !ApiClient.IsValid() || (StatusStream.IsValid() && StatusStream->IsConnected()))
+	{
+		return true;
+	}
+
+	// Re-evaluated every tick, so a poll delayed for the background goes out as soon as the editor has focus again
+	const double Now = FPlatformTime::Seconds();
+	bool bAnyDue = false;
+	TArray<TPair<double, int64>> Candidates;
+	for (const FWatchedBuild& Build : Builds)
+	{
+		const double Overdue = (Now - Build.LastPollTime) / GetPollInterval(Build);
+		bAnyDue |= Overdue >= 1.0;
+
+		// Builds due soon ride along, so builds watched together keep sharing one request
+		if (Overdue >= 0.5)
+		{
+			Candidates.Emplace(Overdue, Build.AppBuildId);
+		}
+	}
+
+	if (!bAnyDue)
+	{
+		return true;
+	}
+
+	Candidates.Sort([](const TPair<double, int64>& A, const TPair<double, int64>& B) { return A.Key > B.Key; });
+
+	TArray<int64> AppBuildIds;
+	for (int32 Index = 0; Index < FMath::Min(Candidates.Num(), MaxBuildsPerRequest); Index++)
+	{
+		AppBuildIds.Add(Candidates[Index].Value);
+	}
+	Poll(AppBuildIds);
+	return true;
+}
+
+void FGLCBuildStatusMonitor::Poll(const TArray<int64>& AppBuildIds)
+{
+	bRequestInFlight = true;
+
+	const double Now = FPlatformTime::Seconds();
+	for (int64 AppBuildId : AppBuildIds)
+	{
+		FWatchedBuild* Build = FindBuild(AppBuildId);
+		Build->LastPollTime = Now;
+
+		// Keeps the editors of a team from polling in lockstep
+		Build->PollJitter = FMath::FRandRange(0.9f, 1.1f);
+	}
+
+	TArray<int64> SortedIds = AppBuildIds;
+	SortedIds.Sort();
+	const FString IfNoneMatch = SortedIds == BatchETagBuilds ? BatchETag : FString();
+
+	TWeakPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> WeakThis = AsShared();
+	ApiClient->GetBuildStatusesAsync(SortedIds, IfNoneMatch, [WeakThis, SortedIds](bool bSuccess, FString Error, bool bNotModified, TArray<FGLCBuildStatusResponse> Statuses, FString ETag)
+	{
+		TSharedPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (!This.IsValid())
+		{
+			return;
+		}
+		This->bRequestInFlight = false;
+
+		if (bSuccess && !bNotModified)
+		{
+			This->BatchETag = ETag;
+			This->BatchETagBuilds = SortedIds;
+		}
+		else if (!bSuccess)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] Failed to get status of %d builds: %s"), SortedIds.Num(), *Error);
+		}
+
+		// Failures, unchanged statuses and builds the server left out back off alike
+		for (int64 AppBuildId : SortedIds)
+		{
+			if (!Statuses.ContainsByPredicate([AppBuildId](const FGLCBuildStatusResponse& Status) { return Status.AppBuildId == AppBuildId; }))
+			{
+				if (FWatchedBuild* Build = This->FindBuild(AppBuildId))
+				{
+					Build->UnchangedPolls++;
+				}
+			}
+		}
+
+		// Subscribers may unsubscribe from their callback, so builds are looked up for every status
+		for (const FGLCBuildStatusResponse& Status : Statuses)
+		{
+			This->HandleStatus(Status);
+		}
+	});
+}
+
+void FGLCBuildStatusMonitor::HandleStatus(const FGLCBuildStatusResponse& Response)
+{
+	FWatchedBuild* Build = FindBuild(Response.AppBuildId);
+	if (Build == nullptr)
+	{
+		return;
+	}
+
+	const bool bChanged = Response.Status != Build->LastStatus || Response.StageProgress != Build->LastStageProgress;
+	Build->UnchangedPolls = bChanged ? 0 : Build->UnchangedPolls + 1;
+	Build->LastStatus = Response.Status;
+	Build->LastStageProgress = Response.StageProgress;
+
+	TArray<FOnStatus> Callbacks;
+	for (const FSubscriber& Subscriber : Build->Subscribers)
+	{
+		Callbacks.Add(Subscriber.OnStatus);
+	}
+
+	for (const FOnStatus& Callback : Callbacks)
+	{
+		Callback(Response);
+	}
+}
+
+FGLCBuildStatusMonitor::FWatchedBuild* FGLCBuildStatusMonitor::FindBuild(int64 AppBuildId)
+{
+	return Builds.FindByPredicate([AppBuildId](const FWatchedBuild& Build) { return Build.AppBuildId == AppBuildId; });
+}
+
+float FGLCBuildStatusMonitor::GetPollInterval(const FWatchedBuild& Build) const
+{
+	float Interval = FMath::Min(GetStagePollInterval(Build.LastStatus) * FMath::Pow(2.0f, (float)FMath::Min(Build.UnchangedPolls, 8)), MaxPollInterval);
+	if (IsEditorInBackground())
+	{
+		Interval = MaxPollInterval;
+	}
+	return Interval * Build.PollJitter;
+}
+
+float FGLCBuildStatusMonitor::GetStagePollInterval(const FString& Status)
+{
+	// Short stages the user watches closely are polled often; the queue can hold a build for a long time
+	if (Status == TEXT("Pending")) return 2.0f;
+	if (Status == TEXT("GeneratingPresignedUrl")) return 2.0f;
+	if (Status == TEXT("UploadingBuild")) return 2.0f;
+	if (Status == TEXT("DeployingPatch")) return 2.0f;
+	if (Status == TEXT("Enqueued")) return 30.0f;
+
+	return 5.0f;
+}
+
+bool FGLCBuildStatusMonitor::IsEditorInBackground()
+{
+	// A commandlet has no window to focus
+	return GIsEditor && !IsRunningCommandlet() && !FApp::HasFocus();
+}
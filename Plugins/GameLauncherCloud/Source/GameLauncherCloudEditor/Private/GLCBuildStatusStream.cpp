@@ -0,0 +1,290 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCBuildStatusStream.h"
+#include "GLCApiJson.h"
+#include "IWebSocket.h"
+#include "WebSocketsModule.h"
+#include "Dom/JsonObject.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGLCBuildStatusStream::FGLCBuildStatusStream(const FString& InUrl, const FString& InAuthToken, const FGLCRetryPolicy& InReconnectPolicy)
+	: Url(InUrl)
+	, AuthToken(InAuthToken)
+	, ReconnectPolicy(InReconnectPolicy)
+	, Generation(0)
+	, FailedConnects(0)
+	, bEverConnected(false)
+	, bUnavailable(false)
+{
+}
+
+FGLCBuildStatusStream::~FGLCBuildStatusStream()
+{
+	Disconnect();
+}
+
+FString FGLCBuildStatusStream::GetStreamUrl(const FString& ApiBaseUrl)
+{
+	FString StreamUrl = ApiBaseUrl;
+	if (StreamUrl.StartsWith(TEXT("https://")))
+	{
+		StreamUrl = TEXT("wss://") + StreamUrl.RightChop(8);
+	}
+	else if (StreamUrl.StartsWith(TEXT("http://")))
+	{
+		StreamUrl = TEXT("ws://") + StreamUrl.RightChop(7);
+	}
+	StreamUrl.RemoveFromEnd(TEXT("/"));
+
+	return StreamUrl + TEXT("/api/cli/build/status-stream");
+}
+
+FDelegateHandle FGLCBuildStatusStream::Subscribe(int64 AppBuildId, FOnStatus OnStatus)
+{
+	FSubscription& Subscription = Subscriptions.AddDefaulted_GetRef();
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.AppBuildId = AppBuildId;
+	Subscription.OnStatus = MoveTemp(OnStatus);
+	FDelegateHandle Handle = Subscription.Handle;
+
+	if (bUnavailable)
+	{
+		return Handle;
+	}
+
+	if (IsConnected())
+	{
+		SendSubscription(TEXT("subscribe"), { AppBuildId });
+	}
+	else if (!Socket.IsValid() && !ReconnectTickerHandle.IsValid())
+	{
+		// Subscriptions are sent once connected
+		Connect();
+	}
+
+	return Handle;
+}
+
+void FGLCBuildStatusStream::Unsubscribe(FDelegateHandle Handle)
+{
+	int32 Index = Subscriptions.IndexOfByPredicate([&Handle](const FSubscription& Subscription) { return Subscription.Handle == Handle; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int64 AppBuildId = Subscriptions[Index].AppBuildId;
+	Subscriptions.RemoveAt(Index);
+
+	if (Subscriptions.Num() == 0)
+	{
+		Disconnect();
+		return;
+	}
+
+	if (!Subscriptions.ContainsByPredicate([AppBuildId](const FSubscription& Subscription) { return Subscription.AppBuildId == AppBuildId; }))
+	{
+		SendSubscription(TEXT("unsubscribe"), { AppBuildId });
+	}
+}
+
+bool FGLCBuildStatusStream::IsConnected() const
+{
+	return Socket.IsValid() && Socket->IsConnected();
+}
+
+void FGLCBuildStatusStream::Connect()
+{
+	TMap<FString, FString> Headers;
+	if (!AuthToken.IsEmpty())
+	{
+		Headers.Add(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
+	}
+
+	Socket = FWebSocketsModule::Get().CreateWebSocket(Url, FString(), Headers);
+
+	TWeakPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> WeakStream = AsShared();
+	const int32 SocketGeneration = Generation;
+
+	Socket->OnConnected().AddLambda([WeakStream, SocketGeneration]()
+	{
+		TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+		if (Stream.IsValid() && Stream->Generation == SocketGeneration)
+		{
+			Stream->OnConnected();
+		}
+	});
+
+	Socket->OnConnectionError().AddLambda([WeakStream, SocketGeneration](const FString& Error)
+	{
+		TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+		if (Stream.IsValid() && Stream->Generation == SocketGeneration)
+		{
+			Stream->OnDisconnected(Error);
+		}
+	});
+
+	Socket->OnClosed().AddLambda([WeakStream, SocketGeneration](int32 StatusCode, const FString& Reason, bool bWasClean)
+	{
+		TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+		if (Stream.IsValid() && Stream->Generation == SocketGeneration)
+		{
+			Stream->OnDisconnected(Reason.IsEmpty() ? FString::Printf(TEXT("closed with %d"), StatusCode) : Reason);
+		}
+	});
+
+	Socket->OnMessage().AddLambda([WeakStream, SocketGeneration](const FString& Message)
+	{
+		TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+		if (Stream.IsValid() && Stream->Generation == SocketGeneration)
+		{
+			Stream->OnMessage(Message);
+		}
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Connecting to build status stream %s"), *Url);
+	Socket->Connect();
+}
+
+void FGLCBuildStatusStream::Disconnect()
+{
+	if (ReconnectTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReconnectTickerHandle);
+		ReconnectTickerHandle.Reset();
+	}
+
+	if (Socket.IsValid())
+	{
+		if (Socket->IsConnected())
+		{
+			Socket->Close();
+		}
+		ReleaseSocket();
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Build status stream closed"));
+	}
+}
+
+void FGLCBuildStatusStream::ReleaseSocket()
+{
+	Generation++;
+
+	TSharedPtr<IWebSocket> ReleasedSocket = MoveTemp(Socket);
+	Socket.Reset();
+	if (ReleasedSocket.IsValid())
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([ReleasedSocket](float DeltaTime)
+		{
+			return false;
+		}));
+	}
+}
+
+void FGLCBuildStatusStream::OnConnected()
+{
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Build status stream connected"));
+	FailedConnects = 0;
+	bEverConnected = true;
+
+	SendSubscription(TEXT("subscribe"), GetSubscribedBuilds());
+}
+
+void FGLCBuildStatusStream::OnDisconnected(const FString& Reason)
+{
+	ReleaseSocket();
+
+	if (Subscriptions.Num() == 0)
+	{
+		return;
+	}
+
+	FailedConnects++;
+
+	// Never reached: the server has no stream, subscribers keep polling
+	if (!bEverConnected && FailedConnects >= ReconnectPolicy.MaxAttempts)
+	{
+		bUnavailable = true;
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Build status stream unavailable (%s), polling instead"), *Reason);
+		return;
+	}
+
+	float Delay = ReconnectPolicy.GetRetryDelay(FailedConnects, nullptr);
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Build status stream disconnected (%s), reconnecting in %.1fs"), *Reason, Delay);
+
+	TWeakPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> WeakStream = AsShared();
+	ReconnectTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakStream](float DeltaTime)
+	{
+		if (TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin())
+		{
+			Stream->ReconnectTickerHandle.Reset();
+			if (Stream->Subscriptions.Num() > 0)
+			{
+				Stream->Connect();
+			}
+		}
+		return false;
+	}), Delay);
+}
+
+void FGLCBuildStatusStream::OnMessage(const FString& Message)
+{
+	FTCHARToUTF8 Utf8(*Message);
+	FGLCJsonReader Reader(TConstArrayView<uint8>((const uint8*)Utf8.Get(), Utf8.Length()));
+
+	FGLCBuildStatusResponse Status = FGLCBuildStatusResponse();
+	if (!GLCApiJson::Read(Reader, Status) || Status.AppBuildId <= 0)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[GLC] Ignoring build status stream message (%d bytes)"), Utf8.Length());
+		return;
+	}
+
+	// Subscribers may unsubscribe from their callback
+	TArray<FOnStatus> Callbacks;
+	for (const FSubscription& Subscription : Subscriptions)
+	{
+		if (Subscription.AppBuildId == Status.AppBuildId)
+		{
+			Callbacks.Add(Subscription.OnStatus);
+		}
+	}
+
+	for (const FOnStatus& Callback : Callbacks)
+	{
+		Callback(Status);
+	}
+}
+
+void FGLCBuildStatusStream::SendSubscription(const TCHAR* Type, const TArray<int64>& AppBuildIds)
+{
+	if (!IsConnected() || AppBuildIds.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> MessageObject = MakeShared<FJsonObject>();
+	MessageObject->SetStringField(TEXT("type"), Type);
+
+	TArray<TSharedPtr<FJsonValue>> IdsArray;
+	for (int64 AppBuildId : AppBuildIds)
+	{
+		IdsArray.Add(MakeShared<FJsonValueNumber>((double)AppBuildId));
+	}
+	MessageObject->SetArrayField(TEXT("appBuildIds"), IdsArray);
+
+	FString Message;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Message);
+	FJsonSerializer::Serialize(MessageObject, Writer);
+	Socket->Send(Message);
+}
+
+TArray<int64> FGLCBuildStatusStream::GetSubscribedBuilds() const
+{
+	TArray<int64> AppBuildIds;
+	for (const FSubscription& Subscription : Subscriptions)
+	{
+		AppBuildIds.AddUnique(Subscription.AppBuildId);
+	}
+	return AppBuildIds;
+}
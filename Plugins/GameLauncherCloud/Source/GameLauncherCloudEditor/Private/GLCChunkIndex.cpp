@@ -0,0 +1,185 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCChunkIndex.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+FString FGLCChunkIndex::GetIndexPath(int64 InAppId)
+{
+	return FPaths::ProjectIntermediateDir() / FString::Printf(TEXT("GameLauncherCloud/chunk_index_%lld.json"), InAppId);
+}
+
+bool FGLCChunkIndex::Load(int64 InAppId, FGLCChunkIndex& OutIndex)
+{
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetIndexPath(InAppId)))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Chunk index is corrupted, ignoring it"));
+		return false;
+	}
+
+	FString Algorithm;
+	if (!JsonObject->TryGetStringField(TEXT("algorithm"), Algorithm) || Algorithm != FGLCChunker::GetAlgorithmName())
+	{
+		return false;
+	}
+
+	FGLCChunkIndex Index;
+	JsonObject->TryGetNumberField(TEXT("appId"), Index.AppId);
+	JsonObject->TryGetNumberField(TEXT("appBuildId"), Index.AppBuildId);
+	JsonObject->TryGetNumberField(TEXT("minChunkSize"), Index.Params.MinSize);
+	JsonObject->TryGetNumberField(TEXT("averageChunkSize"), Index.Params.AverageSize);
+	JsonObject->TryGetNumberField(TEXT("maxChunkSize"), Index.Params.MaxSize);
+
+	const TSharedPtr<FJsonObject>* FilesObject = nullptr;
+	if (Index.AppId != InAppId || !JsonObject->TryGetObjectField(TEXT("files"), FilesObject) || !FilesObject)
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*FilesObject)->Values)
+	{
+		TSharedPtr<FJsonObject> FileObject = Pair.Value->AsObject();
+		if (!FileObject.IsValid())
+		{
+			continue;
+		}
+
+		// Ticks exceed the precision of a JSON number, so they are stored as a string
+		FString ModifiedTicks;
+		FFileEntry Entry;
+		FileObject->TryGetNumberField(TEXT("size"), Entry.Size);
+		FileObject->TryGetStringField(TEXT("modified"), ModifiedTicks);
+		Entry.ModifiedTime = FDateTime(FCString::Atoi64(*ModifiedTicks));
+
+		FString XxHash3;
+		if (FileObject->TryGetStringField(TEXT("xxh3"), XxHash3) && FileObject->TryGetStringField(TEXT("sha256"), Entry.Hash.Sha256))
+		{
+			Entry.Hash.XxHash3 = FGLCFileHash::ParseXxHash3(XxHash3);
+		}
+
+		// Offsets are implied by the chunk order
+		int64 Offset = 0;
+		const TArray<TSharedPtr<FJsonValue>>* ChunksArray = nullptr;
+		if (FileObject->TryGetArrayField(TEXT("chunks"), ChunksArray) && ChunksArray)
+		{
+			for (const TSharedPtr<FJsonValue>& ChunkValue : *ChunksArray)
+			{
+				TSharedPtr<FJsonObject> ChunkObject = ChunkValue->AsObject();
+				if (!ChunkObject.IsValid())
+				{
+					continue;
+				}
+
+				FGLCChunk& Chunk = Entry.Chunks.AddDefaulted_GetRef();
+				ChunkObject->TryGetStringField(TEXT("hash"), Chunk.Hash);
+				ChunkObject->TryGetNumberField(TEXT("size"), Chunk.Size);
+				Chunk.Offset = Offset;
+				Offset += Chunk.Size;
+			}
+		}
+
+		// Ignore entries whose chunks do not add up to the file
+		if (Offset == Entry.Size)
+		{
+			Index.Files.Add(Pair.Key, MoveTemp(Entry));
+		}
+	}
+
+	OutIndex = MoveTemp(Index);
+	return true;
+}
+
+bool FGLCChunkIndex::Save() const
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
+	FJsonSerializer::Serialize(ToJson(true), Writer);
+
+	// Write to a temp file first so a crash mid-write never leaves a truncated index
+	FString IndexPath = GetIndexPath(AppId);
+	FString TempPath = IndexPath + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(OutputString, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to write chunk index: %s"), *TempPath);
+		return false;
+	}
+
+	return IFileManager::Get().Move(*IndexPath, *TempPath, true, true);
+}
+
+const TArray<FGLCChunk>* FGLCChunkIndex::FindUnchangedFile(const FString& RelativePath, int64 Size, const FDateTime& ModifiedTime) const
+{
+	const FFileEntry* Entry = Files.Find(RelativePath);
+	if (Entry && Entry->Size == Size && Entry->ModifiedTime == ModifiedTime)
+	{
+		return &Entry->Chunks;
+	}
+	return nullptr;
+}
+
+int64 FGLCChunkIndex::GetTotalSize() const
+{
+	int64 TotalSize = 0;
+	for (const TPair<FString, FFileEntry>& Pair : Files)
+	{
+		TotalSize += Pair.Value.Size;
+	}
+	return TotalSize;
+}
+
+TSharedRef<FJsonObject> FGLCChunkIndex::ToJson(bool bIncludeLocalData) const
+{
+	TSharedPtr<FJsonObject> FilesObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, FFileEntry>& Pair : Files)
+	{
+		TArray<TSharedPtr<FJsonValue>> ChunksArray;
+		ChunksArray.Reserve(Pair.Value.Chunks.Num());
+		for (const FGLCChunk& Chunk : Pair.Value.Chunks)
+		{
+			TSharedPtr<FJsonObject> ChunkObject = MakeShareable(new FJsonObject);
+			ChunkObject->SetStringField(TEXT("hash"), Chunk.Hash);
+			ChunkObject->SetNumberField(TEXT("size"), Chunk.Size);
+			ChunksArray.Add(MakeShareable(new FJsonValueObject(ChunkObject)));
+		}
+
+		TSharedPtr<FJsonObject> FileObject = MakeShareable(new FJsonObject);
+		FileObject->SetNumberField(TEXT("size"), Pair.Value.Size);
+		if (bIncludeLocalData)
+		{
+			FileObject->SetStringField(TEXT("modified"), LexToString(Pair.Value.ModifiedTime.GetTicks()));
+		}
+		if (Pair.Value.Hash.IsSet())
+		{
+			FileObject->SetStringField(TEXT("xxh3"), Pair.Value.Hash.GetXxHash3String());
+			FileObject->SetStringField(TEXT("sha256"), Pair.Value.Hash.Sha256);
+		}
+		FileObject->SetArrayField(TEXT("chunks"), ChunksArray);
+		FilesObject->SetObjectField(Pair.Key, FileObject);
+	}
+
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("algorithm"), FGLCChunker::GetAlgorithmName());
+	JsonObject->SetNumberField(TEXT("minChunkSize"), Params.MinSize);
+	JsonObject->SetNumberField(TEXT("averageChunkSize"), Params.AverageSize);
+	JsonObject->SetNumberField(TEXT("maxChunkSize"), Params.MaxSize);
+	JsonObject->SetNumberField(TEXT("totalSize"), GetTotalSize());
+	if (bIncludeLocalData)
+	{
+		JsonObject->SetNumberField(TEXT("appId"), AppId);
+		JsonObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	}
+	JsonObject->SetObjectField(TEXT("files"), FilesObject);
+	return JsonObject;
+}
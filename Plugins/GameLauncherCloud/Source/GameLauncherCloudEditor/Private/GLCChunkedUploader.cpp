@@ -0,0 +1,431 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCChunkedUploader.h"
+#include "GLCBuildManifest.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+namespace GLCChunkedUpload
+{
+	// Hashes sent per missing-chunks request
+	constexpr int32 QueryBatchSize = 1000;
+
+	// Share of the overall progress taken by chunking; uploading the missing chunks takes the rest
+	constexpr float ChunkingProgressShare = 0.25f;
+}
+
+FGLCChunkedUploader::FGLCChunkedUploader(FGLCApiClient* InApiClient, int64 InAppId, const FGLCStartChunkedUploadResponse& InUpload, const FGLCChunkingParams& InParams, FGLCFileHashesPtr InFileHashes, int32 InMaxConcurrency)
+	: ApiClient(InApiClient)
+	, AppId(InAppId)
+	, Upload(InUpload)
+	, Params(InParams)
+	, FileHashes(InFileHashes)
+	, MaxConcurrency(FMath::Max(1, InMaxConcurrency))
+	, bCancelRequested(false)
+	, ChunkedBytes(0)
+	, TotalBytes(0)
+	, LastReportedPercent(-1)
+	, NextQueryIndex(0)
+	, bQueryFinished(false)
+	, NextChunkToLaunch(0)
+	, MissingBytes(0)
+	, UploadedBytes(0)
+	, bChunkingFinished(false)
+	, bFinished(false)
+{
+}
+
+void FGLCChunkedUploader::Start(const FString& SourceDirectory, TFunction<void(bool, FString, float)> InProgressCallback)
+{
+	ProgressCallback = InProgressCallback;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Chunked upload started: %s, average chunk %d KB, %d concurrent"), *SourceDirectory, Params.AverageSize / 1024, MaxConcurrency);
+
+	TSharedRef<FGLCChunkedUploader, ESPMode::ThreadSafe> This = AsShared();
+	Async(EAsyncExecution::ThreadPool, [This, SourceDirectory]()
+	{
+		FString Error;
+		bool bSuccess = This->BuildIndex(SourceDirectory, Error);
+
+		AsyncTask(ENamedThreads::GameThread, [This, bSuccess, Error]()
+		{
+			This->OnIndexBuilt(bSuccess, Error);
+		});
+	});
+}
+
+void FGLCChunkedUploader::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bCancelRequested = true;
+
+	// Copy first: cancelling may complete the request and modify the map
+	TArray<FGLCRetryingRequestPtr> Requests;
+	InFlightRequests.GenerateValueArray(Requests);
+	for (const FGLCRetryingRequestPtr& Request : Requests)
+	{
+		Request->Cancel();
+	}
+
+	Finish(false, TEXT("Upload cancelled"), -1.0f);
+}
+
+// ========== WORKER THREADS ========== //
+
+bool FGLCChunkedUploader::BuildIndex(const FString& SourceDirectory, FString& OutError)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const FString Root = FPaths::ConvertRelativePathToFull(SourceDirectory);
+	const FString RootWithSlash = Root.EndsWith(TEXT("/")) ? Root : Root + TEXT("/");
+
+	TArray<TPair<FString, FFileStatData>> Files;
+	if (!FGLCBuildManifest::CollectFiles(Root, Files, &bCancelRequested))
+	{
+		OutError = TEXT("Upload cancelled");
+		return false;
+	}
+
+	// Stable order so the manifest and the upload order do not depend on directory listing order
+	Files.Sort([](const TPair<FString, FFileStatData>& A, const TPair<FString, FFileStatData>& B) { return A.Key < B.Key; });
+
+	int64 Total = 0;
+	for (const TPair<FString, FFileStatData>& File : Files)
+	{
+		Total += File.Value.FileSize;
+	}
+	TotalBytes = Total;
+
+	FGLCChunkIndex PreviousIndex;
+	bool bHasPreviousIndex = FGLCChunkIndex::Load(AppId, PreviousIndex) && PreviousIndex.Params == Params;
+
+	TArray<FString> RelativePaths;
+	TArray<FGLCChunkIndex::FFileEntry> Entries;
+	RelativePaths.SetNum(Files.Num());
+	Entries.SetNum(Files.Num());
+
+	TAtomic<bool> bReadFailed(false);
+	TAtomic<int32> ReusedFiles(0);
+	TWeakPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+
+	ParallelFor(Files.Num(), [&](int32 Index)
+	{
+		if (bCancelRequested || bReadFailed)
+		{
+			return;
+		}
+
+		const TPair<FString, FFileStatData>& File = Files[Index];
+		FString RelativePath = File.Key;
+		FPaths::MakePathRelativeTo(RelativePath, *RootWithSlash);
+		RelativePaths[Index] = RelativePath;
+
+		FGLCChunkIndex::FFileEntry& Entry = Entries[Index];
+		Entry.Size = File.Value.FileSize;
+		Entry.ModifiedTime = File.Value.ModificationTime;
+		if (FileHashes.IsValid())
+		{
+			Entry.Hash = FileHashes->FindRef(RelativePath);
+		}
+
+		const TArray<FGLCChunk>* PreviousChunks = bHasPreviousIndex ? PreviousIndex.FindUnchangedFile(RelativePath, Entry.Size, Entry.ModifiedTime) : nullptr;
+		if (PreviousChunks)
+		{
+			Entry.Chunks = *PreviousChunks;
+			ReusedFiles++;
+		}
+		else if (!FGLCChunker::ChunkFile(File.Key, Params, Entry.Chunks, &bCancelRequested))
+		{
+			bReadFailed = true;
+			return;
+		}
+
+		// Forward progress to the game thread at most once per percent
+		int64 Chunked = (ChunkedBytes += Entry.Size);
+		int32 Percent = Total > 0 ? (int32)(Chunked * 100 / Total) : 100;
+		int32 LastPercent = LastReportedPercent.Load();
+		if (Percent > LastPercent && LastReportedPercent.CompareExchange(LastPercent, Percent))
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+			{
+				if (TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->ReportProgress();
+				}
+			});
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	if (bCancelRequested)
+	{
+		OutError = TEXT("Upload cancelled");
+		return false;
+	}
+	if (bReadFailed)
+	{
+		OutError = TEXT("Failed to read build files");
+		return false;
+	}
+
+	NewIndex.AppId = AppId;
+	NewIndex.AppBuildId = Upload.AppBuildId;
+	NewIndex.Params = Params;
+
+	int32 ChunkCount = 0;
+	for (int32 Index = 0; Index < Files.Num(); Index++)
+	{
+		for (const FGLCChunk& Chunk : Entries[Index].Chunks)
+		{
+			ChunkCount++;
+			if (!ChunkSources.Contains(Chunk.Hash))
+			{
+				FChunkSource& Source = ChunkSources.Add(Chunk.Hash);
+				Source.FilePath = Files[Index].Key;
+				Source.Offset = Chunk.Offset;
+				Source.Size = Chunk.Size;
+				UniqueHashes.Add(Chunk.Hash);
+			}
+		}
+		NewIndex.Files.Add(RelativePaths[Index], MoveTemp(Entries[Index]));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Chunked %d files (%.2f MB, %d unchanged) into %d chunks, %d unique, in %.2f s"),
+		Files.Num(), Total / (1024.0 * 1024.0), ReusedFiles.Load(), ChunkCount, UniqueHashes.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return true;
+}
+
+// ========== GAME THREAD ========== //
+
+void FGLCChunkedUploader::OnIndexBuilt(bool bSuccess, const FString& Error)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		Finish(false, Error, 1.0f);
+		return;
+	}
+
+	bChunkingFinished = true;
+	ReportProgress();
+	QueryNextBatch();
+}
+
+void FGLCChunkedUploader::QueryNextBatch()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (NextQueryIndex >= UniqueHashes.Num())
+	{
+		bQueryFinished = true;
+
+		UE_LOG(LogTemp, Log, TEXT("[GLC] %d of %d unique chunks missing on the server (%.2f MB to upload)"), MissingChunks.Num(), UniqueHashes.Num(), MissingBytes / (1024.0 * 1024.0));
+
+		// Nothing (left) to upload
+		if (NextChunkToLaunch >= MissingChunks.Num() && InFlightRequests.Num() == 0)
+		{
+			CompleteUpload();
+		}
+		return;
+	}
+
+	int32 BatchCount = FMath::Min(GLCChunkedUpload::QueryBatchSize, UniqueHashes.Num() - NextQueryIndex);
+	TArray<FString> Batch(UniqueHashes.GetData() + NextQueryIndex, BatchCount);
+	NextQueryIndex += BatchCount;
+
+	TWeakPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	ApiClient->GetMissingChunksAsync(Upload.AppBuildId, Batch, [WeakThis](bool bSuccess, FString Error, TArray<FGLCChunkUploadUrl> Chunks)
+	{
+		TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (!This.IsValid() || This->bFinished)
+		{
+			return;
+		}
+
+		if (!bSuccess)
+		{
+			This->Finish(false, FString::Printf(TEXT("Failed to query missing chunks: %s"), *Error), 1.0f);
+			return;
+		}
+
+		for (FGLCChunkUploadUrl& Chunk : Chunks)
+		{
+			const FChunkSource* Source = This->ChunkSources.Find(Chunk.Hash);
+			if (!Source)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[GLC] Server requested unknown chunk %s"), *Chunk.Hash);
+				continue;
+			}
+			This->MissingBytes += Source->Size;
+			This->MissingChunks.Add(MoveTemp(Chunk));
+		}
+
+		// Upload this batch while the next one is being queried
+		This->LaunchPendingChunks();
+		This->QueryNextBatch();
+	});
+}
+
+void FGLCChunkedUploader::LaunchPendingChunks()
+{
+	while (!bFinished && NextChunkToLaunch < MissingChunks.Num() && InFlightRequests.Num() < MaxConcurrency)
+	{
+		int32 ChunkIndex = NextChunkToLaunch++;
+		const FGLCChunkUploadUrl& Chunk = MissingChunks[ChunkIndex];
+		const FChunkSource& Source = ChunkSources.FindChecked(Chunk.Hash);
+
+		TWeakPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+		FGLCRetryingRequestPtr Request = ApiClient->UploadPartAsync(Chunk.Url, Source.FilePath, Source.Offset, Source.Size,
+			[WeakThis, ChunkIndex](int64 BytesSent)
+			{
+				if (TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->OnChunkBytesSent(ChunkIndex, BytesSent);
+				}
+			},
+			[WeakThis, ChunkIndex](bool bSuccess, FString Error, FString ETag)
+			{
+				if (TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->OnChunkFinished(ChunkIndex, bSuccess, Error);
+				}
+			});
+
+		if (!Request.IsValid())
+		{
+			OnChunkFinished(ChunkIndex, false, TEXT("Failed to read file"));
+			return;
+		}
+
+		InFlightRequests.Add(ChunkIndex, Request);
+	}
+}
+
+void FGLCChunkedUploader::OnChunkBytesSent(int32 ChunkIndex, int64 BytesSent)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	ChunkBytesSent.Add(ChunkIndex, BytesSent);
+	ReportProgress();
+}
+
+void FGLCChunkedUploader::OnChunkFinished(int32 ChunkIndex, bool bSuccess, const FString& Error)
+{
+	InFlightRequests.Remove(ChunkIndex);
+	ChunkBytesSent.Remove(ChunkIndex);
+
+	if (bFinished || bCancelRequested)
+	{
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		bCancelRequested = true;
+
+		TArray<FGLCRetryingRequestPtr> Requests;
+		InFlightRequests.GenerateValueArray(Requests);
+		for (const FGLCRetryingRequestPtr& Request : Requests)
+		{
+			Request->Cancel();
+		}
+
+		Finish(false, FString::Printf(TEXT("Chunk %s failed: %s"), *MissingChunks[ChunkIndex].Hash, *Error), 1.0f);
+		return;
+	}
+
+	UploadedBytes += ChunkSources.FindChecked(MissingChunks[ChunkIndex].Hash).Size;
+	ReportProgress();
+
+	if (bQueryFinished && NextChunkToLaunch >= MissingChunks.Num() && InFlightRequests.Num() == 0)
+	{
+		CompleteUpload();
+		return;
+	}
+
+	LaunchPendingChunks();
+}
+
+void FGLCChunkedUploader::ReportProgress()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	const int64 Total = TotalBytes.Load();
+	float ChunkingProgress = bChunkingFinished ? 1.0f : (Total > 0 ? (float)((double)ChunkedBytes.Load() / (double)Total) : 0.0f);
+	float Progress = ChunkingProgress * GLCChunkedUpload::ChunkingProgressShare;
+
+	// The amount to upload is only known once every batch has been queried
+	if (bQueryFinished)
+	{
+		int64 InFlightBytes = 0;
+		for (const TPair<int32, int64>& Pair : ChunkBytesSent)
+		{
+			InFlightBytes += Pair.Value;
+		}
+
+		float UploadProgress = MissingBytes > 0 ? (float)((double)(UploadedBytes + InFlightBytes) / (double)MissingBytes) : 1.0f;
+		Progress += UploadProgress * (1.0f - GLCChunkedUpload::ChunkingProgressShare);
+	}
+
+	// Never report 100% until the upload has been completed on the server
+	ProgressCallback(false, bChunkingFinished ? TEXT("Uploading changed chunks") : TEXT("Chunking build"), FMath::Min(Progress, 0.99f));
+}
+
+void FGLCChunkedUploader::CompleteUpload()
+{
+	UE_LOG(LogTemp, Log, TEXT("[GLC] All missing chunks uploaded (%.2f MB of %.2f MB), completing chunked upload"), UploadedBytes / (1024.0 * 1024.0), TotalBytes.Load() / (1024.0 * 1024.0));
+
+	TWeakPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	ApiClient->CompleteChunkedUploadAsync(Upload.AppBuildId, Upload.Key, NewIndex.ToJson(false), [WeakThis](bool bSuccess, FString Error)
+	{
+		TSharedPtr<FGLCChunkedUploader, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (!This.IsValid())
+		{
+			return;
+		}
+
+		if (!bSuccess)
+		{
+			This->Finish(false, FString::Printf(TEXT("Failed to complete chunked upload: %s"), *Error), 1.0f);
+			return;
+		}
+
+		// The next upload of this app deduplicates against this build
+		if (!This->NewIndex.Save())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] Failed to save chunk index, the next upload will chunk every file again"));
+		}
+
+		This->Finish(true, TEXT("Upload complete"), 1.0f);
+	});
+}
+
+void FGLCChunkedUploader::Finish(bool bSuccess, const FString& Message, float Progress)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Chunked upload finished: %s"), *Message);
+	ProgressCallback(bSuccess, Message, Progress);
+}
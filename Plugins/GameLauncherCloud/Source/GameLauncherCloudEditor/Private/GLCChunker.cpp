@@ -0,0 +1,166 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCChunker.h"
+#include "Hash/Blake3.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Templates/UniquePtr.h"
+
+namespace GLCChunker
+{
+	// Files are read in blocks of this size; chunking and hashing work on the in-memory block
+	constexpr int64 ReadBlockSize = 8 * 1024 * 1024;
+
+	/** Gear table: 256 pseudo-random 64-bit values from a fixed seed, so cut points are stable across runs and machines */
+	struct FGearTable
+	{
+		uint64 Values[256];
+
+		FGearTable()
+		{
+			// splitmix64
+			uint64 State = 0x474C4343444331ULL;
+			for (int32 Index = 0; Index < 256; Index++)
+			{
+				State += 0x9E3779B97F4A7C15ULL;
+				uint64 Value = State;
+				Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBULL;
+				Values[Index] = Value ^ (Value >> 31);
+			}
+		}
+	};
+
+	static const FGearTable& GetGearTable()
+	{
+		static const FGearTable Table;
+		return Table;
+	}
+
+	/** Mask with the top Bits bits set; the gear hash mixes the most recent bytes into its high bits */
+	static uint64 MakeMask(int32 Bits)
+	{
+		Bits = FMath::Clamp(Bits, 1, 63);
+		return ~0ULL << (64 - Bits);
+	}
+}
+
+FGLCChunkingParams::FGLCChunkingParams(int32 InAverageSize)
+{
+	AverageSize = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Clamp(InAverageSize, 64 * 1024, 16 * 1024 * 1024));
+	MinSize = AverageSize / 4;
+	MaxSize = AverageSize * 4;
+}
+
+int64 FGLCChunker::FindCutPoint(const uint8* Data, int64 Num, const FGLCChunkingParams& Params)
+{
+	if (Num <= Params.MinSize)
+	{
+		return Num;
+	}
+
+	const int64 End = FMath::Min<int64>(Num, Params.MaxSize);
+	const int64 Normal = FMath::Min<int64>(End, Params.AverageSize);
+
+	const int32 AverageBits = FMath::FloorLog2((uint32)Params.AverageSize);
+	const uint64 MaskSmall = GLCChunker::MakeMask(AverageBits + 2);
+	const uint64 MaskLarge = GLCChunker::MakeMask(AverageBits - 2);
+	const uint64* Gear = GLCChunker::GetGearTable().Values;
+
+	// Bytes below the minimum size are never cut, so they are not hashed either
+	uint64 Hash = 0;
+	int64 Index = Params.MinSize;
+	for (; Index < Normal; Index++)
+	{
+		Hash = (Hash << 1) + Gear[Data[Index]];
+		if ((Hash & MaskSmall) == 0)
+		{
+			return Index + 1;
+		}
+	}
+	for (; Index < End; Index++)
+	{
+		Hash = (Hash << 1) + Gear[Data[Index]];
+		if ((Hash & MaskLarge) == 0)
+		{
+			return Index + 1;
+		}
+	}
+	return End;
+}
+
+FString FGLCChunker::HashBuffer(const uint8* Data, int64 Num)
+{
+	FBlake3Hash Hash = FBlake3::HashBuffer(Data, (uint64)Num);
+	return BytesToHexLower(Hash.GetBytes(), sizeof(FBlake3Hash::ByteArray));
+}
+
+bool FGLCChunker::ChunkFile(const FString& FilePath, const FGLCChunkingParams& Params, TArray<FGLCChunk>& OutChunks, const TAtomic<bool>* bCancelRequested)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Cannot open %s for chunking"), *FilePath);
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+	OutChunks.Reset();
+	OutChunks.Reserve((int32)FMath::DivideAndRoundUp<int64>(FileSize, Params.AverageSize));
+
+	// Every cut point needs up to MaxSize bytes ahead of it in memory
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized((int32)(FMath::Max<int64>(GLCChunker::ReadBlockSize, Params.MaxSize) + Params.MaxSize));
+
+	int64 BufferFileOffset = 0;
+	int64 BufferEnd = 0;
+	int64 Position = 0;
+	int64 ReadOffset = 0;
+
+	while (true)
+	{
+		if (BufferEnd - Position < Params.MaxSize && ReadOffset < FileSize)
+		{
+			// Move the unconsumed tail to the front and refill
+			const int64 Remaining = BufferEnd - Position;
+			if (Position > 0 && Remaining > 0)
+			{
+				FMemory::Memmove(Buffer.GetData(), Buffer.GetData() + Position, Remaining);
+			}
+			BufferFileOffset += Position;
+			BufferEnd = Remaining;
+			Position = 0;
+
+			const int64 ToRead = FMath::Min<int64>(Buffer.Num() - BufferEnd, FileSize - ReadOffset);
+			if (!Handle->Read(Buffer.GetData() + BufferEnd, ToRead))
+			{
+				UE_LOG(LogTemp, Error, TEXT("[GLC] Read failed while chunking %s"), *FilePath);
+				return false;
+			}
+			BufferEnd += ToRead;
+			ReadOffset += ToRead;
+		}
+
+		if (Position >= BufferEnd)
+		{
+			break;
+		}
+
+		if (bCancelRequested && bCancelRequested->Load())
+		{
+			return false;
+		}
+
+		const int64 Length = FindCutPoint(Buffer.GetData() + Position, BufferEnd - Position, Params);
+
+		FGLCChunk& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Offset = BufferFileOffset + Position;
+		Chunk.Size = Length;
+		Chunk.Hash = HashBuffer(Buffer.GetData() + Position, Length);
+
+		Position += Length;
+	}
+
+	return true;
+}
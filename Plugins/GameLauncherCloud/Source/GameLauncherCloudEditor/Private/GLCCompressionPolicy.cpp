@@ -0,0 +1,126 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCCompressionPolicy.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	// Three samples (start, middle, end) are enough to spot already-compressed data
+	// without reading whole files
+	constexpr int64 EntropySampleSize = 64 * 1024;
+	constexpr int32 EntropySampleCount = 3;
+}
+
+FGLCCompressionPolicy::FGLCCompressionPolicy()
+{
+	StoreExtensions = {
+		// Cooked UE containers, already compressed per block
+		TEXT(".pak"), TEXT(".ucas"), TEXT(".utoc"),
+		// Archives
+		TEXT(".zip"), TEXT(".7z"), TEXT(".gz"), TEXT(".rar"),
+		// Media
+		TEXT(".png"), TEXT(".jpg"), TEXT(".jpeg"), TEXT(".mp4"), TEXT(".webm"), TEXT(".bk2"), TEXT(".ogg"), TEXT(".mp3")
+	};
+}
+
+EGLCCompressionMethod FGLCCompressionPolicy::ChooseMethod(const FString& FilePath, int64 FileSize) const
+{
+	if (FileSize < MinCompressSize)
+	{
+		return EGLCCompressionMethod::Store;
+	}
+
+	FString Extension = FPaths::GetExtension(FilePath, true).ToLower();
+	if (StoreExtensions.Contains(Extension))
+	{
+		return EGLCCompressionMethod::Store;
+	}
+
+	double Entropy = EstimateEntropy(FilePath, FileSize);
+	if (Entropy >= StoreEntropyThreshold)
+	{
+		return EGLCCompressionMethod::Store;
+	}
+
+	return FileSize > FastDeflateThreshold ? EGLCCompressionMethod::FastDeflate : EGLCCompressionMethod::HighDeflate;
+}
+
+int32 FGLCCompressionPolicy::GetLevel(EGLCCompressionMethod Method) const
+{
+	switch (Method)
+	{
+	case EGLCCompressionMethod::FastDeflate:
+		return FMath::Clamp(FastDeflateLevel, 1, 9);
+	case EGLCCompressionMethod::HighDeflate:
+		return FMath::Clamp(HighDeflateLevel, 1, 9);
+	default:
+		return 0;
+	}
+}
+
+double FGLCCompressionPolicy::EstimateEntropy(const FString& FilePath, int64 FileSize)
+{
+	if (FileSize <= 0)
+	{
+		return -1.0;
+	}
+
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		return -1.0;
+	}
+
+	uint64 Histogram[256] = {};
+	int64 TotalSampled = 0;
+
+	// Small files are read in one go; larger ones at the start, middle and end
+	const bool bSingleSample = FileSize <= EntropySampleSize * EntropySampleCount;
+	const int32 SampleCount = bSingleSample ? 1 : EntropySampleCount;
+	const int64 SampleLength = bSingleSample ? FileSize : EntropySampleSize;
+
+	TArray<uint8> Sample;
+	Sample.SetNumUninitialized((int32)SampleLength);
+
+	for (int32 SampleIndex = 0; SampleIndex < SampleCount; SampleIndex++)
+	{
+		int64 Offset = bSingleSample ? 0 : (FileSize - SampleLength) * SampleIndex / (SampleCount - 1);
+		if (!Handle->Seek(Offset) || !Handle->Read(Sample.GetData(), SampleLength))
+		{
+			return -1.0;
+		}
+
+		for (uint8 Byte : Sample)
+		{
+			Histogram[Byte]++;
+		}
+		TotalSampled += SampleLength;
+	}
+
+	double Entropy = 0.0;
+	for (uint64 Count : Histogram)
+	{
+		if (Count > 0)
+		{
+			double P = (double)Count / (double)TotalSampled;
+			Entropy -= P * FMath::Log2(P);
+		}
+	}
+
+	return Entropy;
+}
+
+const TCHAR* FGLCCompressionPolicy::LexToString(EGLCCompressionMethod Method)
+{
+	switch (Method)
+	{
+	case EGLCCompressionMethod::FastDeflate:
+		return TEXT("FastDeflate");
+	case EGLCCompressionMethod::HighDeflate:
+		return TEXT("HighDeflate");
+	default:
+		return TEXT("Store");
+	}
+}
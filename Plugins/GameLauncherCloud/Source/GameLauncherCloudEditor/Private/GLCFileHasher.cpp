@@ -0,0 +1,130 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCFileHasher.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Templates/UniquePtr.h"
+
+uint64 FGLCFileHash::ParseXxHash3(const FString& Value)
+{
+	return FCString::Strtoui64(*Value, nullptr, 16);
+}
+
+FGLCFileHasher::FGLCFileHasher()
+{
+}
+
+void FGLCFileHasher::Update(const uint8* Data, int64 Num)
+{
+	XxHashBuilder.Update(Data, (uint64)Num);
+	Sha256.Update(Data, Num);
+}
+
+FGLCFileHash FGLCFileHasher::Finalize()
+{
+	FGLCFileHash Hash;
+	Hash.XxHash3 = XxHashBuilder.Finalize().Hash;
+	Hash.Sha256 = Sha256.Finalize().ToHex();
+	XxHashBuilder.Reset();
+	return Hash;
+}
+
+bool FGLCFileHasher::HashFile(const FString& FilePath, FGLCFileHash& OutHash, int64 PartSize, TArray<FString>* OutPartChecksums, const TAtomic<bool>* bCancelRequested)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Cannot open %s for hashing"), *FilePath);
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+	const bool bHashParts = PartSize > 0 && OutPartChecksums;
+	if (bHashParts)
+	{
+		OutPartChecksums->Reset();
+		OutPartChecksums->Reserve((int32)FMath::DivideAndRoundUp(FileSize, PartSize));
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized((int32)FMath::Min(ReadBlockSize, FMath::Max<int64>(FileSize, 1)));
+
+	FGLCFileHasher FileHasher;
+	FGLCSha256 PartHasher;
+	int64 PartBytes = 0;
+
+	for (int64 Offset = 0; Offset < FileSize; )
+	{
+		if (bCancelRequested && bCancelRequested->Load())
+		{
+			return false;
+		}
+
+		const int64 ToRead = FMath::Min<int64>(Buffer.Num(), FileSize - Offset);
+		if (!Handle->Read(Buffer.GetData(), ToRead))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Read failed while hashing %s"), *FilePath);
+			return false;
+		}
+
+		FileHasher.Update(Buffer.GetData(), ToRead);
+
+		// Split the block at part boundaries
+		for (int64 BlockOffset = 0; bHashParts && BlockOffset < ToRead; )
+		{
+			const int64 ToHash = FMath::Min(ToRead - BlockOffset, PartSize - PartBytes);
+			PartHasher.Update(Buffer.GetData() + BlockOffset, ToHash);
+			PartBytes += ToHash;
+			BlockOffset += ToHash;
+
+			if (PartBytes == PartSize)
+			{
+				OutPartChecksums->Add(PartHasher.Finalize().ToBase64());
+				PartBytes = 0;
+			}
+		}
+
+		Offset += ToRead;
+	}
+
+	if (bHashParts && PartBytes > 0)
+	{
+		OutPartChecksums->Add(PartHasher.Finalize().ToBase64());
+	}
+
+	OutHash = FileHasher.Finalize();
+	return true;
+}
+
+bool FGLCFileHasher::HashFiles(const TArray<FString>& FilePaths, TArray<FGLCFileHash>& OutHashes, const TAtomic<bool>* bCancelRequested, TAtomic<int64>* BytesHashed)
+{
+	OutHashes.Reset();
+	OutHashes.SetNum(FilePaths.Num());
+
+	TAtomic<bool> bReadFailed(false);
+
+	// One file per task keeps every read sequential; small files are balanced by the scheduler
+	ParallelFor(FilePaths.Num(), [&](int32 Index)
+	{
+		if (bReadFailed || (bCancelRequested && bCancelRequested->Load()))
+		{
+			return;
+		}
+
+		if (!HashFile(FilePaths[Index], OutHashes[Index], 0, nullptr, bCancelRequested))
+		{
+			bReadFailed = true;
+			return;
+		}
+
+		if (BytesHashed)
+		{
+			*BytesHashed += IFileManager::Get().FileSize(*FilePaths[Index]);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	return !bReadFailed && !(bCancelRequested && bCancelRequested->Load());
+}
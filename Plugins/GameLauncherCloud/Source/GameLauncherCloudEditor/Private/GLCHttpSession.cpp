@@ -0,0 +1,302 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCHttpSession.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformHttp.h"
+
+namespace GLCHttpSession
+{
+	FString GetUserAgent()
+	{
+		TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GameLauncherCloud"));
+		FString Version = Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("1.0.0");
+		return FString::Printf(TEXT("GameLauncherCloud-Unreal/%s (%s)"), *Version, ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	}
+
+	/** Copy of a request to send again: URL, verb, headers and body; Authorization is set again when it is sent */
+	FGLCHttpSession::FRequestRef CloneRequest(const FGLCHttpSession::FRequestRef& Source)
+	{
+		FGLCHttpSession::FRequestRef Clone = FHttpModule::Get().CreateRequest();
+		Clone->SetURL(Source->GetURL());
+		Clone->SetVerb(Source->GetVerb());
+
+		for (const FString& Header : Source->GetAllHeaders())
+		{
+			FString Name;
+			FString Value;
+			if (Header.Split(TEXT(":"), &Name, &Value) && !Name.TrimStartAndEnd().Equals(TEXT("Authorization"), ESearchCase::IgnoreCase))
+			{
+				Clone->SetHeader(Name.TrimStartAndEnd(), Value.TrimStartAndEnd());
+			}
+		}
+
+		if (Source->GetContentLength() > 0)
+		{
+			Clone->SetContent(CopyTemp(Source->GetContent()));
+		}
+		return Clone;
+	}
+
+	/** Timestamps written from the HTTP callbacks of one request */
+	struct FRequestClock
+	{
+		TAtomic<uint64> FirstByteCycles { 0 };
+	};
+}
+
+FGLCHttpSession::FGLCHttpSession(const FString& InBaseUrl)
+	: BaseUrl(InBaseUrl)
+	, MaxConnectionsPerHost(DefaultMaxConnectionsPerHost)
+	, CompletedRequests(0)
+{
+	BaseUrl.RemoveFromEnd(TEXT("/"));
+
+	DefaultHeaders.Add(TEXT("Accept"), TEXT("application/json"));
+	DefaultHeaders.Add(TEXT("Connection"), TEXT("keep-alive"));
+	DefaultHeaders.Add(TEXT("User-Agent"), GLCHttpSession::GetUserAgent());
+}
+
+void FGLCHttpSession::SetDefaultHeader(const FString& Name, const FString& Value)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (Value.IsEmpty())
+	{
+		DefaultHeaders.Remove(Name);
+	}
+	else
+	{
+		DefaultHeaders.Add(Name, Value);
+	}
+}
+
+void FGLCHttpSession::SetAuthToken(const FString& Token)
+{
+	SetDefaultHeader(TEXT("Authorization"), Token.IsEmpty() ? FString() : TEXT("Bearer ") + Token);
+}
+
+void FGLCHttpSession::SetMaxConnectionsPerHost(int32 MaxConnections)
+{
+	FScopeLock ScopeLock(&Lock);
+	MaxConnectionsPerHost = FMath::Max(1, MaxConnections);
+}
+
+FGLCHttpSession::FRequestRef FGLCHttpSession::CreateRequest(const FString& Verb, const FString& Path) const
+{
+	FRequestRef Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(BaseUrl + Path);
+	Request->SetVerb(Verb);
+
+	FScopeLock ScopeLock(&Lock);
+	for (const TPair<FString, FString>& Header : DefaultHeaders)
+	{
+		Request->SetHeader(Header.Key, Header.Value);
+	}
+	if (Verb != TEXT("GET"))
+	{
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	}
+
+	return Request;
+}
+
+void FGLCHttpSession::ProcessRequest(const FRequestRef& Request)
+{
+	FString Host = FPlatformHttp::GetUrlDomain(Request->GetURL());
+	double Now = FPlatformTime::Seconds();
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		FHostState& HostState = Hosts.FindOrAdd(Host);
+		if (HostState.ActiveRequests >= MaxConnectionsPerHost)
+		{
+			HostState.Pending.Add({ Request, Now });
+			return;
+		}
+		HostState.ActiveRequests++;
+	}
+
+	Send(Request, Host, Now);
+}
+
+FGLCRetryingRequestPtr FGLCHttpSession::ProcessRequest(const FRequestRef& Request, const FGLCRetryPolicy& Policy)
+{
+	FHttpRequestCompleteDelegate Completion = Request->OnProcessRequestComplete();
+	Request->OnProcessRequestComplete().Unbind();
+
+	TWeakPtr<FGLCHttpSession, ESPMode::ThreadSafe> WeakSession = AsShared();
+	return FGLCRetryingRequest::Start(Policy,
+		[Request](int32 Attempt) -> FHttpRequestPtr
+		{
+			return Attempt == 1 ? Request : GLCHttpSession::CloneRequest(Request);
+		},
+		Completion,
+		[WeakSession](const FRequestRef& AttemptRequest)
+		{
+			if (TSharedPtr<FGLCHttpSession, ESPMode::ThreadSafe> Session = WeakSession.Pin())
+			{
+				Session->ProcessRequest(AttemptRequest);
+			}
+			else
+			{
+				AttemptRequest->ProcessRequest();
+			}
+		},
+		[WeakSession](const FRequestRef& AttemptRequest)
+		{
+			if (TSharedPtr<FGLCHttpSession, ESPMode::ThreadSafe> Session = WeakSession.Pin())
+			{
+				Session->CancelRequest(AttemptRequest);
+			}
+			else
+			{
+				AttemptRequest->CancelRequest();
+			}
+		});
+}
+
+void FGLCHttpSession::CancelRequest(const FRequestRef& Request)
+{
+	FString Host = FPlatformHttp::GetUrlDomain(Request->GetURL());
+	bool bWasPending = false;
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FHostState* HostState = Hosts.Find(Host))
+		{
+			bWasPending = HostState->Pending.RemoveAll([&Request](const FPendingRequest& Pending)
+			{
+				return Pending.Request == Request;
+			}) > 0;
+		}
+	}
+
+	if (!bWasPending)
+	{
+		Request->CancelRequest();
+		return;
+	}
+
+	// Never sent, so the HTTP layer would not complete it; the caller's delegate is still the one bound
+	UE_LOG(LogTemp, Verbose, TEXT("[GLC] %s %s: cancelled while queued"), *Request->GetVerb(), *Request->GetURL());
+	FHttpRequestCompleteDelegate Completion = Request->OnProcessRequestComplete();
+	Request->OnProcessRequestComplete().Unbind();
+	Completion.ExecuteIfBound(Request, nullptr, false);
+}
+
+void FGLCHttpSession::AddIdempotencyKey(const FRequestRef& Request)
+{
+	Request->SetHeader(TEXT("Idempotency-Key"), FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower));
+}
+
+void FGLCHttpSession::Send(const FRequestRef& Request, const FString& Host, double QueuedAt)
+{
+	// The token may have been refreshed while the request waited in the queue or between retries
+	if (Request->GetURL().StartsWith(BaseUrl + TEXT("/")))
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FString* Authorization = DefaultHeaders.Find(TEXT("Authorization")))
+		{
+			Request->SetHeader(TEXT("Authorization"), *Authorization);
+		}
+	}
+
+	uint64 SentCycles = FPlatformTime::Cycles64();
+	double QueueTime = FPlatformTime::Seconds() - QueuedAt;
+
+	TSharedRef<GLCHttpSession::FRequestClock, ESPMode::ThreadSafe> Clock = MakeShared<GLCHttpSession::FRequestClock, ESPMode::ThreadSafe>();
+	Request->OnHeaderReceived().BindLambda([Clock](FHttpRequestPtr, const FString&, const FString&)
+	{
+		uint64 Expected = 0;
+		Clock->FirstByteCycles.CompareExchange(Expected, FPlatformTime::Cycles64());
+	});
+
+	// Wrap the caller's completion to record the timing and free the slot first
+	FHttpRequestCompleteDelegate Completion = Request->OnProcessRequestComplete();
+	TWeakPtr<FGLCHttpSession, ESPMode::ThreadSafe> WeakSession = AsShared();
+
+	Request->OnProcessRequestComplete().BindLambda([WeakSession, Completion, Host, SentCycles, QueueTime, Clock](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		uint64 CompletedCycles = FPlatformTime::Cycles64();
+		uint64 FirstByteCycles = Clock->FirstByteCycles.Load();
+
+		FGLCHttpTiming Timing;
+		Timing.QueueTime = QueueTime;
+		Timing.TotalTime = FPlatformTime::ToSeconds64(CompletedCycles - SentCycles);
+		Timing.TimeToFirstByte = FirstByteCycles != 0 ? FPlatformTime::ToSeconds64(FirstByteCycles - SentCycles) : Timing.TotalTime;
+		Timing.ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[GLC] %s %s: %d, queued %.3fs, first byte %.3fs, total %.3fs"),
+			*CompletedRequest->GetVerb(), *CompletedRequest->GetURL(), Timing.ResponseCode, Timing.QueueTime, Timing.TimeToFirstByte, Timing.TotalTime);
+
+		if (TSharedPtr<FGLCHttpSession, ESPMode::ThreadSafe> Session = WeakSession.Pin())
+		{
+			Session->OnRequestFinished(Host, Timing);
+		}
+
+		Completion.ExecuteIfBound(CompletedRequest, Response, bSucceeded);
+	});
+
+	Request->ProcessRequest();
+}
+
+void FGLCHttpSession::OnRequestFinished(const FString& Host, const FGLCHttpTiming& Timing)
+{
+	TOptional<FPendingRequest> Next;
+
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		LastTiming = Timing;
+		TotalTiming.QueueTime += Timing.QueueTime;
+		TotalTiming.TimeToFirstByte += Timing.TimeToFirstByte;
+		TotalTiming.TotalTime += Timing.TotalTime;
+		CompletedRequests++;
+
+		// The freed slot goes straight to the next waiting request, keeping the connection busy
+		FHostState& HostState = Hosts.FindOrAdd(Host);
+		if (HostState.Pending.Num() > 0)
+		{
+			Next = HostState.Pending[0];
+			HostState.Pending.RemoveAt(0);
+		}
+		else
+		{
+			HostState.ActiveRequests = FMath::Max(0, HostState.ActiveRequests - 1);
+		}
+	}
+
+	if (Next.IsSet())
+	{
+		Send(Next->Request, Host, Next->QueuedAt);
+	}
+}
+
+FGLCHttpTiming FGLCHttpSession::GetLastTiming() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return LastTiming;
+}
+
+FGLCHttpTiming FGLCHttpSession::GetAverageTiming() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FGLCHttpTiming Average;
+	if (CompletedRequests > 0)
+	{
+		Average.QueueTime = TotalTiming.QueueTime / CompletedRequests;
+		Average.TimeToFirstByte = TotalTiming.TimeToFirstByte / CompletedRequests;
+		Average.TotalTime = TotalTiming.TotalTime / CompletedRequests;
+	}
+	return Average;
+}
+
+int32 FGLCHttpSession::GetCompletedRequestCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return CompletedRequests;
+}
@@ -0,0 +1,671 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCJobScheduler.h"
+#include "GLCApiClient.h"
+#include "GLCBuildScanner.h"
+#include "GLCBuildStatusMonitor.h"
+#include "GLCJobs.h"
+#include "GLCSettings.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace GLCJobScheduler
+{
+	static const TCHAR* PriorityNames[] = { TEXT("low"), TEXT("normal"), TEXT("high") };
+	static const TCHAR* StateNames[] = { TEXT("pending"), TEXT("running"), TEXT("succeeded"), TEXT("failed"), TEXT("cancelled"), TEXT("paused") };
+
+	template <typename EnumType, int32 Num>
+	static bool ParseName(const TCHAR* (&Names)[Num], const FString& Name, EnumType& OutValue)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			if (Name == Names[Index])
+			{
+				OutValue = (EnumType)Index;
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+// ========== JOB ========== //
+
+FGLCJob::FGLCJob(EGLCJobType InType)
+	: Params(MakeShared<FJsonObject>())
+	, Output(MakeShared<FJsonObject>())
+	, Id(0)
+	, Type(InType)
+	, Priority(EGLCJobPriority::Normal)
+	, State(EGLCJobState::Pending)
+	, Progress(0.0f)
+	, Scheduler(nullptr)
+	, bCancelRequested(false)
+{
+}
+
+FString FGLCJob::GetTypeName(EGLCJobType InType)
+{
+	switch (InType)
+	{
+	case EGLCJobType::Build: return TEXT("Build");
+	case EGLCJobType::Compress: return TEXT("Compress");
+	case EGLCJobType::Upload: return TEXT("Upload");
+	case EGLCJobType::Monitor: return TEXT("Monitor");
+	}
+	return FString();
+}
+
+FString FGLCJob::GetStateName(EGLCJobState InState)
+{
+	switch (InState)
+	{
+	case EGLCJobState::Pending: return TEXT("Queued");
+	case EGLCJobState::Running: return TEXT("Running");
+	case EGLCJobState::Succeeded: return TEXT("Succeeded");
+	case EGLCJobState::Failed: return TEXT("Failed");
+	case EGLCJobState::Cancelled: return TEXT("Cancelled");
+	case EGLCJobState::Paused: return TEXT("Paused");
+	}
+	return FString();
+}
+
+FGLCJobPtr FGLCJob::Create(EGLCJobType InType)
+{
+	switch (InType)
+	{
+	case EGLCJobType::Build: return MakeShared<FGLCBuildJob, ESPMode::ThreadSafe>();
+	case EGLCJobType::Compress: return MakeShared<FGLCCompressJob, ESPMode::ThreadSafe>();
+	case EGLCJobType::Upload: return MakeShared<FGLCUploadJob, ESPMode::ThreadSafe>();
+	case EGLCJobType::Monitor: return MakeShared<FGLCMonitorJob, ESPMode::ThreadSafe>();
+	}
+	return nullptr;
+}
+
+void FGLCJob::ReportProgress(float InProgress, const FString& InMessage)
+{
+	ProgressChannel.SetStage(InMessage);
+	ProgressChannel.Update(InProgress);
+}
+
+void FGLCJob::ReportBytes(float InProgress, const FString& InStage, int64 BytesDone, int64 BytesTotal)
+{
+	ProgressChannel.SetStage(InStage);
+	ProgressChannel.UpdateBytes(InProgress, BytesDone, BytesTotal);
+}
+
+void FGLCJob::Finish(EGLCJobState FinalState, const FString& InMessage, TSharedPtr<FJsonObject> InOutput)
+{
+	TWeakPtr<FGLCJob, ESPMode::ThreadSafe> WeakJob = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [WeakJob, FinalState, InMessage, InOutput]()
+	{
+		FGLCJobPtr Job = WeakJob.Pin();
+		if (Job.IsValid() && Job->Scheduler)
+		{
+			if (InOutput.IsValid() && Job->State == EGLCJobState::Running)
+			{
+				Job->Output->Values.Append(InOutput->Values);
+			}
+			Job->Scheduler->OnJobFinished(Job, FinalState, InMessage);
+		}
+	});
+}
+
+// ========== SCHEDULER ========== //
+
+FGLCJobScheduler::FGLCJobScheduler()
+	: NextJobId(1)
+	, bPersistent(false)
+	, bShuttingDown(false)
+{
+	// Compression and the API client's upload slot are exclusive; monitors share one poll. Initialize
+	// raises the Build limit to what the machine can cook side by side
+	MaxConcurrentJobs.Add(EGLCJobType::Build, 1);
+	MaxConcurrentJobs.Add(EGLCJobType::Compress, 1);
+	MaxConcurrentJobs.Add(EGLCJobType::Upload, 1);
+	MaxConcurrentJobs.Add(EGLCJobType::Monitor, 32);
+}
+
+FGLCJobScheduler::~FGLCJobScheduler()
+{
+	Shutdown();
+}
+
+FString FGLCJobScheduler::GetQueuePath()
+{
+	return FPaths::ProjectIntermediateDir() / TEXT("GameLauncherCloud/jobs.json");
+}
+
+void FGLCJobScheduler::Initialize(bool bInPersistent, TSharedPtr<FGLCApiClient> InApiClient)
+{
+	FGLCSettings Settings = FGLCSettings::Load();
+	SetMaxConcurrentJobs(EGLCJobType::Build, Settings.MaxConcurrentBuilds > 0 ? Settings.MaxConcurrentBuilds : FGLCBuildJob::GetDefaultMaxConcurrentBuilds());
+
+	ApiClient = InApiClient;
+	if (!ApiClient.IsValid())
+	{
+		ApiClient = MakeShareable(new FGLCApiClient(Settings.ApiUrl, Settings.AuthToken));
+		ApiClient->SetSendPartChecksums(Settings.bSendPartChecksumHeader);
+		ApiClient->SetRetryPolicy(Settings.GetRetryPolicy());
+	}
+	BuildScanner = MakeShared<FGLCBuildScanner, ESPMode::ThreadSafe>();
+	StatusMonitor = MakeShared<FGLCBuildStatusMonitor, ESPMode::ThreadSafe>(ApiClient);
+
+	bPersistent = bInPersistent;
+	if (bPersistent && Load())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Restored %d jobs from %s"), Jobs.Num(), *GetQueuePath());
+	}
+
+	// Modules are still loading; start restored jobs once the editor ticks
+	StartTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+	{
+		StartTickerHandle.Reset();
+		Schedule();
+		return false;
+	}));
+
+	// Jobs report progress as often as they like; the UI hears about it at a fixed rate
+	ProgressTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGLCJobScheduler::OnSampleProgress), 1.0f / ProgressSampleRate);
+}
+
+void FGLCJobScheduler::Shutdown()
+{
+	if (bShuttingDown)
+	{
+		return;
+	}
+	bShuttingDown = true;
+
+	if (StartTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StartTickerHandle);
+		StartTickerHandle.Reset();
+	}
+
+	if (ProgressTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressTickerHandle);
+		ProgressTickerHandle.Reset();
+	}
+
+	// Saved before suspending: running jobs are restored as pending or paused
+	Save();
+
+	for (const FGLCJobPtr& Job : Jobs)
+	{
+		if (Job->State == EGLCJobState::Running)
+		{
+			Job->bCancelRequested = true;
+			Job->Suspend();
+		}
+		Job->Scheduler = nullptr;
+	}
+
+	if (BuildScanner.IsValid())
+	{
+		BuildScanner->Cancel();
+	}
+}
+
+int64 FGLCJobScheduler::Submit(const FGLCJobPtr& Job, const TArray<int64>& Dependencies, EGLCJobPriority Priority)
+{
+	check(IsInGameThread());
+	check(Job.IsValid() && Job->Scheduler == nullptr);
+
+	Job->Id = NextJobId++;
+	Job->Priority = Priority;
+	Job->Dependencies = Dependencies;
+	Job->State = EGLCJobState::Pending;
+	Job->Message = TEXT("Queued");
+	Job->Scheduler = this;
+	Jobs.Add(Job);
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Queued job #%lld: %s"), Job->Id, *Job->GetDisplayName());
+
+	Save();
+	JobChangedEvent.Broadcast(Job);
+	Schedule();
+
+	return Job->Id;
+}
+
+void FGLCJobScheduler::Cancel(int64 JobId)
+{
+	check(IsInGameThread());
+
+	// The job and everything downstream of it
+	TSet<int64> Cancelled;
+	Cancelled.Add(JobId);
+	bool bAdded = true;
+	while (bAdded)
+	{
+		bAdded = false;
+		for (const FGLCJobPtr& Job : Jobs)
+		{
+			if (!Cancelled.Contains(Job->Id) && Job->Dependencies.ContainsByPredicate([&Cancelled](int64 Dependency) { return Cancelled.Contains(Dependency); }))
+			{
+				Cancelled.Add(Job->Id);
+				bAdded = true;
+			}
+		}
+	}
+
+	for (const FGLCJobPtr& Job : Jobs)
+	{
+		if (!Cancelled.Contains(Job->Id) || Job->IsDone())
+		{
+			continue;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling job #%lld: %s"), Job->Id, *Job->GetDisplayName());
+
+		if (Job->State == EGLCJobState::Pending || Job->State == EGLCJobState::Paused)
+		{
+			SetJobState(Job, EGLCJobState::Cancelled, TEXT("Cancelled"));
+		}
+		else if (!Job->bCancelRequested)
+		{
+			// Running jobs report back through Finish once they stopped
+			Job->bCancelRequested = true;
+			Job->ReportProgress(Job->Progress, TEXT("Cancelling..."));
+			Job->Cancel();
+		}
+	}
+
+	Save();
+	Schedule();
+}
+
+void FGLCJobScheduler::Resume(int64 JobId)
+{
+	check(IsInGameThread());
+
+	FGLCJobPtr Job = FindJob(JobId);
+	if (!Job.IsValid() || Job->State != EGLCJobState::Paused)
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Resuming job #%lld: %s"), Job->Id, *Job->GetDisplayName());
+
+	SetJobState(Job, EGLCJobState::Pending, TEXT("Queued"));
+	Schedule();
+}
+
+void FGLCJobScheduler::SetPriority(int64 JobId, EGLCJobPriority Priority)
+{
+	FGLCJobPtr Job = FindJob(JobId);
+	if (Job.IsValid() && Job->State == EGLCJobState::Pending && Job->Priority != Priority)
+	{
+		Job->Priority = Priority;
+		Save();
+		JobChangedEvent.Broadcast(Job);
+	}
+}
+
+void FGLCJobScheduler::SetMaxConcurrentJobs(EGLCJobType Type, int32 MaxJobs)
+{
+	MaxConcurrentJobs.Add(Type, FMath::Max(MaxJobs, 1));
+	Schedule();
+}
+
+void FGLCJobScheduler::ClearFinishedJobs()
+{
+	const int32 Removed = Jobs.RemoveAll([this](const FGLCJobPtr& Job)
+	{
+		// Pending jobs still need the outputs of their dependencies
+		return Job->IsDone() && !Jobs.ContainsByPredicate([&Job](const FGLCJobPtr& Other) { return !Other->IsDone() && Other->Dependencies.Contains(Job->Id); });
+	});
+
+	if (Removed > 0)
+	{
+		Save();
+		JobChangedEvent.Broadcast(nullptr);
+	}
+}
+
+FGLCJobPtr FGLCJobScheduler::FindJob(int64 JobId) const
+{
+	const FGLCJobPtr* Job = Jobs.FindByPredicate([JobId](const FGLCJobPtr& Candidate) { return Candidate->Id == JobId; });
+	return Job ? *Job : nullptr;
+}
+
+FGLCJobPtr FGLCJobScheduler::FindLatestJob(EGLCJobType Type) const
+{
+	for (int32 Index = Jobs.Num() - 1; Index >= 0; --Index)
+	{
+		if (Jobs[Index]->Type == Type)
+		{
+			return Jobs[Index];
+		}
+	}
+	return nullptr;
+}
+
+bool FGLCJobScheduler::HasActiveJobs(EGLCJobType Type) const
+{
+	return Jobs.ContainsByPredicate([Type](const FGLCJobPtr& Job) { return Job->Type == Type && !Job->IsDone(); });
+}
+
+// ========== SCHEDULING ========== //
+
+void FGLCJobScheduler::Schedule()
+{
+	if (bShuttingDown || StartTickerHandle.IsValid())
+	{
+		return;
+	}
+
+	// A job whose dependency did not succeed can never run
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+		for (const FGLCJobPtr& Job : Jobs)
+		{
+			if (Job->State != EGLCJobState::Pending)
+			{
+				continue;
+			}
+
+			for (int64 DependencyId : Job->Dependencies)
+			{
+				FGLCJobPtr Dependency = FindJob(DependencyId);
+				if (!Dependency.IsValid() || Dependency->State == EGLCJobState::Failed || Dependency->State == EGLCJobState::Cancelled)
+				{
+					SetJobState(Job, EGLCJobState::Cancelled, Dependency.IsValid()
+						? FString::Printf(TEXT("Skipped: %s did not succeed"), *Dependency->GetDisplayName())
+						: TEXT("Skipped: a previous job is missing"));
+					bChanged = true;
+					break;
+				}
+			}
+		}
+	}
+
+	TMap<EGLCJobType, int32> RunningJobs;
+	TSet<FString> BusyResources;
+	TArray<FGLCJobPtr> ReadyJobs;
+	for (const FGLCJobPtr& Job : Jobs)
+	{
+		if (Job->State == EGLCJobState::Running)
+		{
+			RunningJobs.FindOrAdd(Job->Type)++;
+			BusyResources.Add(Job->GetExclusiveResource());
+		}
+		else if (Job->State == EGLCJobState::Pending && !Job->Dependencies.ContainsByPredicate([this](int64 DependencyId)
+			{
+				FGLCJobPtr Dependency = FindJob(DependencyId);
+				return !Dependency.IsValid() || Dependency->State != EGLCJobState::Succeeded;
+			}))
+		{
+			ReadyJobs.Add(Job);
+		}
+	}
+
+	// Highest priority first, then first come first served
+	ReadyJobs.StableSort([](const FGLCJobPtr& A, const FGLCJobPtr& B)
+	{
+		return A->Priority != B->Priority ? A->Priority > B->Priority : A->Id < B->Id;
+	});
+
+	for (const FGLCJobPtr& Job : ReadyJobs)
+	{
+		int32& Running = RunningJobs.FindOrAdd(Job->Type);
+		const FString Resource = Job->GetExclusiveResource();
+		if (Running < MaxConcurrentJobs.FindRef(Job->Type) && (Resource.IsEmpty() || !BusyResources.Contains(Resource)))
+		{
+			++Running;
+			BusyResources.Add(Resource);
+			StartJob(Job);
+		}
+	}
+}
+
+void FGLCJobScheduler::StartJob(const FGLCJobPtr& Job)
+{
+	// Results of earlier steps (archive path, build id...) become inputs of this one
+	for (int64 DependencyId : Job->Dependencies)
+	{
+		if (FGLCJobPtr Dependency = FindJob(DependencyId))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Dependency->Output->Values)
+			{
+				Job->Params->SetField(Field.Key, Field.Value);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Starting job #%lld: %s"), Job->Id, *Job->GetDisplayName());
+
+	Job->bCancelRequested = false;
+	Job->Progress = 0.0f;
+	Job->ProgressChannel.Reset();
+	Job->LastSample = FGLCProgressChannel::FSample();
+	Job->Output->Values.Empty();
+	SetJobState(Job, EGLCJobState::Running, TEXT("Starting..."));
+	Job->Start();
+}
+
+void FGLCJobScheduler::SetJobState(const FGLCJobPtr& Job, EGLCJobState State, const FString& Message)
+{
+	Job->State = State;
+	Job->Message = Message;
+	if (State == EGLCJobState::Succeeded)
+	{
+		Job->Progress = 1.0f;
+	}
+
+	Save();
+	JobChangedEvent.Broadcast(Job);
+}
+
+bool FGLCJobScheduler::OnSampleProgress(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	for (const FGLCJobPtr& Job : Jobs)
+	{
+		// Sampled even when nothing changed, so throughput and time left follow a stalled transfer
+		FGLCProgressChannel::FSample Sample;
+		if (Job->State == EGLCJobState::Running && Job->ProgressChannel.Sample(Now, Sample))
+		{
+			// Not saved: progress is recomputed when a job restarts
+			Job->Progress = Sample.Progress;
+			Job->Message = FGLCProgressChannel::FormatMessage(Sample);
+			Job->LastSample = MoveTemp(Sample);
+			JobChangedEvent.Broadcast(Job);
+		}
+	}
+	return true;
+}
+
+void FGLCJobScheduler::OnJobFinished(const FGLCJobPtr& Job, EGLCJobState State, const FString& Message)
+{
+	if (Job->State != EGLCJobState::Running)
+	{
+		return;
+	}
+
+	// A job that stops after being cancelled counts as cancelled, whatever it reports
+	if (Job->bCancelRequested && State != EGLCJobState::Succeeded)
+	{
+		State = EGLCJobState::Cancelled;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Job #%lld %s: %s"), Job->Id, *GetStateName(State).ToLower(), *Message);
+
+	SetJobState(Job, State, Message);
+	TrimFinishedJobs();
+	Schedule();
+}
+
+void FGLCJobScheduler::TrimFinishedJobs()
+{
+	int32 FinishedCount = Jobs.FilterByPredicate([](const FGLCJobPtr& Job) { return Job->IsDone(); }).Num();
+	for (int32 Index = 0; Index < Jobs.Num() && FinishedCount > MaxFinishedJobs; )
+	{
+		const FGLCJobPtr& Job = Jobs[Index];
+		const bool bNeeded = Jobs.ContainsByPredicate([&Job](const FGLCJobPtr& Other) { return !Other->IsDone() && Other->Dependencies.Contains(Job->Id); });
+		if (Job->IsDone() && !bNeeded)
+		{
+			Jobs.RemoveAt(Index);
+			--FinishedCount;
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
+
+// ========== PERSISTENCE ========== //
+
+bool FGLCJobScheduler::Load()
+{
+	using namespace GLCJobScheduler;
+
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetQueuePath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Ignoring unreadable job queue %s"), *GetQueuePath());
+		return false;
+	}
+
+	JsonObject->TryGetNumberField(TEXT("nextId"), NextJobId);
+
+	const TArray<TSharedPtr<FJsonValue>>* JobValues = nullptr;
+	if (!JsonObject->TryGetArrayField(TEXT("jobs"), JobValues))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& JobValue : *JobValues)
+	{
+		const TSharedPtr<FJsonObject>* JobObject = nullptr;
+		if (!JobValue->TryGetObject(JobObject))
+		{
+			continue;
+		}
+
+		FString TypeName;
+		(*JobObject)->TryGetStringField(TEXT("type"), TypeName);
+		FGLCJobPtr Job;
+		for (EGLCJobType Type : { EGLCJobType::Build, EGLCJobType::Compress, EGLCJobType::Upload, EGLCJobType::Monitor })
+		{
+			if (TypeName == GetTypeName(Type))
+			{
+				Job = FGLCJob::Create(Type);
+			}
+		}
+		if (!Job.IsValid())
+		{
+			continue;
+		}
+
+		FString PriorityName;
+		FString StateName;
+		(*JobObject)->TryGetNumberField(TEXT("id"), Job->Id);
+		(*JobObject)->TryGetStringField(TEXT("priority"), PriorityName);
+		(*JobObject)->TryGetStringField(TEXT("state"), StateName);
+		(*JobObject)->TryGetStringField(TEXT("message"), Job->Message);
+		ParseName(PriorityNames, PriorityName, Job->Priority);
+		ParseName(StateNames, StateName, Job->State);
+
+		const TArray<TSharedPtr<FJsonValue>>* DependencyValues = nullptr;
+		if ((*JobObject)->TryGetArrayField(TEXT("dependencies"), DependencyValues))
+		{
+			for (const TSharedPtr<FJsonValue>& DependencyValue : *DependencyValues)
+			{
+				Job->Dependencies.Add((int64)DependencyValue->AsNumber());
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+		if ((*JobObject)->TryGetObjectField(TEXT("params"), ParamsObject))
+		{
+			Job->Params = ParamsObject->ToSharedRef();
+		}
+
+		const TSharedPtr<FJsonObject>* OutputObject = nullptr;
+		if ((*JobObject)->TryGetObjectField(TEXT("output"), OutputObject))
+		{
+			Job->Output = OutputObject->ToSharedRef();
+		}
+
+		// Interrupted by the editor closing. Uploads resume from their journal and monitors just poll again;
+		// a build or compression would start over, which takes long enough to leave to the user
+		if (Job->State == EGLCJobState::Running)
+		{
+			if (Job->Type == EGLCJobType::Build || Job->Type == EGLCJobType::Compress)
+			{
+				Job->State = EGLCJobState::Paused;
+				Job->Message = TEXT("Interrupted when the editor closed, resume to start over");
+			}
+			else
+			{
+				Job->State = EGLCJobState::Pending;
+				Job->Message = TEXT("Interrupted, waiting to restart");
+			}
+		}
+		Job->Progress = Job->State == EGLCJobState::Succeeded ? 1.0f : 0.0f;
+
+		Job->Scheduler = this;
+		NextJobId = FMath::Max(NextJobId, Job->Id + 1);
+		Jobs.Add(Job);
+	}
+
+	return true;
+}
+
+void FGLCJobScheduler::Save() const
+{
+	using namespace GLCJobScheduler;
+
+	if (!bPersistent)
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> JobValues;
+	for (const FGLCJobPtr& Job : Jobs)
+	{
+		TSharedPtr<FJsonObject> JobObject = MakeShareable(new FJsonObject);
+		JobObject->SetNumberField(TEXT("id"), Job->Id);
+		JobObject->SetStringField(TEXT("type"), FGLCJob::GetTypeName(Job->Type));
+		JobObject->SetStringField(TEXT("priority"), PriorityNames[(int32)Job->Priority]);
+		JobObject->SetStringField(TEXT("state"), StateNames[(int32)Job->State]);
+		JobObject->SetStringField(TEXT("message"), Job->Message);
+
+		TArray<TSharedPtr<FJsonValue>> DependencyValues;
+		for (int64 DependencyId : Job->Dependencies)
+		{
+			DependencyValues.Add(MakeShareable(new FJsonValueNumber(DependencyId)));
+		}
+		JobObject->SetArrayField(TEXT("dependencies"), DependencyValues);
+		JobObject->SetObjectField(TEXT("params"), Job->Params);
+		JobObject->SetObjectField(TEXT("output"), Job->Output);
+
+		JobValues.Add(MakeShareable(new FJsonValueObject(JobObject)));
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetNumberField(TEXT("nextId"), NextJobId);
+	JsonObject->SetArrayField(TEXT("jobs"), JobValues);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+	FFileHelper::SaveStringToFile(OutputString, *GetQueuePath());
+}
@@ -0,0 +1,1026 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCJobs.h"
+#include "GLCBuildStatusMonitor.h"
+#include "GLCBuildManifest.h"
+#include "GLCBuildScanner.h"
+#include "GLCUatRunner.h"
+#include "GLCUploadJournal.h"
+#include "GLCZipWriter.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+
+// ========== BUILD ========== //
+
+FGLCBuildJob::FGLCBuildJob()
+	: FGLCJob(EGLCJobType::Build)
+{
+}
+
+FGLCBuildJob::FGLCBuildJob(const FGLCBuildProfile& Profile, const FString& Platform, const FString& ArchiveDirectory)
+	: FGLCJob(EGLCJobType::Build)
+{
+	Params->SetStringField(TEXT("mode"), Profile.IsFastIteration() ? TEXT("fastIteration") : TEXT("full"));
+	Params->SetStringField(TEXT("configuration"), Profile.Configuration);
+	Params->SetStringField(TEXT("platform"), Platform.IsEmpty() ? GetHostPlatform() : Platform);
+	if (!ArchiveDirectory.IsEmpty())
+	{
+		Params->SetStringField(TEXT("archiveDirectory"), ArchiveDirectory);
+	}
+}
+
+FString FGLCBuildJob::GetDisplayName() const
+{
+	return FString::Printf(TEXT("Build %s %s"), *Params->GetStringField(TEXT("platform")), *Params->GetStringField(TEXT("configuration")));
+}
+
+FString FGLCBuildJob::GetExclusiveResource() const
+{
+	FString Platform = GetHostPlatform();
+	Params->TryGetStringField(TEXT("platform"), Platform);
+	return TEXT("Cook:") + Platform;
+}
+
+int32 FGLCBuildJob::GetDefaultMaxConcurrentBuilds()
+{
+	// A cook saturates about 8 logical cores and needs around 16 GB; running more only thrashes
+	int32 ByCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 8;
+	int32 ByMemory = (int32)(FPlatformMemory::GetConstants().TotalPhysicalGB / 16);
+	return FMath::Clamp(FMath::Min(ByCores, ByMemory), 1, 4);
+}
+
+FString FGLCBuildJob::GetHostPlatform()
+{
+#if PLATFORM_MAC
+	return TEXT("Mac");
+#elif PLATFORM_LINUX
+	return TEXT("Linux");
+#else
+	return TEXT("Win64");
+#endif
+}
+
+FString FGLCBuildJob::GetArchiveDirectory()
+{
+	return FPaths::ProjectDir() / TEXT("Builds/GLC_Upload");
+}
+
+FString FGLCBuildJob::GetArchivePlatformFolder(const FString& Platform)
+{
+	return Platform == TEXT("Win64") ? TEXT("Windows") : Platform;
+}
+
+FString FGLCBuildJob::GetBuildOutputPath(const FString& ArchiveDirectory, const FString& Platform)
+{
+	// Builds of other platforms share the archive directory; only this platform's folder is its build
+	FString PlatformPath = ArchiveDirectory / GetArchivePlatformFolder(Platform);
+	return FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*PlatformPath) ? PlatformPath : ArchiveDirectory;
+}
+
+void FGLCBuildJob::Start()
+{
+	FGLCBuildProfile Profile;
+	Profile.Mode = Params->GetStringField(TEXT("mode")) == TEXT("fastIteration") ? EGLCBuildMode::FastIteration : EGLCBuildMode::Full;
+	Params->TryGetStringField(TEXT("configuration"), Profile.Configuration);
+
+	FString Platform = GetHostPlatform();
+	Params->TryGetStringField(TEXT("platform"), Platform);
+
+	FString ArchiveDirectory = GetArchiveDirectory();
+	Params->TryGetStringField(TEXT("archiveDirectory"), ArchiveDirectory);
+
+	FString UATPath = FPaths::EngineDir() / TEXT("Build/BatchFiles/RunUAT.bat");
+#if PLATFORM_MAC || PLATFORM_LINUX
+	UATPath = FPaths::EngineDir() / TEXT("Build/BatchFiles/RunUAT.sh");
+#endif
+
+	TSharedRef<FGLCBuildJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCBuildJob>(AsShared());
+	const FString ProjectFile = FPaths::GetProjectFilePath();
+
+	// UAT blocks for minutes; keep it off the task graph
+	Async(EAsyncExecution::Thread, [This, Profile, Platform, ArchiveDirectory, UATPath, ProjectFile]()
+	{
+		This->ReportProgress(0.05f, TEXT("Checking for changes since the last build..."));
+
+		// Fingerprint the project inputs to find out how much of the previous build can be reused
+		FGLCBuildStamp CurrentStamp;
+		FGLCBuildStamp LastStamp;
+		bool bHasStamp = FGLCBuildStamp::Compute(Profile.GetKey(Platform), CurrentStamp, This->GetCancelFlag());
+		bool bHasPreviousBuild = bHasStamp && FGLCBuildStamp::LoadLast(Platform, Profile.Configuration, ArchiveDirectory, LastStamp) && GetBuildOutputPath(ArchiveDirectory, Platform) != ArchiveDirectory;
+		bool bUpToDate = Profile.IsFastIteration() && bHasPreviousBuild && LastStamp.IsUpToDate(CurrentStamp);
+
+		if (This->IsCancelRequested())
+		{
+			This->Finish(EGLCJobState::Cancelled, TEXT("Build cancelled"));
+			return;
+		}
+
+		if (bUpToDate)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[GLC] No code or content changes since the last %s build, skipping UAT"), *Profile.Configuration);
+			TSharedPtr<FJsonObject> BuildOutput = MakeShareable(new FJsonObject);
+			BuildOutput->SetStringField(TEXT("buildPath"), GetBuildOutputPath(ArchiveDirectory, Platform));
+			This->Finish(EGLCJobState::Succeeded, TEXT("Build is up to date, nothing changed since the last build"), BuildOutput);
+			return;
+		}
+
+		bool bCompile = !(Profile.IsFastIteration() && bHasPreviousBuild && LastStamp.HasSameCode(CurrentStamp));
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Building with profile %s / %s%s"), *FGLCBuildProfile::GetModeDisplayName(Profile.Mode), *Profile.Configuration, bCompile ? TEXT("") : TEXT(", no code changes: skipping compile"));
+
+		This->ReportProgress(0.1f, TEXT("Building project... This may take several minutes."));
+
+		// The output is about to change; a failed build must never be reported as up to date
+		FGLCBuildStamp::DeleteForArchive(ArchiveDirectory);
+
+		// Execute UAT, streaming its output to a log file and the current stage to the job; builds of other platforms may run meanwhile
+		const FString LogPath = FPaths::GetPath(FGLCUatRunner::GetDefaultLogPath()) / FString::Printf(TEXT("UAT_%s_%s.log"), *Platform, *Profile.Configuration);
+		FGLCUatRunner Runner(UATPath, Profile.MakeArguments(ProjectFile, Platform, ArchiveDirectory, bCompile), LogPath);
+		int32 ReturnCode = Runner.Run([This](EGLCUatStage Stage, float Progress)
+		{
+			This->ReportProgress(0.1f + Progress * 0.9f, FString::Printf(TEXT("Building project: %s (%d%%)..."), *FGLCUatRunner::GetStageDisplayName(Stage), FMath::RoundToInt(Progress * 100.0f)));
+		}, This->GetCancelFlag());
+
+		if (ReturnCode != 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Build failed with code %d, last errors:"), ReturnCode);
+			for (const FString& ErrorLine : Runner.GetErrorLines())
+			{
+				UE_LOG(LogTemp, Error, TEXT("[GLC]   %s"), *ErrorLine);
+			}
+
+			This->Finish(EGLCJobState::Failed, FString::Printf(TEXT("Build failed with code %d. Full log: %s"), ReturnCode, *Runner.GetLogPath()));
+			return;
+		}
+
+		if (bHasStamp)
+		{
+			CurrentStamp.SaveAsLast(Platform, Profile.Configuration, ArchiveDirectory);
+		}
+
+		TSharedPtr<FJsonObject> BuildOutput = MakeShareable(new FJsonObject);
+		BuildOutput->SetStringField(TEXT("buildPath"), GetBuildOutputPath(ArchiveDirectory, Platform));
+		This->Finish(EGLCJobState::Succeeded, TEXT("Build completed successfully!"), BuildOutput);
+	});
+}
+
+// ========== COMPRESS ========== //
+
+FGLCCompressJob::FGLCCompressJob()
+	: FGLCJob(EGLCJobType::Compress)
+{
+}
+
+FGLCCompressJob::FGLCCompressJob(const FString& BuildPath, const FString& ZipPath)
+	: FGLCJob(EGLCJobType::Compress)
+{
+	// A preceding build job provides the build path once it finished
+	if (!BuildPath.IsEmpty())
+	{
+		Params->SetStringField(TEXT("buildPath"), BuildPath);
+	}
+	Params->SetStringField(TEXT("zipPath"), ZipPath);
+}
+
+FString FGLCCompressJob::GetDisplayName() const
+{
+	return FString::Printf(TEXT("Compress %s"), *FPaths::GetCleanFilename(Params->GetStringField(TEXT("zipPath"))));
+}
+
+FString FGLCCompressJob::GetDefaultZipPath()
+{
+	return FPaths::ProjectDir() / TEXT("Builds") / FString::Printf(TEXT("%s_upload.zip"), FApp::GetProjectName());
+}
+
+void FGLCCompressJob::Start()
+{
+	const FString SourcePath = Params->GetStringField(TEXT("buildPath"));
+	const FString ZipPath = Params->GetStringField(TEXT("zipPath"));
+	const FGLCCompressionPolicy Policy = FGLCSettings::Load().Compression;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Compressing %s to %s"), *SourcePath, *ZipPath);
+
+	if (!FPaths::DirectoryExists(SourcePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Source directory does not exist: %s"), *SourcePath);
+		Finish(EGLCJobState::Failed, TEXT("❌ Compression failed: build not found"));
+		return;
+	}
+
+	TSharedRef<FGLCCompressJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCCompressJob>(AsShared());
+	Async(EAsyncExecution::ThreadPool, [This, SourcePath, ZipPath, Policy]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Progress is reported in uncompressed bytes, straight into the progress channel
+		FGLCZipWriter::FProgressCallback ProgressCallback = [This](int64 BytesProcessed, int64 TotalBytes)
+		{
+			float Progress = TotalBytes > 0 ? (float)((double)BytesProcessed / (double)TotalBytes) : 1.0f;
+			This->ReportBytes(Progress, TEXT("Compressing"), BytesProcessed, TotalBytes);
+		};
+
+		FGLCZipWriter ZipWriter(Policy);
+		if (!ZipWriter.WriteDirectoryToFile(SourcePath, ZipPath, ProgressCallback, This->GetCancelFlag()))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Compression failed: %s"), *ZipWriter.GetLastError());
+			This->Finish(EGLCJobState::Failed, TEXT("❌ Compression failed. Check the Output Log for details."));
+			return;
+		}
+
+		int64 ZipSize = FPlatformFileManager::Get().GetPlatformFile().FileSize(*ZipPath);
+		if (ZipSize <= 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] ZIP file was created but is empty or invalid"));
+			This->Finish(EGLCJobState::Failed, TEXT("❌ Compression failed. Check the Output Log for details."));
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Compression successful! ZIP size: %lld bytes (%.2f MB) in %.1f s"), ZipSize, ZipSize / (1024.0 * 1024.0), FPlatformTime::Seconds() - StartTime);
+
+		TSharedPtr<FJsonObject> CompressOutput = MakeShareable(new FJsonObject);
+		CompressOutput->SetStringField(TEXT("buildPath"), SourcePath);
+		CompressOutput->SetStringField(TEXT("zipPath"), ZipPath);
+		CompressOutput->SetNumberField(TEXT("zipSize"), ZipSize);
+		CompressOutput->SetNumberField(TEXT("uncompressedSize"), ZipWriter.GetUncompressedSize());
+		This->Finish(EGLCJobState::Succeeded, FString::Printf(TEXT("✓ Build compressed successfully! Size: %.2f MB"), ZipSize / (1024.0 * 1024.0)), CompressOutput);
+	});
+}
+
+// ========== UPLOAD ========== //
+
+FGLCUploadJob::FGLCUploadJob()
+	: FGLCJob(EGLCJobType::Upload)
+	, AppId(0)
+	, Method(EGLCUploadMethod::Archive)
+	, UncompressedSize(0)
+	, AppBuildId(0)
+{
+}
+
+FGLCUploadJob::FGLCUploadJob(int64 InAppId, const FString& InNotes, EGLCUploadMethod InMethod, const FString& InBuildPath, const FString& InZipPath, int64 InUncompressedSize)
+	: FGLCUploadJob()
+{
+	Params->SetNumberField(TEXT("appId"), InAppId);
+	Params->SetStringField(TEXT("notes"), InNotes);
+	Params->SetStringField(TEXT("method"), LexToString(InMethod));
+	Params->SetStringField(TEXT("buildPath"), InBuildPath);
+	Params->SetStringField(TEXT("zipPath"), InZipPath);
+	Params->SetNumberField(TEXT("uncompressedSize"), InUncompressedSize);
+}
+
+const TCHAR* FGLCUploadJob::LexToString(EGLCUploadMethod InMethod)
+{
+	switch (InMethod)
+	{
+	case EGLCUploadMethod::Streamed: return TEXT("streamed");
+	case EGLCUploadMethod::Chunked: return TEXT("chunked");
+	default: return TEXT("archive");
+	}
+}
+
+FString FGLCUploadJob::GetDisplayName() const
+{
+	FString MethodName;
+	Params->TryGetStringField(TEXT("method"), MethodName);
+	return FString::Printf(TEXT("Upload to app #%lld (%s)"), (int64)Params->GetNumberField(TEXT("appId")), *MethodName);
+}
+
+void FGLCUploadJob::Start()
+{
+	FString MethodName;
+	Params->TryGetNumberField(TEXT("appId"), AppId);
+	Params->TryGetStringField(TEXT("notes"), Notes);
+	Params->TryGetStringField(TEXT("method"), MethodName);
+	Params->TryGetStringField(TEXT("buildPath"), BuildPath);
+	Params->TryGetStringField(TEXT("zipPath"), ZipPath);
+	Params->TryGetNumberField(TEXT("uncompressedSize"), UncompressedSize);
+
+	Method = EGLCUploadMethod::Archive;
+	for (EGLCUploadMethod Candidate : { EGLCUploadMethod::Streamed, EGLCUploadMethod::Chunked })
+	{
+		if (MethodName == LexToString(Candidate))
+		{
+			Method = Candidate;
+		}
+	}
+
+	if (Notes.IsEmpty())
+	{
+		Notes = TEXT("Uploaded from Unreal Engine Extension");
+	}
+
+	AppBuildId = 0;
+	Settings = FGLCSettings::Load();
+	ApiClient = GetScheduler()->GetApiClient();
+	if (!ApiClient.IsValid())
+	{
+		Fail(TEXT("Not authenticated"));
+		return;
+	}
+
+	if (UncompressedSize > 0 || !FPaths::DirectoryExists(BuildPath))
+	{
+		StartUpload();
+		return;
+	}
+
+	// Restored or submitted without a scan; plan checks need the uncompressed size
+	ReportProgress(0.0f, TEXT("Measuring build..."));
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	Async(EAsyncExecution::ThreadPool, [This]()
+	{
+		TArray<TPair<FString, FFileStatData>> Files;
+		FGLCBuildManifest::CollectFiles(This->BuildPath, Files, This->GetCancelFlag());
+
+		int64 TotalSize = 0;
+		for (const TPair<FString, FFileStatData>& File : Files)
+		{
+			TotalSize += File.Value.FileSize;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [This, TotalSize]()
+		{
+			This->UncompressedSize = TotalSize;
+			This->StartUpload();
+		});
+	});
+}
+
+void FGLCUploadJob::StartUpload()
+{
+	if (FinishIfCancelled())
+	{
+		return;
+	}
+
+	switch (Method)
+	{
+	case EGLCUploadMethod::Streamed: UploadStreamed(); break;
+	case EGLCUploadMethod::Chunked: UploadChunked(); break;
+	default: UploadArchive(); break;
+	}
+}
+
+void FGLCUploadJob::Cancel()
+{
+	if (!ApiClient.IsValid())
+	{
+		return;
+	}
+
+	ApiClient->CancelActiveUpload();
+
+	// A cancelled build cannot be resumed; journals of other uploads stay
+	FGLCUploadJournal::Delete(AppId, ZipPath);
+
+	int64 BuildId = AppBuildId;
+	if (BuildId > 0)
+	{
+		ApiClient->CancelBuildAsync(BuildId, [BuildId](bool bSuccess, FString Error)
+		{
+			if (!bSuccess)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to cancel build #%lld: %s"), BuildId, *Error);
+			}
+		});
+	}
+
+	// The upload reports its cancellation through the progress handler; steps between requests check the flag
+}
+
+void FGLCUploadJob::Suspend()
+{
+	// Keep the journal and the server build: the upload resumes in the next session
+	if (ApiClient.IsValid())
+	{
+		ApiClient->CancelActiveUpload();
+	}
+}
+
+void FGLCUploadJob::SetAppBuildId(int64 InAppBuildId)
+{
+	AppBuildId = InAppBuildId;
+	Output->SetNumberField(TEXT("appBuildId"), InAppBuildId);
+}
+
+void FGLCUploadJob::Fail(const FString& Message)
+{
+	UE_LOG(LogTemp, Error, TEXT("[GLC] %s"), *Message);
+	Finish(EGLCJobState::Failed, Message);
+}
+
+bool FGLCUploadJob::FinishIfCancelled()
+{
+	if (!IsCancelRequested())
+	{
+		return false;
+	}
+
+	Finish(EGLCJobState::Cancelled, TEXT("⚠️ Upload cancelled by user"));
+	return true;
+}
+
+void FGLCUploadJob::UploadArchive()
+{
+	// Verify file exists
+	int64 FileSize = FPaths::FileExists(ZipPath) ? IFileManager::Get().FileSize(*ZipPath) : -1;
+	if (FileSize <= 0)
+	{
+		Fail(FileSize < 0 ? FString::Printf(TEXT("Build file not found: %s"), *ZipPath) : TEXT("Invalid build file. Please rebuild."));
+		return;
+	}
+
+	FString FileName = FPaths::GetCleanFilename(ZipPath);
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Starting upload - App: %lld, File: %s, Size: %lld bytes"), AppId, *FileName, FileSize);
+
+	ReportProgress(0.0f, TEXT("Checking upload limits..."));
+
+	// Step 1: Check if upload is allowed
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	ApiClient->CanUploadAsync(FileSize, UncompressedSize, AppId, [This, FileName, FileSize](bool bSuccess, FString Error, FGLCCanUploadResponse Response)
+	{
+		if (This->FinishIfCancelled())
+		{
+			return;
+		}
+
+		if (!bSuccess)
+		{
+			This->Fail(FString::Printf(TEXT("Upload check failed: %s"), *Error));
+			return;
+		}
+
+		if (!Response.CanUpload)
+		{
+			This->Fail(TEXT("Cannot upload. Check your plan limits."));
+			return;
+		}
+
+		This->ReportProgress(0.0f, TEXT("Starting upload..."));
+
+		int64 PartSize = (int64)This->Settings.UploadPartSizeMB * 1024 * 1024;
+		if (This->Settings.bUseMultipartUpload && FileSize > PartSize)
+		{
+			This->UploadMultipart(FileSize, PartSize);
+			return;
+		}
+
+		// Step 2: Start upload and get presigned URL
+		This->ApiClient->StartUploadAsync(This->AppId, FileName, FileSize, This->UncompressedSize, This->Notes,
+			[This, FileSize](bool bStarted, FString StartError, FGLCStartUploadResponse Upload)
+			{
+				if (!bStarted)
+				{
+					This->Fail(FString::Printf(TEXT("Failed to start upload: %s"), *StartError));
+					return;
+				}
+
+				This->SetAppBuildId(Upload.AppBuildId);
+				if (This->FinishIfCancelled())
+				{
+					return;
+				}
+
+				This->ReportProgress(0.0f, TEXT("Uploading file to cloud..."));
+
+				// Step 3: Upload file to cloud storage
+				This->ApiClient->UploadFileAsync(Upload.UploadUrl, This->ZipPath, This->MakeProgressHandler(Upload.AppBuildId, Upload.Key, FileSize));
+			});
+	});
+}
+
+void FGLCUploadJob::UploadMultipart(int64 FileSize, int64 PartSize)
+{
+	// Resume an interrupted upload of this exact archive instead of creating a new build
+	TSharedPtr<FGLCUploadJournal> Journal = MakeShared<FGLCUploadJournal>();
+	if (FGLCUploadJournal::Load(AppId, ZipPath, *Journal))
+	{
+		if (Journal->Matches(AppId, ZipPath))
+		{
+			ResumeMultipart(Journal, FileSize, PartSize);
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Discarding upload journal for Build #%lld (archive changed)"), Journal->AppBuildId);
+		FGLCUploadJournal::Delete(AppId, ZipPath);
+	}
+
+	// Storage backends accept at most 10000 parts per upload
+	int64 PartCount = FMath::DivideAndRoundUp(FileSize, PartSize);
+	if (PartCount > 10000)
+	{
+		PartSize = FMath::DivideAndRoundUp(FileSize, (int64)10000);
+		PartCount = FMath::DivideAndRoundUp(FileSize, PartSize);
+	}
+
+	// Step 2: Start multipart upload and get one presigned URL per part
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	ApiClient->StartMultipartUploadAsync(AppId, FPaths::GetCleanFilename(ZipPath), FileSize, UncompressedSize, Notes, PartSize, (int32)PartCount,
+		[This, FileSize](bool bSuccess, FString Error, FGLCStartMultipartUploadResponse Response)
+		{
+			if (!bSuccess)
+			{
+				This->Fail(FString::Printf(TEXT("Failed to start upload: %s"), *Error));
+				return;
+			}
+
+			This->SetAppBuildId(Response.AppBuildId);
+			if (This->FinishIfCancelled())
+			{
+				return;
+			}
+
+			This->ReportProgress(0.0f, FString::Printf(TEXT("Uploading file to cloud (%d parallel connections)..."), This->Settings.UploadConcurrency));
+
+			// Record the upload so it can be resumed after a failure or an editor restart
+			TSharedPtr<FGLCUploadJournal> NewJournal = MakeShared<FGLCUploadJournal>();
+			NewJournal->AppId = This->AppId;
+			NewJournal->AppBuildId = Response.AppBuildId;
+			NewJournal->Key = Response.Key;
+			NewJournal->UploadId = Response.UploadId;
+			NewJournal->FilePath = This->ZipPath;
+			NewJournal->FileSize = FileSize;
+			NewJournal->FileTimestamp = FGLCUploadJournal::GetFileTimestamp(This->ZipPath);
+			NewJournal->PartSize = Response.PartSize;
+			NewJournal->PartCount = Response.Parts.Num();
+			NewJournal->Save();
+
+			// Step 3: Upload all parts to cloud storage
+			This->ApiClient->UploadFileMultipartAsync(Response, This->ZipPath, This->Settings.UploadConcurrency, This->MakeProgressHandler(Response.AppBuildId, Response.Key, FileSize), NewJournal);
+		});
+}
+
+void FGLCUploadJob::ResumeMultipart(TSharedPtr<FGLCUploadJournal> Journal, int64 FileSize, int64 PartSize)
+{
+	SetAppBuildId(Journal->AppBuildId);
+
+	// Everything was uploaded before the interruption; only the file-ready notification is missing
+	if (Journal->bUploadCompleted)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Build #%lld already uploaded, sending file-ready notification"), Journal->AppBuildId);
+		MakeProgressHandler(Journal->AppBuildId, Journal->Key, FileSize)(true, TEXT("Upload completed"), 1.0f);
+		return;
+	}
+
+	TArray<int32> MissingParts = Journal->GetMissingPartNumbers();
+	int32 UploadedParts = Journal->PartCount - MissingParts.Num();
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Resuming upload of Build #%lld: %d/%d parts already uploaded"), Journal->AppBuildId, UploadedParts, Journal->PartCount);
+	ReportProgress(0.0f, FString::Printf(TEXT("Resuming upload (%d of %d parts already uploaded)..."), UploadedParts, Journal->PartCount));
+
+	FGLCStartMultipartUploadResponse Upload;
+	Upload.AppBuildId = Journal->AppBuildId;
+	Upload.Key = Journal->Key;
+	Upload.UploadId = Journal->UploadId;
+	Upload.PartSize = Journal->PartSize;
+
+	if (MissingParts.Num() == 0)
+	{
+		ApiClient->UploadFileMultipartAsync(Upload, ZipPath, Settings.UploadConcurrency, MakeProgressHandler(Upload.AppBuildId, Upload.Key, FileSize), Journal);
+		return;
+	}
+
+	// Presigned URLs expire, so always ask for fresh ones for the missing parts
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	ApiClient->GetMultipartPartUrlsAsync(Upload.AppBuildId, Upload.Key, Upload.UploadId, MissingParts,
+		[This, Upload, Journal, FileSize, PartSize](bool bSuccess, FString Error, TArray<FGLCMultipartPartUrl> Parts, int32 StatusCode) mutable
+		{
+			if (This->FinishIfCancelled())
+			{
+				return;
+			}
+
+			if (!bSuccess)
+			{
+				if (StatusCode != 404 && StatusCode != 410)
+				{
+					// Keep the journal: no response, a server error or an expired login still allow resuming later
+					This->Fail(FString::Printf(TEXT("Failed to resume upload: %s"), *Error));
+					return;
+				}
+
+				// The server no longer knows this upload (expired or aborted), start over with a new build
+				UE_LOG(LogTemp, Warning, TEXT("[GLC] Cannot resume Build #%lld (HTTP %d: %s), starting a new upload"), Upload.AppBuildId, StatusCode, *Error);
+				FGLCUploadJournal::Delete(This->AppId, This->ZipPath);
+				This->UploadMultipart(FileSize, PartSize);
+				return;
+			}
+
+			Upload.Parts = Parts;
+			This->ApiClient->UploadFileMultipartAsync(Upload, This->ZipPath, This->Settings.UploadConcurrency, This->MakeProgressHandler(Upload.AppBuildId, Upload.Key, FileSize), Journal);
+		});
+}
+
+void FGLCUploadJob::UploadStreamed()
+{
+	if (!FPaths::DirectoryExists(BuildPath) || UncompressedSize <= 0)
+	{
+		Fail(FString::Printf(TEXT("Build not found: %s"), *BuildPath));
+		return;
+	}
+
+	FString FileName = FPaths::GetCleanFilename(ZipPath);
+
+	// The archive size is unknown until compression ends; the uncompressed size is the upper bound used for
+	// plan checks and to keep the part count within the 10000 parts storage backends accept
+	int64 EstimatedSize = UncompressedSize;
+	int64 PartSize = FMath::Max((int64)Settings.UploadPartSizeMB * 1024 * 1024, FMath::DivideAndRoundUp(EstimatedSize, (int64)10000));
+	PartSize = FMath::Min(PartSize, (int64)MAX_int32);
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Starting streamed upload - App: %lld, File: %s, Uncompressed: %lld bytes"), AppId, *FileName, EstimatedSize);
+	ReportProgress(0.0f, TEXT("Checking upload limits..."));
+
+	// Step 1: Check if upload is allowed
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	ApiClient->CanUploadAsync(EstimatedSize, UncompressedSize, AppId, [This, FileName, EstimatedSize, PartSize](bool bSuccess, FString Error, FGLCCanUploadResponse Response)
+	{
+		if (This->FinishIfCancelled())
+		{
+			return;
+		}
+
+		if (!bSuccess)
+		{
+			This->Fail(FString::Printf(TEXT("Upload check failed: %s"), *Error));
+			return;
+		}
+
+		if (!Response.CanUpload)
+		{
+			This->Fail(TEXT("Cannot upload. Check your plan limits."));
+			return;
+		}
+
+		// Step 2: Start a multipart upload without part URLs; they are requested as parts are produced
+		This->ApiClient->StartMultipartUploadAsync(This->AppId, FileName, EstimatedSize, This->UncompressedSize, This->Notes, PartSize, 0,
+			[This](bool bStarted, FString StartError, FGLCStartMultipartUploadResponse Upload)
+			{
+				if (!bStarted)
+				{
+					This->Fail(FString::Printf(TEXT("Failed to start upload: %s"), *StartError));
+					return;
+				}
+
+				This->SetAppBuildId(Upload.AppBuildId);
+				if (This->FinishIfCancelled())
+				{
+					return;
+				}
+
+				This->ReportProgress(0.0f, FString::Printf(TEXT("Compressing and uploading (%d parallel connections)..."), This->Settings.UploadConcurrency));
+
+				// Step 3: Compress and upload at the same time
+				This->ApiClient->UploadDirectoryStreamedAsync(Upload, This->BuildPath, This->Settings.Compression, This->Settings.UploadConcurrency, This->MakeProgressHandler(Upload.AppBuildId, Upload.Key, 0));
+			});
+	});
+}
+
+void FGLCUploadJob::UploadChunked()
+{
+	if (!FPaths::DirectoryExists(BuildPath) || UncompressedSize <= 0)
+	{
+		Fail(FString::Printf(TEXT("Build not found: %s"), *BuildPath));
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Starting chunked upload - App: %lld, Uncompressed: %lld bytes"), AppId, UncompressedSize);
+	ReportProgress(0.0f, TEXT("Checking upload limits..."));
+
+	// Step 1: Check if upload is allowed; the amount actually sent is only known after chunking
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+	ApiClient->CanUploadAsync(UncompressedSize, UncompressedSize, AppId, [This](bool bSuccess, FString Error, FGLCCanUploadResponse Response)
+	{
+		if (This->FinishIfCancelled())
+		{
+			return;
+		}
+
+		if (!bSuccess)
+		{
+			This->Fail(FString::Printf(TEXT("Upload check failed: %s"), *Error));
+			return;
+		}
+
+		if (!Response.CanUpload)
+		{
+			This->Fail(TEXT("Cannot upload. Check your plan limits."));
+			return;
+		}
+
+		FGLCJobScheduler* Scheduler = This->GetScheduler();
+		if (!Scheduler)
+		{
+			return;
+		}
+
+		This->ReportProgress(0.0f, TEXT("Hashing build files..."));
+
+		// Step 2: Hash the build files; unchanged files reuse the hashes cached in the build manifest
+		Scheduler->GetBuildScanner()->RequestHashes([This](FGLCFileHashesPtr FileHashes)
+		{
+			if (This->FinishIfCancelled())
+			{
+				return;
+			}
+
+			if (!FileHashes.IsValid())
+			{
+				This->Fail(TEXT("Failed to hash build files"));
+				return;
+			}
+
+			// Step 3: Start the chunked upload
+			This->ApiClient->StartChunkedUploadAsync(This->AppId, This->UncompressedSize, This->Notes,
+				[This, FileHashes](bool bStarted, FString StartError, FGLCStartChunkedUploadResponse Upload)
+				{
+					if (!bStarted)
+					{
+						This->Fail(FString::Printf(TEXT("Failed to start upload: %s"), *StartError));
+						return;
+					}
+
+					This->SetAppBuildId(Upload.AppBuildId);
+					if (This->FinishIfCancelled())
+					{
+						return;
+					}
+
+					This->ReportProgress(0.0f, TEXT("Chunking build..."));
+
+					// Step 4: Chunk the build and upload the chunks the server is missing
+					This->ApiClient->UploadDirectoryChunkedAsync(This->AppId, Upload, This->BuildPath, This->Settings.GetChunkingParams(), FileHashes, This->Settings.UploadConcurrency, This->MakeProgressHandler(Upload.AppBuildId, Upload.Key, 0));
+				});
+		}, This->BuildPath);
+	});
+}
+
+TFunction<void(bool, FString, float)> FGLCUploadJob::MakeProgressHandler(int64 InAppBuildId, const FString& Key, int64 FileSize)
+{
+	// Track if we've already notified (since callback is called multiple times)
+	TSharedRef<TAtomic<bool>, ESPMode::ThreadSafe> bHasNotified = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+	TSharedRef<FGLCUploadJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCUploadJob>(AsShared());
+
+	return [This, InAppBuildId, Key, FileSize, bHasNotified](bool bSuccess, FString Error, float Progress)
+	{
+		// Check if upload was cancelled
+		if (!bSuccess && Progress < 0.0f)
+		{
+			This->Finish(EGLCJobState::Cancelled, TEXT("⚠️ Upload cancelled by user"));
+			return;
+		}
+
+		// Only treat as error if upload is complete but failed
+		if (!bSuccess && Progress >= 1.0f)
+		{
+			This->Fail(FString::Printf(TEXT("Upload failed: %s"), *Error));
+			return;
+		}
+
+		// Called for every chunk of bytes sent: no formatting here, the scheduler samples the channel.
+		// Streamed and chunked uploads do not know the size up front and describe their current phase instead.
+		if (FileSize > 0)
+		{
+			This->ReportBytes(Progress * 0.95f, TEXT("Uploading to cloud storage"), (int64)(Progress * FileSize), FileSize);
+		}
+		else
+		{
+			This->ReportBytes(Progress * 0.95f, Error.IsEmpty() ? TEXT("Uploading to cloud storage") : Error, 0, 0);
+		}
+
+		if (bSuccess && Progress >= 1.0f && !bHasNotified->Exchange(true))
+		{
+			This->ReportProgress(0.95f, TEXT("Finalizing upload..."));
+
+			// Step 4: Notify backend that file is ready
+			AsyncTask(ENamedThreads::GameThread, [This, InAppBuildId, Key]()
+			{
+				This->ApiClient->NotifyFileReadyAsync(InAppBuildId, Key, [This](bool bNotified, FString NotifyError)
+				{
+					if (!bNotified)
+					{
+						This->Fail(FString::Printf(TEXT("Failed to finalize upload: %s"), *NotifyError));
+						return;
+					}
+
+					// Nothing left to resume
+					FGLCUploadJournal::Delete(This->AppId, This->ZipPath);
+
+					This->Finish(EGLCJobState::Succeeded, TEXT("Upload completed! Your build is now processing."));
+				});
+			});
+		}
+	};
+}
+
+// ========== MONITOR ========== //
+
+FGLCMonitorJob::FGLCMonitorJob()
+	: FGLCJob(EGLCJobType::Monitor)
+{
+}
+
+FGLCMonitorJob::FGLCMonitorJob(int64 AppBuildId)
+	: FGLCMonitorJob()
+{
+	// Follows an upload job when 0: its appBuildId output is merged in when this job starts
+	if (AppBuildId > 0)
+	{
+		Params->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	}
+}
+
+int64 FGLCMonitorJob::GetAppBuildId() const
+{
+	int64 AppBuildId = 0;
+	Params->TryGetNumberField(TEXT("appBuildId"), AppBuildId);
+	return AppBuildId;
+}
+
+FString FGLCMonitorJob::GetDisplayName() const
+{
+	int64 AppBuildId = GetAppBuildId();
+	return AppBuildId > 0 ? FString::Printf(TEXT("Monitor build #%lld"), AppBuildId) : TEXT("Monitor build");
+}
+
+void FGLCMonitorJob::Start()
+{
+	ApiClient = GetScheduler()->GetApiClient();
+	if (!ApiClient.IsValid() || GetAppBuildId() == 0)
+	{
+		Finish(EGLCJobState::Failed, TEXT("No build to monitor"));
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] === Starting Build Status Monitor for Build #%lld ==="), GetAppBuildId());
+
+	// One shared poll covers every monitored build
+	TWeakPtr<FGLCMonitorJob, ESPMode::ThreadSafe> WeakThis = StaticCastSharedRef<FGLCMonitorJob>(AsShared());
+	StatusMonitor = GetScheduler()->GetStatusMonitor();
+	StatusHandle = StatusMonitor->Subscribe(GetAppBuildId(), [WeakThis](const FGLCBuildStatusResponse& Response)
+	{
+		TSharedPtr<FGLCMonitorJob, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (This.IsValid() && This->StatusHandle.IsValid())
+		{
+			This->HandleStatus(Response);
+		}
+	});
+}
+
+void FGLCMonitorJob::Cancel()
+{
+	StopPolling();
+
+	if (!ApiClient.IsValid())
+	{
+		return;
+	}
+
+	const int64 AppBuildId = GetAppBuildId();
+	TSharedRef<FGLCMonitorJob, ESPMode::ThreadSafe> This = StaticCastSharedRef<FGLCMonitorJob>(AsShared());
+	ApiClient->CancelBuildAsync(AppBuildId, [This, AppBuildId](bool bSuccess, FString Error)
+	{
+		if (!bSuccess)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to cancel build: %s"), *Error);
+			This->Finish(EGLCJobState::Failed, FString::Printf(TEXT("Failed to cancel build: %s"), *Error));
+			return;
+		}
+
+		// A cancelled build cannot be resumed
+		FGLCUploadJournal::DeleteForBuild(AppBuildId);
+
+		This->Finish(EGLCJobState::Cancelled, FString::Printf(TEXT("✓ Build #%lld cancelled successfully"), AppBuildId));
+	});
+}
+
+void FGLCMonitorJob::Suspend()
+{
+	StopPolling();
+}
+
+void FGLCMonitorJob::StopPolling()
+{
+	if (StatusHandle.IsValid())
+	{
+		StatusMonitor->Unsubscribe(StatusHandle);
+		StatusHandle.Reset();
+		StatusMonitor.Reset();
+		UE_LOG(LogTemp, Log, TEXT("[GLC] === Build Status Monitor Ended ==="));
+	}
+}
+
+void FGLCMonitorJob::HandleStatus(const FGLCBuildStatusResponse& Response)
+{
+	FString StatusIcon = GetStatusIcon(Response.Status);
+	FString StatusDisplayName = GetStatusDisplayName(Response.Status);
+	Output->SetNumberField(TEXT("appId"), Response.AppId);
+	Output->SetStringField(TEXT("status"), Response.Status);
+
+	// Check if build is in final state
+	if (Response.Status == TEXT("Completed"))
+	{
+		StopPolling();
+		Finish(EGLCJobState::Succeeded, FString::Printf(TEXT("✅ Build #%lld completed successfully!"), Response.AppBuildId));
+	}
+	else if (Response.Status == TEXT("Failed"))
+	{
+		FString ErrorMsg = Response.ErrorMessage.IsEmpty() ? TEXT("Unknown error") : Response.ErrorMessage;
+		StopPolling();
+		Finish(EGLCJobState::Failed, FString::Printf(TEXT("❌ Build #%lld failed: %s"), Response.AppBuildId, *ErrorMsg));
+	}
+	else if (Response.Status == TEXT("Cancelled") || Response.Status == TEXT("Deleted"))
+	{
+		StopPolling();
+		Finish(EGLCJobState::Cancelled, FString::Printf(TEXT("⚠️ Build #%lld was %s"), Response.AppBuildId, *Response.Status.ToLower()));
+	}
+	else if (Response.StageProgress > 0)
+	{
+		// Progress within the stage, weighted by how long the stage usually takes
+		float Progress = GetStageBaseProgress(Response.Status) + (Response.StageProgress / 100.0f) * GetStageWeight(Response.Status);
+		ReportProgress(Progress, FString::Printf(TEXT("%s Build #%lld: %s (%d%%)"), *StatusIcon, Response.AppBuildId, *StatusDisplayName, Response.StageProgress));
+	}
+	else
+	{
+		ReportProgress(GetStageBaseProgress(Response.Status), FString::Printf(TEXT("%s Build #%lld: %s"), *StatusIcon, Response.AppBuildId, *StatusDisplayName));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Build status: %s"), *Response.Status);
+}
+
+FString FGLCMonitorJob::GetStatusIcon(const FString& Status)
+{
+	if (Status == TEXT("Pending")) return TEXT("⏳");
+	if (Status == TEXT("GeneratingPresignedUrl")) return TEXT("🔗");
+	if (Status == TEXT("UploadingBuild")) return TEXT("⬆️");
+	if (Status == TEXT("Enqueued")) return TEXT("📋");
+	if (Status == TEXT("DownloadingBuild")) return TEXT("⬇️");
+	if (Status == TEXT("DownloadingPreviousBuild")) return TEXT("⬇️");
+	if (Status == TEXT("UnzippingBuild")) return TEXT("📦");
+	if (Status == TEXT("UnzippingPreviousBuild")) return TEXT("📦");
+	if (Status == TEXT("CreatingPatch")) return TEXT("🔧");
+	if (Status == TEXT("DeployingPatch")) return TEXT("🚀");
+	if (Status == TEXT("Completed")) return TEXT("✅");
+	if (Status == TEXT("Failed")) return TEXT("❌");
+	if (Status == TEXT("Cancelled")) return TEXT("⚠️");
+	if (Status == TEXT("Deleted")) return TEXT("🗑️");
+
+	return TEXT("📊");
+}
+
+FString FGLCMonitorJob::GetStatusDisplayName(const FString& Status)
+{
+	if (Status == TEXT("Pending")) return TEXT("Pending");
+	if (Status == TEXT("GeneratingPresignedUrl")) return TEXT("Preparing Upload");
+	if (Status == TEXT("UploadingBuild")) return TEXT("Uploading Build");
+	if (Status == TEXT("Enqueued")) return TEXT("Queued for Processing");
+	if (Status == TEXT("DownloadingBuild")) return TEXT("Downloading Build");
+	if (Status == TEXT("DownloadingPreviousBuild")) return TEXT("Downloading Previous Build");
+	if (Status == TEXT("UnzippingBuild")) return TEXT("Extracting Build");
+	if (Status == TEXT("UnzippingPreviousBuild")) return TEXT("Extracting Previous Build");
+	if (Status == TEXT("CreatingPatch")) return TEXT("Creating Patch");
+	if (Status == TEXT("DeployingPatch")) return TEXT("Deploying Patch");
+	if (Status == TEXT("Completed")) return TEXT("Completed");
+	if (Status == TEXT("Failed")) return TEXT("Failed");
+	if (Status == TEXT("Cancelled")) return TEXT("Cancelled");
+	if (Status == TEXT("Deleted")) return TEXT("Deleted");
+
+	return Status;
+}
+
+float FGLCMonitorJob::GetStageBaseProgress(const FString& Status)
+{
+	// Map each stage to a base progress percentage (0.0 to 1.0)
+	if (Status == TEXT("Pending")) return 0.0f;
+	if (Status == TEXT("GeneratingPresignedUrl")) return 0.05f;
+	if (Status == TEXT("UploadingBuild")) return 0.10f;
+	if (Status == TEXT("Enqueued")) return 0.30f;
+	if (Status == TEXT("DownloadingBuild")) return 0.35f;
+	if (Status == TEXT("DownloadingPreviousBuild")) return 0.40f;
+	if (Status == TEXT("UnzippingBuild")) return 0.50f;
+	if (Status == TEXT("UnzippingPreviousBuild")) return 0.60f;
+	if (Status == TEXT("CreatingPatch")) return 0.70f;
+	if (Status == TEXT("DeployingPatch")) return 0.85f;
+	if (Status == TEXT("Completed")) return 1.0f;
+
+	return 0.0f;
+}
+
+float FGLCMonitorJob::GetStageWeight(const FString& Status)
+{
+	// How much progress each stage contributes (0.0 to 1.0)
+	if (Status == TEXT("Pending")) return 0.05f;
+	if (Status == TEXT("GeneratingPresignedUrl")) return 0.05f;
+	if (Status == TEXT("UploadingBuild")) return 0.20f;
+	if (Status == TEXT("Enqueued")) return 0.05f;
+	if (Status == TEXT("DownloadingBuild")) return 0.05f;
+	if (Status == TEXT("DownloadingPreviousBuild")) return 0.10f;
+	if (Status == TEXT("UnzippingBuild")) return 0.10f;
+	if (Status == TEXT("UnzippingPreviousBuild")) return 0.10f;
+	if (Status == TEXT("CreatingPatch")) return 0.15f;
+	if (Status == TEXT("DeployingPatch")) return 0.15f;
+
+	return 0.05f;
+}
@@ -0,0 +1,737 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCJsonReader.h"
+
+namespace GLCJsonReader
+{
+	bool IsWhitespace(uint8 Char)
+	{
+		return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+	}
+
+	bool IsNumberStart(uint8 Char)
+	{
+		return Char == '-' || (Char >= '0' && Char <= '9');
+	}
+
+	bool IsNumberChar(uint8 Char)
+	{
+		return (Char >= '0' && Char <= '9') || Char == '-' || Char == '+' || Char == '.' || Char == 'e' || Char == 'E';
+	}
+
+	bool IsDigit(uint8 Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+
+	/** Checks a number against the JSON grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)? */
+	bool IsValidNumber(const uint8* Start, int32 Length, bool& bOutInteger)
+	{
+		const uint8* Char = Start;
+		const uint8* NumberEnd = Start + Length;
+		auto SkipDigits = [&Char, NumberEnd]()
+		{
+			const uint8* First = Char;
+			while (Char < NumberEnd && IsDigit(*Char))
+			{
+				Char++;
+			}
+			return Char > First;
+		};
+
+		bOutInteger = true;
+		if (Char < NumberEnd && *Char == '-')
+		{
+			Char++;
+		}
+		if (Char < NumberEnd && *Char == '0')
+		{
+			Char++;
+		}
+		else if (!SkipDigits())
+		{
+			return false;
+		}
+
+		if (Char < NumberEnd && *Char == '.')
+		{
+			Char++;
+			bOutInteger = false;
+			if (!SkipDigits())
+			{
+				return false;
+			}
+		}
+
+		if (Char < NumberEnd && (*Char == 'e' || *Char == 'E'))
+		{
+			Char++;
+			bOutInteger = false;
+			if (Char < NumberEnd && (*Char == '+' || *Char == '-'))
+			{
+				Char++;
+			}
+			if (!SkipDigits())
+			{
+				return false;
+			}
+		}
+
+		return Char == NumberEnd;
+	}
+
+	/** Parses a valid number; fails when it does not fit a double */
+	bool ParseDouble(const uint8* Start, int32 Length, double& OutValue)
+	{
+		ANSICHAR Buffer[64];
+		if (Length <= 0 || Length >= UE_ARRAY_COUNT(Buffer))
+		{
+			return false;
+		}
+		FMemory::Memcpy(Buffer, Start, Length);
+		Buffer[Length] = '\0';
+		const double Value = FCStringAnsi::Atod(Buffer);
+		if (!FMath::IsFinite(Value))
+		{
+			return false;
+		}
+		OutValue = Value;
+		return true;
+	}
+
+	/** Parses a valid number, truncating a fraction; fails when it does not fit an int64 */
+	bool ParseInteger(const uint8* Start, int32 Length, int64& OutValue)
+	{
+		bool bInteger = false;
+		if (!IsValidNumber(Start, Length, bInteger))
+		{
+			return false;
+		}
+
+		if (!bInteger)
+		{
+			// Fraction or exponent
+			double DoubleValue = 0.0;
+			if (!ParseDouble(Start, Length, DoubleValue) || DoubleValue < -9223372036854775808.0 || DoubleValue >= 9223372036854775808.0)
+			{
+				return false;
+			}
+			OutValue = (int64)DoubleValue;
+			return true;
+		}
+
+		// Accumulated as a negative number, whose range reaches MIN_int64
+		const bool bNegative = Start[0] == '-';
+		int64 Value = 0;
+		for (int32 Index = bNegative ? 1 : 0; Index < Length; ++Index)
+		{
+			const int64 Digit = Start[Index] - '0';
+			if (Value < (MIN_int64 + Digit) / 10)
+			{
+				return false;
+			}
+			Value = Value * 10 - Digit;
+		}
+
+		if (!bNegative)
+		{
+			if (Value == MIN_int64)
+			{
+				return false;
+			}
+			Value = -Value;
+		}
+
+		OutValue = Value;
+		return true;
+	}
+
+	bool ParseHex4(const uint8* Start, int32 Available, uint32& OutValue)
+	{
+		if (Available < 4)
+		{
+			return false;
+		}
+
+		OutValue = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			uint8 Char = Start[Index];
+			uint32 Digit;
+			if (Char >= '0' && Char <= '9')
+			{
+				Digit = Char - '0';
+			}
+			else if (Char >= 'a' && Char <= 'f')
+			{
+				Digit = Char - 'a' + 10;
+			}
+			else if (Char >= 'A' && Char <= 'F')
+			{
+				Digit = Char - 'A' + 10;
+			}
+			else
+			{
+				return false;
+			}
+			OutValue = (OutValue << 4) | Digit;
+		}
+		return true;
+	}
+
+	template <typename AllocatorType>
+	void AppendUtf8(TArray<ANSICHAR, AllocatorType>& Out, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Out.Add((ANSICHAR)CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			Out.Add((ANSICHAR)(0xC0 | (CodePoint >> 6)));
+			Out.Add((ANSICHAR)(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Out.Add((ANSICHAR)(0xE0 | (CodePoint >> 12)));
+			Out.Add((ANSICHAR)(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add((ANSICHAR)(0xF0 | (CodePoint >> 18)));
+			Out.Add((ANSICHAR)(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+
+	void AssignUtf8(const ANSICHAR* Utf8, int32 Length, FString& OutValue)
+	{
+		FUTF8ToTCHAR Converted(Utf8, Length);
+		OutValue.Reset(Converted.Length());
+		OutValue.AppendChars(Converted.Get(), Converted.Length());
+	}
+
+	/** Converts the contents of a string token; only strings with escapes need a scratch buffer */
+	bool DecodeString(const uint8* Start, int32 Length, bool bEscaped, FString& OutValue)
+	{
+		if (!bEscaped)
+		{
+			AssignUtf8((const ANSICHAR*)Start, Length, OutValue);
+			return true;
+		}
+
+		TArray<ANSICHAR, TInlineAllocator<256>> Unescaped;
+		Unescaped.Reserve(Length);
+
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			uint8 Char = Start[Index];
+			if (Char != '\\')
+			{
+				Unescaped.Add((ANSICHAR)Char);
+				continue;
+			}
+
+			if (++Index >= Length)
+			{
+				return false;
+			}
+
+			switch (Start[Index])
+			{
+			case '"': Unescaped.Add('"'); break;
+			case '\\': Unescaped.Add('\\'); break;
+			case '/': Unescaped.Add('/'); break;
+			case 'b': Unescaped.Add('\b'); break;
+			case 'f': Unescaped.Add('\f'); break;
+			case 'n': Unescaped.Add('\n'); break;
+			case 'r': Unescaped.Add('\r'); break;
+			case 't': Unescaped.Add('\t'); break;
+			case 'u':
+			{
+				uint32 CodePoint = 0;
+				if (!ParseHex4(Start + Index + 1, Length - Index - 1, CodePoint))
+				{
+					return false;
+				}
+				Index += 4;
+
+				if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+				{
+					// High surrogate, combined with the low surrogate escape that should follow
+					uint32 LowSurrogate = 0;
+					if (Index + 2 < Length && Start[Index + 1] == '\\' && Start[Index + 2] == 'u'
+						&& ParseHex4(Start + Index + 3, Length - Index - 3, LowSurrogate)
+						&& LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+					{
+						CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+						Index += 6;
+					}
+					else
+					{
+						CodePoint = 0xFFFD;
+					}
+				}
+				else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+				{
+					CodePoint = 0xFFFD;
+				}
+
+				AppendUtf8(Unescaped, CodePoint);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		AssignUtf8(Unescaped.GetData(), Unescaped.Num(), OutValue);
+		return true;
+	}
+}
+
+bool FGLCJsonKey::Is(const ANSICHAR* Name) const
+{
+	int32 NameLength = FCStringAnsi::Strlen(Name);
+	if (NameLength != Length)
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		if (FCharAnsi::ToLower((ANSICHAR)Data[Index]) != FCharAnsi::ToLower(Name[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FGLCJsonReader::FGLCJsonReader(TConstArrayView<uint8> InPayload)
+	: Begin(InPayload.GetData())
+	, Cursor(InPayload.GetData())
+	, End(InPayload.GetData() + InPayload.Num())
+	, Depth(0)
+{
+	// Byte order mark
+	if (End - Cursor >= 3 && Cursor[0] == 0xEF && Cursor[1] == 0xBB && Cursor[2] == 0xBF)
+	{
+		Cursor += 3;
+	}
+}
+
+bool FGLCJsonReader::ReadObject(TFunctionRef<bool(const FGLCJsonKey& Key)> ReadField)
+{
+	if (Peek() != '{')
+	{
+		return Skip();
+	}
+
+	if (Depth >= MaxDepth)
+	{
+		return Fail(TEXT("Nesting too deep"));
+	}
+	Depth++;
+	Cursor++;
+
+	if (Peek() == '}')
+	{
+		Cursor++;
+		Depth--;
+		return true;
+	}
+
+	for (;;)
+	{
+		if (Peek() != '"')
+		{
+			return Fail(TEXT("Expected an object key"));
+		}
+
+		FGLCJsonKey Key;
+		bool bEscaped = false;
+		if (!ReadStringSpan(Key.Data, Key.Length, bEscaped) || !Expect(':'))
+		{
+			return false;
+		}
+
+		Peek();
+		const uint8* ValueStart = Cursor;
+		if (!ReadField(Key) || HasError())
+		{
+			return false;
+		}
+		if (Cursor == ValueStart && !Skip())
+		{
+			return false;
+		}
+
+		uint8 Next = Peek();
+		if (Next == ',')
+		{
+			Cursor++;
+			continue;
+		}
+		if (Next == '}')
+		{
+			Cursor++;
+			break;
+		}
+		return Fail(TEXT("Expected ',' or '}'"));
+	}
+
+	Depth--;
+	return true;
+}
+
+bool FGLCJsonReader::ReadArray(TFunctionRef<bool()> ReadElement)
+{
+	if (Peek() != '[')
+	{
+		return Skip();
+	}
+
+	if (Depth >= MaxDepth)
+	{
+		return Fail(TEXT("Nesting too deep"));
+	}
+	Depth++;
+	Cursor++;
+
+	if (Peek() == ']')
+	{
+		Cursor++;
+		Depth--;
+		return true;
+	}
+
+	for (;;)
+	{
+		Peek();
+		const uint8* ElementStart = Cursor;
+		if (!ReadElement() || HasError())
+		{
+			return false;
+		}
+		if (Cursor == ElementStart && !Skip())
+		{
+			return false;
+		}
+
+		uint8 Next = Peek();
+		if (Next == ',')
+		{
+			Cursor++;
+			continue;
+		}
+		if (Next == ']')
+		{
+			Cursor++;
+			break;
+		}
+		return Fail(TEXT("Expected ',' or ']'"));
+	}
+
+	Depth--;
+	return true;
+}
+
+bool FGLCJsonReader::Read(FString& OutValue)
+{
+	uint8 Next = Peek();
+	if (Next == '"')
+	{
+		const uint8* Start = nullptr;
+		int32 Length = 0;
+		bool bEscaped = false;
+		if (!ReadStringSpan(Start, Length, bEscaped))
+		{
+			return false;
+		}
+		if (!GLCJsonReader::DecodeString(Start, Length, bEscaped, OutValue))
+		{
+			return Fail(TEXT("Invalid escape sequence"));
+		}
+		return true;
+	}
+
+	if (GLCJsonReader::IsNumberStart(Next))
+	{
+		// Numbers read as strings keep their text, like FJsonValueNumber::TryGetString
+		const uint8* Start = nullptr;
+		int32 Length = 0;
+		bool bInteger = false;
+		if (!ReadNumberSpan(Start, Length, bInteger))
+		{
+			return false;
+		}
+		GLCJsonReader::AssignUtf8((const ANSICHAR*)Start, Length, OutValue);
+		return true;
+	}
+
+	return Skip();
+}
+
+bool FGLCJsonReader::Read(bool& OutValue)
+{
+	uint8 Next = Peek();
+	if (Next == 't' || Next == 'f')
+	{
+		const bool bValue = Next == 't';
+		if (!ReadLiteral(bValue ? "true" : "false"))
+		{
+			return false;
+		}
+		OutValue = bValue;
+		return true;
+	}
+
+	return Skip();
+}
+
+bool FGLCJsonReader::Read(int32& OutValue)
+{
+	int64 Value = 0;
+	bool bFound = false;
+	const uint8* Start = nullptr;
+	int32 Length = 0;
+	if (!ReadNumberText(Start, Length, bFound))
+	{
+		return false;
+	}
+	if (bFound)
+	{
+		if (!GLCJsonReader::ParseInteger(Start, Length, Value) || Value < MIN_int32 || Value > MAX_int32)
+		{
+			return Fail(TEXT("Number out of range"));
+		}
+		OutValue = (int32)Value;
+	}
+	return true;
+}
+
+bool FGLCJsonReader::Read(int64& OutValue)
+{
+	bool bFound = false;
+	const uint8* Start = nullptr;
+	int32 Length = 0;
+	if (!ReadNumberText(Start, Length, bFound))
+	{
+		return false;
+	}
+	if (bFound && !GLCJsonReader::ParseInteger(Start, Length, OutValue))
+	{
+		return Fail(TEXT("Number out of range"));
+	}
+	return true;
+}
+
+bool FGLCJsonReader::Read(double& OutValue)
+{
+	bool bFound = false;
+	const uint8* Start = nullptr;
+	int32 Length = 0;
+	if (!ReadNumberText(Start, Length, bFound))
+	{
+		return false;
+	}
+	if (bFound && !GLCJsonReader::ParseDouble(Start, Length, OutValue))
+	{
+		return Fail(TEXT("Number out of range"));
+	}
+	return true;
+}
+
+bool FGLCJsonReader::Skip()
+{
+	switch (Peek())
+	{
+	case '{':
+		return ReadObject([](const FGLCJsonKey&) { return true; });
+	case '[':
+		return ReadArray([]() { return true; });
+	case '"':
+	{
+		const uint8* Start = nullptr;
+		int32 Length = 0;
+		bool bEscaped = false;
+		return ReadStringSpan(Start, Length, bEscaped);
+	}
+	case 't':
+		return ReadLiteral("true");
+	case 'f':
+		return ReadLiteral("false");
+	case 'n':
+		return ReadLiteral("null");
+	default:
+		break;
+	}
+
+	if (Cursor >= End)
+	{
+		return Fail(TEXT("Unexpected end of payload"));
+	}
+	if (GLCJsonReader::IsNumberStart(*Cursor))
+	{
+		const uint8* Start = nullptr;
+		int32 Length = 0;
+		bool bInteger = false;
+		return ReadNumberSpan(Start, Length, bInteger);
+	}
+	return Fail(TEXT("Unexpected character"));
+}
+
+bool FGLCJsonReader::RequireObject()
+{
+	if (Peek() != '{')
+	{
+		return Fail(TEXT("Expected an object"));
+	}
+	return true;
+}
+
+bool FGLCJsonReader::TryReadNull()
+{
+	return Peek() == 'n' && ReadLiteral("null");
+}
+
+bool FGLCJsonReader::IsNextObject()
+{
+	return Peek() == '{';
+}
+
+bool FGLCJsonReader::IsNextString()
+{
+	const uint8 Next = Peek();
+	return Next == '"' || GLCJsonReader::IsNumberStart(Next);
+}
+
+bool FGLCJsonReader::IsAtEnd()
+{
+	Peek();
+	return Cursor >= End;
+}
+
+uint8 FGLCJsonReader::Peek()
+{
+	while (Cursor < End && GLCJsonReader::IsWhitespace(*Cursor))
+	{
+		Cursor++;
+	}
+	return Cursor < End ? *Cursor : 0;
+}
+
+bool FGLCJsonReader::Expect(uint8 Char)
+{
+	if (Peek() != Char)
+	{
+		return Fail(*FString::Printf(TEXT("Expected '%c'"), (TCHAR)Char));
+	}
+	Cursor++;
+	return true;
+}
+
+bool FGLCJsonReader::ReadStringSpan(const uint8*& OutStart, int32& OutLength, bool& bOutEscaped)
+{
+	if (!Expect('"'))
+	{
+		return false;
+	}
+
+	OutStart = Cursor;
+	bOutEscaped = false;
+	while (Cursor < End)
+	{
+		uint8 Char = *Cursor;
+		if (Char == '"')
+		{
+			OutLength = (int32)(Cursor - OutStart);
+			Cursor++;
+			return true;
+		}
+		if (Char == '\\')
+		{
+			bOutEscaped = true;
+			Cursor += 2;
+			continue;
+		}
+		if (Char < 0x20)
+		{
+			return Fail(TEXT("Control character in string"));
+		}
+		Cursor++;
+	}
+
+	return Fail(TEXT("Unterminated string"));
+}
+
+bool FGLCJsonReader::ReadNumberSpan(const uint8*& OutStart, int32& OutLength, bool& bOutInteger)
+{
+	OutStart = Cursor;
+	while (Cursor < End && GLCJsonReader::IsNumberChar(*Cursor))
+	{
+		Cursor++;
+	}
+
+	OutLength = (int32)(Cursor - OutStart);
+	if (!GLCJsonReader::IsValidNumber(OutStart, OutLength, bOutInteger))
+	{
+		return Fail(TEXT("Invalid number"));
+	}
+	return true;
+}
+
+bool FGLCJsonReader::ReadNumberText(const uint8*& OutStart, int32& OutLength, bool& bOutFound)
+{
+	bOutFound = false;
+
+	uint8 Next = Peek();
+	if (GLCJsonReader::IsNumberStart(Next))
+	{
+		bool bInteger = false;
+		if (!ReadNumberSpan(OutStart, OutLength, bInteger))
+		{
+			return false;
+		}
+		bOutFound = true;
+		return true;
+	}
+
+	if (Next == '"')
+	{
+		// Quoted numbers convert, like FJsonValueString::TryGetNumber
+		bool bEscaped = false;
+		if (!ReadStringSpan(OutStart, OutLength, bEscaped))
+		{
+			return false;
+		}
+		bool bInteger = false;
+		bOutFound = !bEscaped && GLCJsonReader::IsValidNumber(OutStart, OutLength, bInteger);
+		return true;
+	}
+
+	return Skip();
+}
+
+bool FGLCJsonReader::ReadLiteral(const ANSICHAR* Literal)
+{
+	int32 Length = FCStringAnsi::Strlen(Literal);
+	if (End - Cursor < Length || FMemory::Memcmp(Cursor, Literal, Length) != 0)
+	{
+		return Fail(TEXT("Invalid literal"));
+	}
+	Cursor += Length;
+	return true;
+}
+
+bool FGLCJsonReader::Fail(const TCHAR* Message)
+{
+	if (Error.IsEmpty())
+	{
+		Error = FString::Printf(TEXT("%s at offset %d"), Message, (int32)(Cursor - Begin));
+	}
+	return false;
+}
@@ -0,0 +1,85 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCManagerViewModel.h"
+#include "Async/Async.h"
+
+FGLCManagerState::FGLCManagerState()
+	: bIsAuthenticated(false)
+	, bIsLoggingIn(false)
+	, Apps(MakeShared<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe>())
+	, bIsLoadingApps(false)
+	, bIsLoadingMoreApps(false)
+	, bIsScanningBuild(false)
+	, StatusMessageType(TEXT("Info"))
+	, Progress(0.0f)
+{
+}
+
+FGLCManagerViewModel::FGLCManagerViewModel()
+	: State(MakeShared<const FGLCManagerState, ESPMode::ThreadSafe>())
+	, bFlushScheduled(false)
+{
+}
+
+void FGLCManagerViewModel::Update(FCommand Command)
+{
+	if (IsInGameThread())
+	{
+		Flush(&Command);
+		return;
+	}
+
+	PendingCommands.Enqueue(MoveTemp(Command));
+	if (bFlushScheduled.Exchange(true))
+	{
+		return;
+	}
+
+	TWeakPtr<FGLCManagerViewModel, ESPMode::ThreadSafe> WeakThis = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+	{
+		if (TSharedPtr<FGLCManagerViewModel, ESPMode::ThreadSafe> This = WeakThis.Pin())
+		{
+			This->Flush();
+		}
+	});
+}
+
+void FGLCManagerViewModel::SetStatus(const FString& Message, const FString& MessageType)
+{
+	Update([Message, MessageType](FGLCManagerState& NewState)
+	{
+		NewState.StatusMessage = Message;
+		NewState.StatusMessageType = MessageType;
+	});
+}
+
+void FGLCManagerViewModel::Flush(FCommand* Command)
+{
+	check(IsInGameThread());
+
+	// Cleared first: a command queued from now on schedules a flush of its own
+	bFlushScheduled = false;
+
+	TSharedRef<FGLCManagerState, ESPMode::ThreadSafe> NewState = MakeShared<FGLCManagerState, ESPMode::ThreadSafe>(*State);
+	bool bChanged = false;
+
+	FCommand Pending;
+	while (PendingCommands.Dequeue(Pending))
+	{
+		Pending(*NewState);
+		bChanged = true;
+	}
+
+	if (Command != nullptr)
+	{
+		(*Command)(*NewState);
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		State = NewState;
+		StateChangedEvent.Broadcast(State);
+	}
+}
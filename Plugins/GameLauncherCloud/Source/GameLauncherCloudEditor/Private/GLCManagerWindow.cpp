@@ -1,13 +1,24 @@
 // Copyright Game Launcher Cloud. All Rights Reserved.
 
 #include "GLCManagerWindow.h"
+#include "GLCSettings.h"
+#include "GLCBuildScanner.h"
+#include "GLCJobs.h"
+#include "GameLauncherCloudEditorModule.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
+#include "Widgets/SInvalidationPanel.h"
 #include "EditorStyleSet.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -15,43 +26,71 @@
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "TimerManager.h"
 #include "Editor.h"
 #include "HAL/PlatformProcess.h"
 #include "Async/Async.h"
 #include "Misc/App.h"
 #include "Misc/MessageDialog.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "Widgets/SVirtualWindow.h"
+#include "Input/HittestGrid.h"
+#include "Slate/WidgetRenderer.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RenderingThread.h"
 
 #define LOCTEXT_NAMESPACE "GLCManagerWindow"
 
 void SGLCManagerWindow::Construct(const FArguments& InArgs)
 {
-	bIsAuthenticated = false;
-	bIsLoggingIn = false;
-	bIsLoadingApps = false;
-	bIsBuilding = false;
-	bIsUploading = false;
-	bIsMonitoringBuild = false;
-	UploadProgress = 0.0f;
-	SelectedAppIndex = 0;
-	CurrentBuildId = 0;
+	TRACE_CPUPROFILER_EVENT_SCOPE(SGLCManagerWindow::Construct);
+	const double StartTime = FPlatformTime::Seconds();
+	
+	SelectedAppIndex = INDEX_NONE;
+	AppListRequest = 0;
 	CurrentEnvironment = TEXT("Production");
 	
-	// Initialize build detection
-	bHasBuildReady = false;
-	LastBuildSize = 0;
-	UncompressedBuildSize = 0;
-	TotalFileCount = 0;
-	bIsCompressed = false;
+	// Every state change lands here, whichever thread reported it
+	ViewModel = MakeShared<FGLCManagerViewModel, ESPMode::ThreadSafe>();
+	ViewModel->OnStateChanged().AddSP(this, &SGLCManagerWindow::OnStateChanged);
+	
+	BuildScanner = GetJobScheduler().GetBuildScanner();
+	
+	// Build profile options
+	BuildProfileAppId = 0;
+	BuildModeOptions.Add(MakeShareable(new FString(FGLCBuildProfile::GetModeDisplayName(EGLCBuildMode::Full))));
+	BuildModeOptions.Add(MakeShareable(new FString(FGLCBuildProfile::GetModeDisplayName(EGLCBuildMode::FastIteration))));
+	for (const FString& Configuration : FGLCBuildProfile::GetConfigurations())
+	{
+		BuildConfigurationOptions.Add(MakeShareable(new FString(Configuration)));
+	}
+	
+	// Build matrix defaults to the host platform only
+	MatrixPlatforms.Add(FGLCBuildMatrix::GetSupportedPlatforms()[0]);
+	MatrixConfigurations.Add(TEXT("Development"));
+	bMatrixFinished = false;
 	
 	ApiUrl = TEXT("https://api.gamelauncher.cloud");
 	
 	LoadConfig();
+	OnStateChanged(ViewModel->GetState());
+	
+	// The scheduler's client, so that jobs submitted from here run with this login
+	ApiClient = GetJobScheduler().GetApiClient();
+	ApiClient->SetAuthToken(AuthToken);
 	
-	ApiClient = MakeShareable(new FGLCApiClient(ApiUrl, AuthToken));
+	// Jobs report here while the window is open; they keep running once it is closed
+	GetJobScheduler().OnJobChanged().AddSP(this, &SGLCManagerWindow::OnJobChanged);
+	for (const FGLCJobPtr& Job : GetJobScheduler().GetJobs())
+	{
+		if (Job->GetState() == EGLCJobState::Running || Job->GetState() == EGLCJobState::Paused)
+		{
+			OnJobChanged(Job);
+		}
+	}
 	
 	// Auto-load apps and check builds if already authenticated
-	if (bIsAuthenticated && !AuthToken.IsEmpty())
+	if (InArgs._LoadApps && GetState().bIsAuthenticated && !AuthToken.IsEmpty())
 	{
 		CheckForExistingBuild();
 		OnLoadAppsClicked();
@@ -113,13 +152,13 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() { 
-							return bIsAuthenticated ? 
-								FText::Format(LOCTEXT("Connected", "✓ {0}"), FText::FromString(UserEmail)) : 
+							return GetState().bIsAuthenticated ? 
+								FText::Format(LOCTEXT("Connected", "✓ {0}"), FText::FromString(GetState().UserEmail)) : 
 								LOCTEXT("NotConnected", "Not connected");
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 11))
 						.ColorAndOpacity_Lambda([this]() { 
-							return bIsAuthenticated ? 
+							return GetState().bIsAuthenticated ? 
 								FLinearColor(0.4f, 1.0f, 0.4f) : 
 								FLinearColor(1.0f, 0.7f, 0.4f);
 						})
@@ -131,14 +170,14 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
-							return bIsAuthenticated && !UserPlan.IsEmpty() ?
-								FText::Format(LOCTEXT("PlanLabel", "Plan: {0}"), FText::FromString(UserPlan)) :
+							return GetState().bIsAuthenticated && !GetState().UserPlan.IsEmpty() ?
+								FText::Format(LOCTEXT("PlanLabel", "Plan: {0}"), FText::FromString(GetState().UserPlan)) :
 								FText::GetEmpty();
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
 						.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f, 0.8f))
 						.Visibility_Lambda([this]() {
-							return (bIsAuthenticated && !UserPlan.IsEmpty()) ? EVisibility::Visible : EVisibility::Collapsed;
+							return (GetState().bIsAuthenticated && !GetState().UserPlan.IsEmpty()) ? EVisibility::Visible : EVisibility::Collapsed;
 						})
 					]
 					+ SVerticalBox::Slot()
@@ -151,7 +190,7 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 						.ForegroundColor(FLinearColor::White)
 						.ContentPadding(FMargin(12.0f, 6.0f))
 						.OnClicked(this, &SGLCManagerWindow::OnLogoutClicked)
-						.Visibility_Lambda([this]() { return bIsAuthenticated ? EVisibility::Visible : EVisibility::Collapsed; })
+						.Visibility_Lambda([this]() { return GetState().bIsAuthenticated ? EVisibility::Visible : EVisibility::Collapsed; })
 						[
 							SNew(STextBlock)
 							.Text(LOCTEXT("LogoutButton", "Logout"))
@@ -177,16 +216,32 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 			SNew(SScrollBox)
 			+ SScrollBox::Slot()
 			[
-				SAssignNew(MainContentBox, SVerticalBox)
+				SAssignNew(SectionsBox, SVerticalBox)
 				
-				// Show login or build/upload based on auth state
+				// Both tabs are built once; logging in or out only switches between them
+				// Each section caches its layout and only repaints what its own attributes change
 				+ SVerticalBox::Slot()
 				.AutoHeight()
 				[
 					SNew(SBorder)
 					.Padding(20.0f)
 					[
-						bIsAuthenticated ? ConstructBuildUploadTab() : ConstructLoginTab()
+						SNew(SWidgetSwitcher)
+						.WidgetIndex_Lambda([this]() { return GetState().bIsAuthenticated ? 1 : 0; })
+						+ SWidgetSwitcher::Slot()
+						[
+							SNew(SInvalidationPanel)
+							[
+								ConstructLoginTab()
+							]
+						]
+						+ SWidgetSwitcher::Slot()
+						[
+							SNew(SInvalidationPanel)
+							[
+								ConstructBuildUploadTab()
+							]
+						]
 					]
 				]
 				
@@ -195,7 +250,10 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 				.AutoHeight()
 				.Padding(0.0f, 20.0f, 0.0f, 0.0f)
 				[
-					ConstructTipsTab()
+					SNew(SInvalidationPanel)
+					[
+						ConstructTipsTab()
+					]
 				]
 			]
 		]
@@ -220,6 +278,8 @@ void SGLCManagerWindow::Construct(const FArguments& InArgs)
 			.ColorAndOpacity(FLinearColor(0.5f, 0.6f, 0.7f, 0.7f))
 		]
 	];
+	
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Manager window built in %.1f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 void SGLCManagerWindow::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
@@ -281,11 +341,11 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructLoginTab()
 				.ForegroundColor(FLinearColor::White)
 				.ContentPadding(FMargin(40.0f, 12.0f))
 				.OnClicked(this, &SGLCManagerWindow::OnLoginWithApiKeyClicked)
-				.IsEnabled_Lambda([this]() { return !bIsLoggingIn && !ApiKeyInput.IsEmpty(); })
+				.IsEnabled_Lambda([this]() { return !GetState().bIsLoggingIn && !ApiKeyInput.IsEmpty(); })
 				[
 					SNew(STextBlock)
 					.Text_Lambda([this]() { 
-						return bIsLoggingIn ? 
+						return GetState().bIsLoggingIn ? 
 							LOCTEXT("Logging", "⏳ Logging in...") : 
 							LOCTEXT("LoginButton", "Login with API Key");
 					})
@@ -302,15 +362,15 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructLoginTab()
 				SNew(SBorder)
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 				.BorderBackgroundColor_Lambda([this]() {
-					return StatusMessageType == TEXT("Error") ? 
+					return GetState().StatusMessageType == TEXT("Error") ? 
 						FLinearColor(0.8f, 0.2f, 0.2f, 0.8f) : 
 						FLinearColor(0.2f, 0.6f, 0.3f, 0.8f);
 				})
 				.Padding(FMargin(15.0f, 10.0f))
-				.Visibility_Lambda([this]() { return StatusMessage.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible; })
+				.Visibility_Lambda([this]() { return GetState().StatusMessage.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible; })
 				[
-					SAssignNew(StatusMessageText, STextBlock)
-					.Text(FText::FromString(StatusMessage))
+					SNew(STextBlock)
+					.Text_Lambda([this]() { return StatusText; })
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 					.ColorAndOpacity(FLinearColor::White)
 				]
@@ -372,7 +432,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				.Padding(FMargin(20.0f, 15.0f))
 				[
 					SNew(STextBlock)
-					.Text(FText::Format(LOCTEXT("WelcomeMessage", "👋 Welcome, {0}!"), FText::FromString(UserEmail)))
+					.Text_Lambda([this]() { return WelcomeText; })
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 15))
 					.ColorAndOpacity(FLinearColor(0.9f, 0.95f, 1.0f))
 				]
@@ -420,11 +480,11 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 							.ForegroundColor(FLinearColor::White)
 							.ContentPadding(FMargin(15.0f, 8.0f))
 							.OnClicked(this, &SGLCManagerWindow::OnLoadAppsClicked)
-							.IsEnabled_Lambda([this]() { return !bIsLoadingApps; })
+							.IsEnabled_Lambda([this]() { return !GetState().bIsLoadingApps; })
 							[
 								SNew(STextBlock)
 								.Text_Lambda([this]() {
-									return bIsLoadingApps ? 
+									return GetState().bIsLoadingApps ? 
 										LOCTEXT("LoadingApps", "⏳ Loading...") : 
 										LOCTEXT("LoadAppsButton", "🔄 Reload Apps");
 								})
@@ -440,7 +500,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 							.ForegroundColor(FLinearColor(0.9f, 0.95f, 1.0f))
 							.ContentPadding(FMargin(15.0f, 8.0f))
 							.OnClicked(this, &SGLCManagerWindow::OnManageAppClicked)
-							.IsEnabled_Lambda([this]() { return AvailableApps.Num() > 0 && SelectedAppIndex >= 0; })
+							.IsEnabled_Lambda([this]() { return GetState().Apps->Num() > 0 && SelectedAppIndex >= 0; })
 							[
 								SNew(STextBlock)
 								.Text(LOCTEXT("ManageAppButton", "⚙️ Manage App"))
@@ -453,22 +513,124 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 					.AutoHeight()
 					.Padding(0.0f, 10.0f, 0.0f, 0.0f)
 					[
-						SAssignNew(AppComboBox, SComboBox<TSharedPtr<FString>>)
-						.OptionsSource(&AppNames)
-						.OnSelectionChanged(this, &SGLCManagerWindow::OnAppSelected)
-						.OnGenerateWidget_Lambda([](TSharedPtr<FString> Item)
-						{
-							return SNew(STextBlock)
-								.Text(FText::FromString(*Item))
-								.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12));
-						})
+						SNew(SSearchBox)
+						.HintText(LOCTEXT("SearchAppsHint", "Search apps..."))
+						.OnTextChanged(this, &SGLCManagerWindow::OnAppSearchChanged)
+					]
+					
+					// Only the visible rows are built; further pages load as the list is scrolled
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 5.0f, 0.0f, 0.0f)
+					[
+						SNew(SBox)
+						.MaxDesiredHeight(220.0f)
+						[
+							SAssignNew(AppListView, SListView<TSharedPtr<FString>>)
+							.ListItemsSource(&FilteredAppNames)
+							.SelectionMode(ESelectionMode::Single)
+							.OnGenerateRow(this, &SGLCManagerWindow::OnGenerateAppRow)
+							.OnSelectionChanged(this, &SGLCManagerWindow::OnAppSelected)
+						]
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 5.0f, 0.0f, 0.0f)
+					[
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
 						[
 							SNew(STextBlock)
 							.Text_Lambda([this]()
 							{
-								return SelectedApp.IsValid() ? FText::FromString(*SelectedApp) : LOCTEXT("SelectApp", "Select an app...");
+								return SelectedApp.IsValid()
+									? FText::Format(LOCTEXT("SelectedApp", "Selected: {0}"), FText::FromString(*SelectedApp))
+									: LOCTEXT("SelectApp", "Select an app...");
 							})
-							.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
+							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 11))
+							.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f))
+						]
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						[
+							SNew(STextBlock)
+							.Text_Lambda([this]()
+							{
+								if (GetState().bIsLoadingMoreApps)
+								{
+									return LOCTEXT("LoadingMoreApps", "Loading more apps...");
+								}
+								return FText::Format(GetState().AppsNextCursor.IsEmpty()
+									? LOCTEXT("AppCount", "{0} of {1} apps")
+									: LOCTEXT("AppCountMore", "{0} of {1} apps, scroll for more"),
+									FText::AsNumber(FilteredAppNames.Num()), FText::AsNumber(AppNames.Num()));
+							})
+							.Font(FCoreStyle::GetDefaultFontStyle("Italic", 10))
+							.ColorAndOpacity(FLinearColor(0.6f, 0.7f, 0.8f))
+						]
+					]
+					
+					// Build profile of the selected app
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 10.0f, 0.0f, 0.0f)
+					[
+						SNew(SHorizontalBox)
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0.0f, 0.0f, 10.0f, 0.0f)
+						[
+							SNew(STextBlock)
+							.Text(LOCTEXT("BuildProfileLabel", "🛠️ Build profile"))
+							.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+							.ColorAndOpacity(FLinearColor(0.7f, 0.8f, 0.9f))
+						]
+						
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.Padding(0.0f, 0.0f, 5.0f, 0.0f)
+						[
+							SNew(SComboBox<TSharedPtr<FString>>)
+							.OptionsSource(&BuildModeOptions)
+							.OnSelectionChanged(this, &SGLCManagerWindow::OnBuildModeSelected)
+							.IsEnabled_Lambda([this]() { return !IsBuilding() && BuildProfileAppId != 0; })
+							.ToolTipText(LOCTEXT("BuildModeTooltip", "Fast iteration cooks incrementally, skips compiling when no code changed and skips the build when nothing changed"))
+							.OnGenerateWidget_Lambda([](TSharedPtr<FString> Item)
+							{
+								return SNew(STextBlock)
+									.Text(FText::FromString(*Item))
+									.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11));
+							})
+							[
+								SNew(STextBlock)
+								.Text_Lambda([this]() { return FText::FromString(FGLCBuildProfile::GetModeDisplayName(BuildProfile.Mode)); })
+								.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.Padding(5.0f, 0.0f, 0.0f, 0.0f)
+						[
+							SNew(SComboBox<TSharedPtr<FString>>)
+							.OptionsSource(&BuildConfigurationOptions)
+							.OnSelectionChanged(this, &SGLCManagerWindow::OnBuildConfigurationSelected)
+							.IsEnabled_Lambda([this]() { return !IsBuilding() && BuildProfileAppId != 0; })
+							.OnGenerateWidget_Lambda([](TSharedPtr<FString> Item)
+							{
+								return SNew(STextBlock)
+									.Text(FText::FromString(*Item))
+									.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11));
+							})
+							[
+								SNew(STextBlock)
+								.Text_Lambda([this]() { return FText::FromString(BuildProfile.Configuration); })
+								.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+							]
 						]
 					]
 				]
@@ -493,6 +655,18 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				]
 			]
 			
+			// Build detection in progress
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 15.0f, 0.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ScanningBuild", "🔍 Scanning build folder..."))
+				.Font(FCoreStyle::GetDefaultFontStyle("Italic", 11))
+				.ColorAndOpacity(FLinearColor(0.7f, 0.8f, 0.9f))
+				.Visibility_Lambda([this]() { return (GetState().bIsScanningBuild && !GetState().Build.bHasBuildReady) ? EVisibility::Visible : EVisibility::Collapsed; })
+			]
+			
 			// Build detection card
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -502,7 +676,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
 				.BorderBackgroundColor(FLinearColor(0.15f, 0.3f, 0.2f, 0.85f))
 				.Padding(FMargin(20.0f, 15.0f))
-				.Visibility_Lambda([this]() { return bHasBuildReady ? EVisibility::Visible : EVisibility::Collapsed; })
+				.Visibility_Lambda([this]() { return GetState().Build.bHasBuildReady ? EVisibility::Visible : EVisibility::Collapsed; })
 				[
 					SNew(SVerticalBox)
 					
@@ -522,7 +696,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
 							return FText::Format(LOCTEXT("LastBuildDate", "Last build: {0}"),
-								FText::FromString(LastBuildDate.ToString(TEXT("%Y-%m-%d %H:%M:%S"))));
+								FText::FromString(GetState().Build.LastBuildDate.ToString(TEXT("%Y-%m-%d %H:%M:%S"))));
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
 						.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f))
@@ -534,25 +708,26 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
-							if (bIsCompressed && UncompressedBuildSize > 0)
+							const FGLCBuildSnapshot& Build = GetState().Build;
+							if (Build.bIsCompressed && Build.UncompressedBuildSize > 0)
 							{
-								float compressionRatio = (1.0f - (LastBuildSize / (float)UncompressedBuildSize)) * 100.0f;
+								float compressionRatio = (1.0f - (Build.LastBuildSize / (float)Build.UncompressedBuildSize)) * 100.0f;
 								return FText::Format(LOCTEXT("BuildInfoCompressed", "Files: {0} | Uncompressed: {1} MB | Compressed: {2} MB ({3}% saved)"),
-									FText::AsNumber(TotalFileCount),
-									FText::AsNumber((int32)(UncompressedBuildSize / (1024.0 * 1024.0))),
-									FText::AsNumber((int32)(LastBuildSize / (1024.0 * 1024.0))),
+									FText::AsNumber(Build.TotalFileCount),
+									FText::AsNumber((int32)(Build.UncompressedBuildSize / (1024.0 * 1024.0))),
+									FText::AsNumber((int32)(Build.LastBuildSize / (1024.0 * 1024.0))),
 									FText::AsNumber((int32)compressionRatio));
 							}
-							else if (bIsCompressed)
+							else if (Build.bIsCompressed)
 							{
 								return FText::Format(LOCTEXT("BuildInfoCompressedOnly", "Compressed size: {0} MB"),
-									FText::AsNumber((int32)(LastBuildSize / (1024.0 * 1024.0))));
+									FText::AsNumber((int32)(Build.LastBuildSize / (1024.0 * 1024.0))));
 							}
 							else
 							{
 								return FText::Format(LOCTEXT("BuildInfoUncompressed", "Files: {0} | Size: {1} MB (Not compressed)"),
-									FText::AsNumber(TotalFileCount),
-									FText::AsNumber((int32)(LastBuildSize / (1024.0 * 1024.0))));
+									FText::AsNumber(Build.TotalFileCount),
+									FText::AsNumber((int32)(Build.LastBuildSize / (1024.0 * 1024.0))));
 							}
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
@@ -578,7 +753,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 							return FReply::Handled();
 						})
 						.Visibility_Lambda([this]() { 
-							return (bIsCompressed && FPaths::FileExists(GetZipPath())) ? EVisibility::Visible : EVisibility::Collapsed; 
+							return GetState().Build.bIsCompressed ? EVisibility::Visible : EVisibility::Collapsed; 
 						})
 						[
 							SNew(STextBlock)
@@ -643,11 +818,11 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 					.ForegroundColor(FLinearColor::White)
 					.ContentPadding(FMargin(40.0f, 15.0f))
 					.OnClicked(this, &SGLCManagerWindow::OnBuildOnlyClicked)
-					.IsEnabled_Lambda([this]() { return !bIsBuilding && !bIsUploading && AvailableApps.Num() > 0 && SelectedAppIndex >= 0; })
+					.IsEnabled_Lambda([this]() { return !IsBuilding() && !IsUploading() && GetState().Apps->Num() > 0 && SelectedAppIndex >= 0; })
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
-							return bIsBuilding ? LOCTEXT("Building", "🔨 Building...") : LOCTEXT("BuildButton", "🔨 Build");
+							return IsBuilding() ? LOCTEXT("Building", "🔨 Building...") : LOCTEXT("BuildButton", "🔨 Build");
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 15))
 					]
@@ -663,16 +838,99 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 					.ForegroundColor(FLinearColor::White)
 					.ContentPadding(FMargin(40.0f, 15.0f))
 					.OnClicked(this, &SGLCManagerWindow::OnUploadOnlyClicked)
-					.IsEnabled_Lambda([this]() { return !bIsBuilding && !bIsUploading && bHasBuildReady && AvailableApps.Num() > 0 && SelectedAppIndex >= 0; })
+					.IsEnabled_Lambda([this]() { return !IsBuilding() && !IsUploading() && GetState().Build.bHasBuildReady && GetState().Apps->Num() > 0 && SelectedAppIndex >= 0; })
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
-							return bIsUploading ? LOCTEXT("Uploading", "☁️ Uploading...") : LOCTEXT("UploadButton", "☁️ Upload to Cloud");
+							return IsUploading() ? LOCTEXT("Uploading", "☁️ Uploading...") : LOCTEXT("UploadButton", "☁️ Upload to Cloud");
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 15))
 					]
 				]
 			]
+			
+			// Build matrix: several platforms/configurations built concurrently, each uploaded as its own build
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 15.0f)
+			[
+				SNew(SBorder)
+				.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+				.Padding(FMargin(20.0f, 15.0f))
+				[
+					SNew(SVerticalBox)
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("MatrixTitle", "🧩 Build matrix"))
+						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+						.ColorAndOpacity(FLinearColor(0.9f, 0.95f, 1.0f))
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 5.0f, 0.0f, 0.0f)
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("MatrixInfo", "Builds every selected platform and configuration in parallel and uploads each one as soon as it is ready. Uses the build mode of the profile."))
+						.Font(FCoreStyle::GetDefaultFontStyle("Italic", 11))
+						.ColorAndOpacity(FLinearColor(0.7f, 0.8f, 0.9f))
+						.AutoWrapText(true)
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 10.0f, 0.0f, 0.0f)
+					[
+						ConstructMatrixOptions(FGLCBuildMatrix::GetSupportedPlatforms(), MatrixPlatforms)
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 5.0f, 0.0f, 0.0f)
+					[
+						ConstructMatrixOptions(FGLCBuildProfile::GetConfigurations(), MatrixConfigurations)
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 10.0f, 0.0f, 0.0f)
+					.HAlign(HAlign_Left)
+					[
+						SNew(SButton)
+						.ButtonStyle(FAppStyle::Get(), "FlatButton.Success")
+						.ForegroundColor(FLinearColor::White)
+						.ContentPadding(FMargin(20.0f, 8.0f))
+						.OnClicked(this, &SGLCManagerWindow::OnBuildMatrixClicked)
+						.IsEnabled_Lambda([this]()
+						{
+							return IsMatrixRunning() || (!IsBuilding() && !IsUploading() && GetState().Apps->Num() > 0 && SelectedAppIndex >= 0
+								&& MatrixPlatforms.Num() > 0 && MatrixConfigurations.Num() > 0);
+						})
+						[
+							SNew(STextBlock)
+							.Text_Lambda([this]() {
+								return IsMatrixRunning() ? LOCTEXT("CancelMatrix", "❌ Cancel matrix") : LOCTEXT("MatrixButton", "🧩 Build & upload matrix");
+							})
+							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 13))
+						]
+					]
+					
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 10.0f, 0.0f, 0.0f)
+					[
+						SNew(STextBlock)
+						.Text_Lambda([this]() { return GetMatrixStatusText(); })
+						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+						.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f))
+						.AutoWrapText(true)
+						.Visibility_Lambda([this]() { return MatrixJobs.Num() > 0 ? EVisibility::Visible : EVisibility::Collapsed; })
+					]
+				]
+			]
 		
 			
 			// Progress bar
@@ -683,10 +941,10 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				SNew(SBorder)
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
 				.Padding(FMargin(5.0f))
-				.Visibility_Lambda([this]() { return (bIsBuilding || bIsUploading) ? EVisibility::Visible : EVisibility::Collapsed; })
+				.Visibility_Lambda([this]() { return (IsBuilding() || IsUploading()) ? EVisibility::Visible : EVisibility::Collapsed; })
 				[
 					SAssignNew(UploadProgressBar, SProgressBar)
-					.Percent_Lambda([this]() { return UploadProgress; })
+					.Percent_Lambda([this]() { return GetState().Progress; })
 					.FillColorAndOpacity(FLinearColor(0.2f, 0.7f, 1.0f))
 				]
 			]
@@ -703,7 +961,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				.ContentPadding(FMargin(30.0f, 10.0f))
 				.OnClicked(this, &SGLCManagerWindow::OnCancelUploadClicked)
 				.Visibility_Lambda([this]() { 
-					return (bIsUploading || bIsMonitoringBuild) && CurrentBuildId > 0 ? EVisibility::Visible : EVisibility::Collapsed; 
+					return (IsUploading() || IsMonitoringBuild()) && GetCurrentBuildId() > 0 ? EVisibility::Visible : EVisibility::Collapsed; 
 				})
 				[
 					SNew(STextBlock)
@@ -721,7 +979,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 				.BorderBackgroundColor(FLinearColor(0.2f, 0.3f, 0.4f, 0.85f))
 				.Padding(FMargin(20.0f, 15.0f))
-				.Visibility_Lambda([this]() { return bIsMonitoringBuild ? EVisibility::Visible : EVisibility::Collapsed; })
+				.Visibility_Lambda([this]() { return IsMonitoringBuild() ? EVisibility::Visible : EVisibility::Collapsed; })
 				[
 					SNew(SVerticalBox)
 					
@@ -740,7 +998,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 					[
 						SNew(STextBlock)
 						.Text_Lambda([this]() {
-							return FText::Format(LOCTEXT("MonitoringBuild", "Monitoring Build #{0}..."), FText::AsNumber(CurrentBuildId));
+							return FText::Format(LOCTEXT("MonitoringBuild", "Monitoring Build #{0}..."), FText::AsNumber(GetCurrentBuildId()));
 						})
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
 						.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f))
@@ -759,6 +1017,14 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				]
 			]
 			
+			// Job queue
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 15.0f)
+			[
+				ConstructJobList()
+			]
+			
 			// Loading apps message (only when loading apps)
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -769,7 +1035,7 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 				.BorderBackgroundColor(FLinearColor(0.3f, 0.6f, 0.9f, 0.8f))
 				.Padding(FMargin(20.0f, 12.0f))
-				.Visibility_Lambda([this]() { return bIsLoadingApps ? EVisibility::Visible : EVisibility::Collapsed; })
+				.Visibility_Lambda([this]() { return GetState().bIsLoadingApps ? EVisibility::Visible : EVisibility::Collapsed; })
 				[
 					SNew(STextBlock)
 					.Text(LOCTEXT("LoadingApps", "Loading apps..."))
@@ -788,19 +1054,19 @@ TSharedRef<SWidget> SGLCManagerWindow::ConstructBuildUploadTab()
 				SNew(SBorder)
 				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 				.BorderBackgroundColor_Lambda([this]() {
-					return StatusMessageType == TEXT("Error") ? 
+					return GetState().StatusMessageType == TEXT("Error") ? 
 						FLinearColor(0.8f, 0.2f, 0.2f, 0.8f) : 
-						StatusMessageType == TEXT("Success") ?
+						GetState().StatusMessageType == TEXT("Success") ?
 						FLinearColor(0.2f, 0.7f, 0.3f, 0.8f) :
 						FLinearColor(0.3f, 0.6f, 0.9f, 0.8f);
 				})
 				.Padding(FMargin(20.0f, 12.0f))
 				.Visibility_Lambda([this]() { 
-					return !StatusMessage.IsEmpty() && !bIsLoadingApps ? EVisibility::Visible : EVisibility::Collapsed; 
+					return !GetState().StatusMessage.IsEmpty() && !GetState().bIsLoadingApps ? EVisibility::Visible : EVisibility::Collapsed; 
 				})
 				[
-					SAssignNew(StatusMessageText, STextBlock)
-					.Text(FText::FromString(StatusMessage))
+					SNew(STextBlock)
+					.Text_Lambda([this]() { return StatusText; })
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 					.ColorAndOpacity(FLinearColor::White)
 					.Justification(ETextJustify::Center)
@@ -854,92 +1120,83 @@ FReply SGLCManagerWindow::OnLoginWithApiKeyClicked()
 {
 	if (ApiKeyInput.IsEmpty())
 	{
-		StatusMessage = TEXT("Please enter an API Key");
-		StatusMessageType = TEXT("Error");
-		if (StatusMessageText.IsValid())
-		{
-			StatusMessageText->SetText(FText::FromString(StatusMessage));
-		}
+		ViewModel->SetStatus(TEXT("Please enter an API Key"), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
-	bIsLoggingIn = true;
-	StatusMessage = TEXT("Logging in...");
-	StatusMessageType = TEXT("Info");
-	
-	if (StatusMessageText.IsValid())
+	ViewModel->Update([](FGLCManagerState& State)
 	{
-		StatusMessageText->SetText(FText::FromString(StatusMessage));
-	}
+		State.bIsLoggingIn = true;
+		State.StatusMessage = TEXT("Logging in...");
+		State.StatusMessageType = TEXT("Info");
+	});
 	
-	ApiClient->LoginWithApiKeyAsync(ApiKeyInput, [this](bool bSuccess, FString Message, FGLCLoginResponse Response)
+	// The response may arrive after the window was closed
+	TWeakPtr<SGLCManagerWindow> WeakWindow = StaticCastSharedRef<SGLCManagerWindow>(AsShared());
+	ApiClient->LoginWithApiKeyAsync(ApiKeyInput, [WeakWindow](bool bSuccess, FString Message, FGLCLoginResponse Response)
 	{
-		bIsLoggingIn = false;
+		TSharedPtr<SGLCManagerWindow> Window = WeakWindow.Pin();
+		if (!Window.IsValid())
+		{
+			return;
+		}
 		
-		if (bSuccess)
+		if (!bSuccess)
 		{
-			bIsAuthenticated = true;
-			AuthToken = Response.Token;
-			UserEmail = Response.Email;
-			// Extract plan name
-			if (!Response.PlanName.IsEmpty())
-			{
-				UserPlan = Response.PlanName;
-			}
-			else
+			Window->ViewModel->Update([Message](FGLCManagerState& State)
 			{
-				UserPlan = TEXT("Free");
-			}
-			ApiClient->SetAuthToken(AuthToken);
+				State.bIsLoggingIn = false;
+				State.StatusMessage = Message;
+				State.StatusMessageType = TEXT("Error");
+			});
+			return;
+		}
+		
+		Window->AuthToken = Response.Token;
+		Window->ApiClient->SetAuthToken(Window->AuthToken);
+		Window->ViewModel->Update([Response](FGLCManagerState& State)
+		{
+			State.bIsLoggingIn = false;
+			State.bIsAuthenticated = true;
+			State.UserEmail = Response.Email;
+			// Extract plan name
+			State.UserPlan = Response.PlanName.IsEmpty() ? TEXT("Free") : Response.PlanName;
+			State.StatusMessage = TEXT("Login successful!");
+			State.StatusMessageType = TEXT("Success");
+		});
+		
+		// Save API key to config (before SaveConfig to ensure it's preserved)
+		if (!Window->ApiKeyInput.IsEmpty())
+		{
+			// Load existing config
+			FString ConfigPath = FGLCSettings::GetConfigPath();
+			FString ExistingContent;
+			TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
 			
-			// Save API key to config (before SaveConfig to ensure it's preserved)
-			if (!ApiKeyInput.IsEmpty())
+			if (FFileHelper::LoadFileToString(ExistingContent, *ConfigPath))
 			{
-				// Load existing config
-				FString ConfigPath = FPaths::ProjectPluginsDir() / TEXT("GameLauncherCloud/Config/glc_config.json");
-				FString ExistingContent;
-				TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-				
-				if (FFileHelper::LoadFileToString(ExistingContent, *ConfigPath))
+				TSharedPtr<FJsonObject> ExistingJson;
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ExistingContent);
+				if (FJsonSerializer::Deserialize(Reader, ExistingJson) && ExistingJson.IsValid())
 				{
-					TSharedPtr<FJsonObject> ExistingJson;
-					TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ExistingContent);
-					if (FJsonSerializer::Deserialize(Reader, ExistingJson) && ExistingJson.IsValid())
-					{
-						JsonObject = ExistingJson;
-					}
+					JsonObject = ExistingJson;
 				}
-				
-				// Save API key for Production environment
-				JsonObject->SetStringField(TEXT("apiKeyProduction"), ApiKeyInput);
-				
-				FString OutputString;
-				TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-				FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-				FFileHelper::SaveStringToFile(OutputString, *ConfigPath);
 			}
 			
-			SaveConfig();
-			
-			StatusMessage = TEXT("Login successful!");
-			StatusMessageType = TEXT("Success");
-			
-			// Refresh UI to show build/upload interface
-			RefreshUI();
-			
-			// Auto-load apps after successful login
-			OnLoadAppsClicked();
-		}
-		else
-		{
-			StatusMessage = Message;
-			StatusMessageType = TEXT("Error");
+			// Save API key for Production environment
+			JsonObject->SetStringField(TEXT("apiKeyProduction"), Window->ApiKeyInput);
 			
-			if (StatusMessageText.IsValid())
-			{
-				StatusMessageText->SetText(FText::FromString(StatusMessage));
-			}
+			FString OutputString;
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+			FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+			FFileHelper::SaveStringToFile(OutputString, *ConfigPath);
 		}
+		
+		Window->SaveConfig();
+		
+		// Auto-load apps and check builds after successful login
+		Window->CheckForExistingBuild();
+		Window->OnLoadAppsClicked();
 	});
 	
 	return FReply::Handled();
@@ -947,92 +1204,123 @@ FReply SGLCManagerWindow::OnLoginWithApiKeyClicked()
 
 FReply SGLCManagerWindow::OnLogoutClicked()
 {
-	bIsAuthenticated = false;
 	AuthToken.Empty();
-	UserEmail.Empty();
-	UserPlan.Empty();
 	// Keep ApiKeyInput - don't clear it so it shows in login screen
-	AvailableApps.Empty();
-	AppNames.Empty();
+	ViewModel->Update([](FGLCManagerState& State)
+	{
+		State.bIsAuthenticated = false;
+		State.UserEmail.Empty();
+		State.UserPlan.Empty();
+		State.Apps = MakeShared<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe>();
+		State.StatusMessage.Empty();
+	});
+	ApiClient->SetAuthToken(AuthToken);
 	SaveConfig();
 	
-	StatusMessage.Empty();
-	
-	// Refresh UI to show login interface
-	RefreshUI();
-	
 	return FReply::Handled();
 }
 
 FReply SGLCManagerWindow::OnLoadAppsClicked()
 {
-	bIsLoadingApps = true;
-	StatusMessage = TEXT("Loading apps...");
-	StatusMessageType = TEXT("Info");
+	// Starts over from the first page; the list fills again as pages arrive
+	ViewModel->Update([](FGLCManagerState& State)
+	{
+		State.bIsLoadingApps = true;
+		State.bIsLoadingMoreApps = false;
+		State.Apps = MakeShared<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe>();
+		State.AppsNextCursor.Empty();
+		State.StatusMessage = TEXT("Loading apps...");
+		State.StatusMessageType = TEXT("Info");
+	});
 	
 	UE_LOG(LogTemp, Log, TEXT("[GLC] Loading apps..."));
 	
-	ApiClient->GetAppListAsync([this](bool bSuccess, FString Message, TArray<FGLCAppInfo> Apps)
+	LoadAppsPage(FString());
+	return FReply::Handled();
+}
+
+void SGLCManagerWindow::LoadMoreApps()
+{
+	const FString Cursor = GetState().AppsNextCursor;
+	if (Cursor.IsEmpty() || GetState().bIsLoadingApps || GetState().bIsLoadingMoreApps)
+	{
+		return;
+	}
+	
+	ViewModel->Update([](FGLCManagerState& State) { State.bIsLoadingMoreApps = true; });
+	LoadAppsPage(Cursor);
+}
+
+void SGLCManagerWindow::LoadAppsPage(const FString& Cursor)
+{
+	// A reload supersedes the pages still on their way
+	const int32 Request = ++AppListRequest;
+	const bool bFirstPage = Cursor.IsEmpty();
+	
+	// Already called on the game thread; the window may be gone by then
+	TWeakPtr<SGLCManagerWindow> WeakWindow = StaticCastSharedRef<SGLCManagerWindow>(AsShared());
+	ApiClient->GetAppListAsync(Cursor, FGLCSettings::Load().AppListPageSize, [WeakWindow, Request, bFirstPage](bool bSuccess, FString Message, FGLCAppListPage Page)
 	{
-		// Execute on game thread to update UI properly
-		AsyncTask(ENamedThreads::GameThread, [this, bSuccess, Message, Apps]()
+		TSharedPtr<SGLCManagerWindow> Window = WeakWindow.Pin();
+		if (!Window.IsValid() || Request != Window->AppListRequest)
 		{
-			bIsLoadingApps = false;
-			
-			if (bSuccess)
-			{
-				AvailableApps = Apps;
-				AppNames.Empty();
-				
-				for (const FGLCAppInfo& App : Apps)
-				{
-					AppNames.Add(MakeShareable(new FString(App.Name)));
-				}
-				
-				if (Apps.Num() > 0)
-				{
-					SelectedApp = AppNames[0];
-					SelectedAppIndex = 0;
-					StatusMessage = FString::Printf(TEXT("✓ Loaded %d apps successfully"), Apps.Num());
-					StatusMessageType = TEXT("Success");
-					UE_LOG(LogTemp, Log, TEXT("[GLC] Successfully loaded %d apps"), Apps.Num());
-				}
-				else
-				{
-					StatusMessage = TEXT("No apps found. Create an app in the Game Launcher Cloud dashboard first.");
-					StatusMessageType = TEXT("Warning");
-					UE_LOG(LogTemp, Warning, TEXT("[GLC] No apps found"));
-				}
-				
-				if (AppComboBox.IsValid())
-				{
-					AppComboBox->RefreshOptions();
-				}
-			}
-			else
+			return;
+		}
+		
+		if (!bSuccess)
+		{
+			// The cursor is kept, so scrolling to the end again retries the page
+			Window->ViewModel->Update([Message](FGLCManagerState& State)
 			{
-				StatusMessage = FString::Printf(TEXT("Failed to load apps: %s"), *Message);
-				StatusMessageType = TEXT("Error");
-				UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to load apps: %s"), *Message);
-			}
+				State.bIsLoadingApps = false;
+				State.bIsLoadingMoreApps = false;
+				State.StatusMessage = FString::Printf(TEXT("Failed to load apps: %s"), *Message);
+				State.StatusMessageType = TEXT("Error");
+			});
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to load apps: %s"), *Message);
+			return;
+		}
+		
+		FGLCManagerState::FAppsRef PageApps = MakeShared<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe>(MoveTemp(Page.Apps));
+		Window->ViewModel->Update([PageApps, NextCursor = Page.NextCursor, bFirstPage](FGLCManagerState& State)
+		{
+			// Pages only ever append, so the list widgets only add rows
+			TArray<FGLCAppInfo> Apps;
+			Apps.Reserve(State.Apps->Num() + PageApps->Num());
+			Apps.Append(*State.Apps);
+			Apps.Append(*PageApps);
+			State.Apps = MakeShared<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe>(MoveTemp(Apps));
+			State.AppsNextCursor = NextCursor;
+			State.bIsLoadingApps = false;
+			State.bIsLoadingMoreApps = false;
 			
-			// Force UI refresh
-			if (StatusMessageText.IsValid())
+			if (bFirstPage)
 			{
-				StatusMessageText->SetText(FText::FromString(StatusMessage));
+				State.StatusMessage = PageApps->Num() == 0
+					? TEXT("No apps found. Create an app in the Game Launcher Cloud dashboard first.")
+					: NextCursor.IsEmpty()
+					? FString::Printf(TEXT("✓ Loaded %d apps successfully"), PageApps->Num())
+					: FString::Printf(TEXT("✓ Loaded the first %d apps, more load as you scroll"), PageApps->Num());
+				State.StatusMessageType = PageApps->Num() > 0 ? TEXT("Success") : TEXT("Warning");
 			}
 		});
+		
+		if (PageApps->Num() > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Successfully loaded %d apps (%d in total)"), PageApps->Num(), Window->GetState().Apps->Num());
+		}
+		else if (bFirstPage)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] No apps found"));
+		}
 	});
-	
-	return FReply::Handled();
 }
 
 FReply SGLCManagerWindow::OnBuildAndUploadClicked()
 {
-	if (AvailableApps.Num() == 0 || SelectedAppIndex < 0 || SelectedAppIndex >= AvailableApps.Num())
+	if (!GetState().Apps->IsValidIndex(SelectedAppIndex))
 	{
-		StatusMessage = TEXT("Please select an app first");
-		StatusMessageType = TEXT("Error");
+		ViewModel->SetStatus(TEXT("Please select an app first"), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
@@ -1041,34 +1329,352 @@ FReply SGLCManagerWindow::OnBuildAndUploadClicked()
 	// 2. Compress the build into a ZIP
 	// 3. Upload to Game Launcher Cloud
 	
-	StatusMessage = TEXT("Build & Upload feature requires full UAT integration.\n")
-		TEXT("This is a demonstration version. Full implementation coming soon!");
-	StatusMessageType = TEXT("Info");
+	ViewModel->SetStatus(TEXT("Build & Upload feature requires full UAT integration.\n")
+		TEXT("This is a demonstration version. Full implementation coming soon!"), TEXT("Info"));
 	
 	return FReply::Handled();
 }
 
 void SGLCManagerWindow::OnAppSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo)
 {
-	SelectedApp = NewSelection;
-	
-	for (int32 i = 0; i < AppNames.Num(); i++)
+	// The list drops its selection when a search hides the app; the app stays selected
+	if (!NewSelection.IsValid())
 	{
-		if (AppNames[i] == NewSelection)
+		return;
+	}
+	
+	SelectedApp = NewSelection;
+	SelectedAppIndex = AppNames.Find(NewSelection);
+	SyncBuildProfile();
+}
+
+void SGLCManagerWindow::OnAppSearchChanged(const FText& SearchText)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SGLCManagerWindow::OnAppSearchChanged);
+	
+	const FString NewFilter = SearchText.ToString().TrimStartAndEnd();
+	
+	// Typing on can only narrow the matches, so only those are searched again
+	const bool bNarrowing = !AppFilter.IsEmpty() && NewFilter.Contains(AppFilter);
+	AppFilter = NewFilter;
+	AppFilterText = FText::FromString(AppFilter);
+	
+	TArray<TSharedPtr<FString>> Candidates = bNarrowing ? MoveTemp(FilteredAppNames) : AppNames;
+	FilteredAppNames.Reset();
+	for (const TSharedPtr<FString>& Name : Candidates)
+	{
+		if (MatchesAppFilter(*Name))
+		{
+			FilteredAppNames.Add(Name);
+		}
+	}
+	
+	if (AppListView.IsValid())
+	{
+		AppListView->RequestListRefresh();
+	}
+	
+	// Nothing to scroll to, so the pages not loaded yet are searched right away
+	if (FilteredAppNames.Num() == 0)
+	{
+		LoadMoreApps();
+	}
+}
+
+bool SGLCManagerWindow::MatchesAppFilter(const FString& Name) const
+{
+	return AppFilter.IsEmpty() || Name.Contains(AppFilter);
+}
+
+TSharedRef<ITableRow> SGLCManagerWindow::OnGenerateAppRow(TSharedPtr<FString> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	// Rows are only generated as they come into view, so reaching the last one asks for the next page
+	if (Item == FilteredAppNames.Last())
+	{
+		LoadMoreApps();
+	}
+	
+	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+		.Padding(FMargin(8.0f, 4.0f))
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(*Item))
+			.HighlightText_Lambda([this]() { return AppFilterText; })
+			.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
+		];
+}
+
+void SGLCManagerWindow::SyncBuildProfile()
+{
+	if (!GetState().Apps->IsValidIndex(SelectedAppIndex))
+	{
+		return;
+	}
+	
+	int64 AppId = (*GetState().Apps)[SelectedAppIndex].Id;
+	if (AppId != BuildProfileAppId)
+	{
+		BuildProfileAppId = AppId;
+		BuildProfile = FGLCBuildProfile::LoadForApp(AppId);
+	}
+}
+
+void SGLCManagerWindow::OnBuildModeSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo)
+{
+	if (!NewSelection.IsValid() || BuildProfileAppId == 0)
+	{
+		return;
+	}
+	
+	BuildProfile.Mode = (NewSelection == BuildModeOptions[1]) ? EGLCBuildMode::FastIteration : EGLCBuildMode::Full;
+	FGLCBuildProfile::SaveForApp(BuildProfileAppId, BuildProfile);
+}
+
+void SGLCManagerWindow::OnBuildConfigurationSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo)
+{
+	if (!NewSelection.IsValid() || BuildProfileAppId == 0)
+	{
+		return;
+	}
+	
+	BuildProfile.Configuration = *NewSelection;
+	FGLCBuildProfile::SaveForApp(BuildProfileAppId, BuildProfile);
+}
+
+TSharedRef<SWidget> SGLCManagerWindow::ConstructMatrixOptions(const TArray<FString>& Options, TSet<FString>& Selection)
+{
+	TSharedRef<SHorizontalBox> Row = SNew(SHorizontalBox);
+	
+	for (const FString& Option : Options)
+	{
+		Row->AddSlot()
+		.AutoWidth()
+		.Padding(0.0f, 0.0f, 15.0f, 0.0f)
+		[
+			SNew(SCheckBox)
+			.IsChecked_Lambda([&Selection, Option]() { return Selection.Contains(Option) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged_Lambda([&Selection, Option](ECheckBoxState NewState)
+			{
+				if (NewState == ECheckBoxState::Checked)
+				{
+					Selection.Add(Option);
+				}
+				else
+				{
+					Selection.Remove(Option);
+				}
+			})
+			.IsEnabled_Lambda([this]() { return !IsMatrixRunning(); })
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Option))
+				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+			]
+		];
+	}
+	
+	return Row;
+}
+
+// ========== BUILD MATRIX ========== //
+
+bool SGLCManagerWindow::IsMatrixRunning() const
+{
+	const FGLCJobScheduler& Scheduler = GetJobScheduler();
+	for (const FGLCBuildMatrixJobs& Jobs : MatrixJobs)
+	{
+		for (int64 JobId : Jobs.JobIds)
+		{
+			FGLCJobPtr Job = Scheduler.FindJob(JobId);
+			if (Job.IsValid() && !Job->IsDone())
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool SGLCManagerWindow::IsMatrixJob(int64 JobId) const
+{
+	return MatrixJobs.ContainsByPredicate([JobId](const FGLCBuildMatrixJobs& Jobs) { return Jobs.JobIds.Contains(JobId); });
+}
+
+FReply SGLCManagerWindow::OnBuildMatrixClicked()
+{
+	if (IsMatrixRunning())
+	{
+		ViewModel->SetStatus(TEXT("Cancelling build matrix..."), TEXT("Info"));
+		
+		// Cancelling a job cancels the jobs waiting for it; finished ones are left alone
+		FGLCJobScheduler& Scheduler = GetJobScheduler();
+		for (const FGLCBuildMatrixJobs& Jobs : MatrixJobs)
+		{
+			for (int64 JobId : Jobs.JobIds)
+			{
+				Scheduler.Cancel(JobId);
+			}
+		}
+		return FReply::Handled();
+	}
+	
+	if (!ApiClient.IsValid() || !GetState().Apps->IsValidIndex(SelectedAppIndex))
+	{
+		ViewModel->SetStatus(TEXT("Please select a valid app"), TEXT("Error"));
+		return FReply::Handled();
+	}
+	
+	SyncBuildProfile();
+	
+	// Keep the option order rather than the set order
+	TArray<FGLCBuildMatrixEntry> Entries;
+	for (const FString& Platform : FGLCBuildMatrix::GetSupportedPlatforms())
+	{
+		for (const FString& Configuration : FGLCBuildProfile::GetConfigurations())
+		{
+			if (MatrixPlatforms.Contains(Platform) && MatrixConfigurations.Contains(Configuration))
+			{
+				FGLCBuildMatrixEntry& Entry = Entries.AddDefaulted_GetRef();
+				Entry.Platform = Platform;
+				Entry.Configuration = Configuration;
+			}
+		}
+	}
+	
+	if (Entries.Num() == 0)
+	{
+		ViewModel->SetStatus(TEXT("Select at least one platform and one configuration"), TEXT("Error"));
+		return FReply::Handled();
+	}
+	
+	ViewModel->Update([Message = FString::Printf(TEXT("Queueing build matrix (%d builds)..."), Entries.Num())](FGLCManagerState& State)
+	{
+		State.StatusMessage = Message;
+		State.StatusMessageType = TEXT("Info");
+		State.Progress = 0.0f;
+	});
+	
+	// The jobs report through OnJobChanged and keep running when the window is closed
+	FString Notes = BuildNotesInput.IsEmpty() ? TEXT("Uploaded from Unreal Engine Extension") : BuildNotesInput;
+	bMatrixFinished = false;
+	MatrixJobs = FGLCBuildMatrix::Submit(GetJobScheduler(), (*GetState().Apps)[SelectedAppIndex].Id, Notes, BuildProfile.Mode, Entries, FGLCSettings::Load());
+	
+	return FReply::Handled();
+}
+
+void SGLCManagerWindow::OnMatrixChanged()
+{
+	if (MatrixJobs.Num() == 0 || bMatrixFinished)
+	{
+		return;
+	}
+	
+	// An entry is done once its last job is; the others count with their progress
+	const FGLCJobScheduler& Scheduler = GetJobScheduler();
+	float TotalProgress = 0.0f;
+	int32 DoneCount = 0;
+	for (const FGLCBuildMatrixJobs& Jobs : MatrixJobs)
+	{
+		for (int64 JobId : Jobs.JobIds)
 		{
-			SelectedAppIndex = i;
-			break;
+			FGLCJobPtr Job = Scheduler.FindJob(JobId);
+			TotalProgress += (!Job.IsValid() || Job->IsDone() ? 1.0f : Job->GetProgress()) / Jobs.JobIds.Num();
 		}
+		
+		FGLCJobPtr LastJob = Scheduler.FindJob(Jobs.JobIds.Last());
+		DoneCount += !LastJob.IsValid() || LastJob->IsDone() ? 1 : 0;
+	}
+	
+	if (DoneCount == MatrixJobs.Num())
+	{
+		OnMatrixFinished();
+		return;
+	}
+	
+	const float Progress = TotalProgress / MatrixJobs.Num();
+	ViewModel->Update([Progress, Message = FString::Printf(TEXT("Build matrix: %d of %d done (%d%%)..."), DoneCount, MatrixJobs.Num(), FMath::RoundToInt(Progress * 100.0f))](FGLCManagerState& State)
+	{
+		State.Progress = Progress;
+		State.StatusMessage = Message;
+		State.StatusMessageType = TEXT("Info");
+	});
+}
+
+void SGLCManagerWindow::OnMatrixFinished()
+{
+	bMatrixFinished = true;
+	
+	const FGLCJobScheduler& Scheduler = GetJobScheduler();
+	int32 SucceededCount = 0;
+	for (const FGLCBuildMatrixJobs& Jobs : MatrixJobs)
+	{
+		FGLCJobPtr UploadJob = Scheduler.FindJob(Jobs.JobIds.Last());
+		SucceededCount += UploadJob.IsValid() && UploadJob->GetState() == EGLCJobState::Succeeded ? 1 : 0;
+	}
+	
+	const bool bAllSucceeded = SucceededCount == MatrixJobs.Num();
+	FString Message = bAllSucceeded
+		? FString::Printf(TEXT("✓ Build matrix uploaded %d builds"), SucceededCount)
+		: FString::Printf(TEXT("Build matrix finished: %d of %d builds uploaded"), SucceededCount, MatrixJobs.Num());
+	UE_LOG(LogTemp, Log, TEXT("[GLC] %s"), *Message);
+	ViewModel->Update([bAllSucceeded, Message](FGLCManagerState& State)
+	{
+		State.Progress = bAllSucceeded ? 1.0f : 0.0f;
+		State.StatusMessage = Message;
+		State.StatusMessageType = bAllSucceeded ? TEXT("Success") : TEXT("Error");
+	});
+}
+
+FText SGLCManagerWindow::GetMatrixStatusText() const
+{
+	const FGLCJobScheduler& Scheduler = GetJobScheduler();
+	FString Text;
+	for (const FGLCBuildMatrixJobs& Jobs : MatrixJobs)
+	{
+		// The entry is where its first unfinished job is, or where its chain stopped
+		FGLCJobPtr CurrentJob;
+		for (int64 JobId : Jobs.JobIds)
+		{
+			CurrentJob = Scheduler.FindJob(JobId);
+			if (!CurrentJob.IsValid() || CurrentJob->GetState() != EGLCJobState::Succeeded)
+			{
+				break;
+			}
+		}
+		
+		const TCHAR* Icon = TEXT("⏳");
+		FString Message = TEXT("Removed from the job list");
+		if (CurrentJob.IsValid())
+		{
+			Message = CurrentJob->GetMessage();
+			switch (CurrentJob->GetState())
+			{
+			case EGLCJobState::Running: Icon = CurrentJob->GetType() == EGLCJobType::Upload ? TEXT("☁️") : TEXT("🔨"); break;
+			case EGLCJobState::Succeeded: Icon = TEXT("✓"); break;
+			case EGLCJobState::Failed: Icon = TEXT("❌"); break;
+			case EGLCJobState::Cancelled: Icon = TEXT("⛔"); break;
+			case EGLCJobState::Paused: Icon = TEXT("⏸"); break;
+			default: break;
+			}
+		}
+		
+		if (!Text.IsEmpty())
+		{
+			Text += TEXT("\n");
+		}
+		Text += FString::Printf(TEXT("%s %s: %s"), Icon, *Jobs.Entry.GetName(), *Message);
 	}
+	
+	return FText::FromString(Text);
 }
 
 void SGLCManagerWindow::SaveConfig()
 {
-	FString ConfigPath = FPaths::ProjectPluginsDir() / TEXT("GameLauncherCloud/Config/glc_config.json");
+	FString ConfigPath = FGLCSettings::GetConfigPath();
 	
 	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
 	
-	// Load existing config to preserve API keys
+	// Load existing config to preserve API keys and tuning options (see FGLCSettings)
 	FString ExistingContent;
 	if (FFileHelper::LoadFileToString(ExistingContent, *ConfigPath))
 	{
@@ -1076,19 +1682,13 @@ void SGLCManagerWindow::SaveConfig()
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ExistingContent);
 		if (FJsonSerializer::Deserialize(Reader, ExistingJson) && ExistingJson.IsValid())
 		{
-			// Preserve API keys from existing config
-			FString ApiKeyProduction;
-			ExistingJson->TryGetStringField(TEXT("apiKeyProduction"), ApiKeyProduction);
-			if (!ApiKeyProduction.IsEmpty())
-			{
-				JsonObject->SetStringField(TEXT("apiKeyProduction"), ApiKeyProduction);
-			}
+			JsonObject = ExistingJson;
 		}
 	}
 	
 	JsonObject->SetStringField(TEXT("authToken"), AuthToken);
-	JsonObject->SetStringField(TEXT("userEmail"), UserEmail);
-	JsonObject->SetStringField(TEXT("userPlan"), UserPlan);
+	JsonObject->SetStringField(TEXT("userEmail"), GetState().UserEmail);
+	JsonObject->SetStringField(TEXT("userPlan"), GetState().UserPlan);
 	JsonObject->SetStringField(TEXT("apiUrl"), ApiUrl);
 	
 	FString OutputString;
@@ -1100,7 +1700,7 @@ void SGLCManagerWindow::SaveConfig()
 
 void SGLCManagerWindow::LoadConfig()
 {
-	FString ConfigPath = FPaths::ProjectPluginsDir() / TEXT("GameLauncherCloud/Config/glc_config.json");
+	FString ConfigPath = FGLCSettings::GetConfigPath();
 	
 	FString FileContent;
 	if (FFileHelper::LoadFileToString(FileContent, *ConfigPath))
@@ -1110,9 +1710,11 @@ void SGLCManagerWindow::LoadConfig()
 		
 		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
 		{
+			FString LoadedEmail;
+			FString LoadedPlan;
 			JsonObject->TryGetStringField(TEXT("authToken"), AuthToken);
-			JsonObject->TryGetStringField(TEXT("userEmail"), UserEmail);
-			JsonObject->TryGetStringField(TEXT("userPlan"), UserPlan);
+			JsonObject->TryGetStringField(TEXT("userEmail"), LoadedEmail);
+			JsonObject->TryGetStringField(TEXT("userPlan"), LoadedPlan);
 			JsonObject->TryGetStringField(TEXT("apiUrl"), ApiUrl);
 			
 			// Load API Key for current environment (Production)
@@ -1123,10 +1725,13 @@ void SGLCManagerWindow::LoadConfig()
 				ApiKeyInput = ApiKeyProduction;
 			}
 			
-			if (!AuthToken.IsEmpty())
+			const bool bHasToken = !AuthToken.IsEmpty();
+			ViewModel->Update([bHasToken, LoadedEmail, LoadedPlan](FGLCManagerState& State)
 			{
-				bIsAuthenticated = true;
-			}
+				State.bIsAuthenticated = bHasToken;
+				State.UserEmail = LoadedEmail;
+				State.UserPlan = LoadedPlan;
+			});
 		}
 	}
 }
@@ -1136,167 +1741,136 @@ FString SGLCManagerWindow::GetBuildDirectory() const
 	return FPaths::ProjectDir() / TEXT("Builds");
 }
 
-int64 SGLCManagerWindow::GetDirectorySize(const FString& DirectoryPath)
+void SGLCManagerWindow::OnStateChanged(const FGLCManagerViewModel::FStateRef& State)
 {
-	int64 TotalSize = 0;
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TRACE_CPUPROFILER_EVENT_SCOPE(SGLCManagerWindow::OnStateChanged);
 	
-	PlatformFile.IterateDirectoryRecursively(*DirectoryPath, [&TotalSize](const TCHAR* FilenameOrDirectory, bool bIsDirectory) -> bool
-	{
-		if (!bIsDirectory)
-		{
-			TotalSize += IFileManager::Get().FileSize(FilenameOrDirectory);
-		}
-		return true;
-	});
+	// Replaced first, as a section refresh may change the state again
+	TSharedPtr<const FGLCManagerState, ESPMode::ThreadSafe> Previous = ShownState;
+	ShownState = State;
 	
-	return TotalSize;
-}
-
-void SGLCManagerWindow::RefreshUI()
-{
-	if (!MainContentBox.IsValid())
+	// Each section is only touched when its own data changed; texts are cached so Slate sees identical text otherwise
+	if (!Previous.IsValid() || !State->StatusMessage.Equals(Previous->StatusMessage, ESearchCase::CaseSensitive))
 	{
-		return;
+		StatusText = FText::FromString(State->StatusMessage);
 	}
 	
-	// Clear existing content
-	MainContentBox->ClearChildren();
-	
-	// Check for existing build before refreshing
-	CheckForExistingBuild();
-	
-	// Add new content based on authentication state
-	MainContentBox->AddSlot()
-	.AutoHeight()
-	[
-		SNew(SBorder)
-		.Padding(20.0f)
-		[
-			bIsAuthenticated ? ConstructBuildUploadTab() : ConstructLoginTab()
-		]
-	];
+	if (!Previous.IsValid() || !State->UserEmail.Equals(Previous->UserEmail, ESearchCase::CaseSensitive))
+	{
+		WelcomeText = FText::Format(LOCTEXT("WelcomeMessage", "👋 Welcome, {0}!"), FText::FromString(State->UserEmail));
+	}
 	
-	// Add tips section
-	MainContentBox->AddSlot()
-	.AutoHeight()
-	.Padding(0.0f, 20.0f, 0.0f, 0.0f)
-	[
-		ConstructTipsTab()
-	];
+	if (!Previous.IsValid() || State->Apps != Previous->Apps)
+	{
+		RefreshAppNames(*State->Apps);
+	}
 }
 
-FString SGLCManagerWindow::GetBuildSourcePath() const
+void SGLCManagerWindow::RefreshAppNames(const TArray<FGLCAppInfo>& Apps)
 {
-	FString BaseUploadPath = FPaths::ProjectDir() / TEXT("Builds/GLC_Upload");
-	FString WindowsPath = BaseUploadPath / TEXT("Windows");
-	FString MacPath = BaseUploadPath / TEXT("Mac");
-	FString LinuxPath = BaseUploadPath / TEXT("Linux");
+	TRACE_CPUPROFILER_EVENT_SCOPE(SGLCManagerWindow::RefreshAppNames);
 	
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	// Pages only append; a shorter list means the apps are being reloaded
+	if (Apps.Num() < AppNames.Num())
+	{
+		AppNames.Reset();
+		FilteredAppNames.Reset();
+		SelectedApp.Reset();
+		SelectedAppIndex = INDEX_NONE;
+	}
 	
-	if (PlatformFile.DirectoryExists(*WindowsPath))
+	const int32 FirstNewIndex = AppNames.Num();
+	int32 NewMatches = 0;
+	for (int32 Index = FirstNewIndex; Index < Apps.Num(); Index++)
 	{
-		return WindowsPath;
+		TSharedPtr<FString> Name = MakeShareable(new FString(Apps[Index].Name));
+		AppNames.Add(Name);
+		if (MatchesAppFilter(*Name))
+		{
+			FilteredAppNames.Add(Name);
+			NewMatches++;
+		}
 	}
-	else if (PlatformFile.DirectoryExists(*MacPath))
+	
+	// The first app is selected until the user picks one
+	if (!SelectedApp.IsValid() && AppNames.Num() > 0)
 	{
-		return MacPath;
+		SelectedApp = AppNames[0];
+		SelectedAppIndex = 0;
+		SyncBuildProfile();
 	}
-	else if (PlatformFile.DirectoryExists(*LinuxPath))
+	
+	if (AppListView.IsValid())
 	{
-		return LinuxPath;
+		AppListView->RequestListRefresh();
+		if (SelectedApp.IsValid() && FirstNewIndex == 0)
+		{
+			AppListView->SetSelection(SelectedApp, ESelectInfo::Direct);
+		}
 	}
 	
-	return BaseUploadPath;
+	// A page without matches adds no row to scroll to, so a search keeps going through the pages
+	if (NewMatches == 0 && FirstNewIndex < Apps.Num())
+	{
+		LoadMoreApps();
+	}
+}
+
+FString SGLCManagerWindow::GetBuildSourcePath() const
+{
+	// The window builds for the editor's platform
+	return FGLCBuildJob::GetBuildOutputPath(FGLCBuildJob::GetArchiveDirectory(), FGLCBuildJob::GetHostPlatform());
 }
 
 FString SGLCManagerWindow::GetZipPath() const
 {
-	return FPaths::ProjectDir() / TEXT("Builds") / FString::Printf(TEXT("%s_upload.zip"), FApp::GetProjectName());
+	return FGLCCompressJob::GetDefaultZipPath();
 }
 
 void SGLCManagerWindow::CheckForExistingBuild()
 {
-	FString ZipPath = GetZipPath();
-	FString BuildPath = GetBuildSourcePath();
+	ViewModel->Update([](FGLCManagerState& State) { State.bIsScanningBuild = true; });
 	
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	
-	// Check if compressed build exists
-	if (PlatformFile.FileExists(*ZipPath))
+	// Scan in the background; the widget may be closed before the result arrives
+	TWeakPtr<SGLCManagerWindow> WeakWindow = StaticCastSharedRef<SGLCManagerWindow>(AsShared());
+	BuildScanner->RequestScan(GetZipPath(), GetBuildSourcePath(), [WeakWindow](FGLCBuildScanner::FSnapshotPtr Snapshot)
 	{
-		bHasBuildReady = true;
-		LastBuildDate = PlatformFile.GetTimeStamp(*ZipPath);
-		LastBuildPath = ZipPath;
-		LastBuildSize = PlatformFile.FileSize(*ZipPath);
-		bIsCompressed = true;
-		
-		// Get uncompressed size and file count from build directory if it exists
-		if (!BuildPath.IsEmpty() && PlatformFile.DirectoryExists(*BuildPath))
-		{
-			TArray<FString> Files;
-			PlatformFile.FindFilesRecursively(Files, *BuildPath, nullptr);
-			TotalFileCount = Files.Num();
-			
-			UncompressedBuildSize = 0;
-			for (const FString& File : Files)
-			{
-				UncompressedBuildSize += PlatformFile.FileSize(*File);
-			}
-		}
-		else
+		TSharedPtr<SGLCManagerWindow> Window = WeakWindow.Pin();
+		if (!Window.IsValid() || !Snapshot.IsValid())
 		{
-			TotalFileCount = 0;
-			UncompressedBuildSize = 0;
+			return;
 		}
-	}
-	// Check if uncompressed build exists
-	else if (!BuildPath.IsEmpty() && PlatformFile.DirectoryExists(*BuildPath))
-	{
-		bHasBuildReady = true;
-		LastBuildDate = PlatformFile.GetTimeStamp(*BuildPath);
-		LastBuildPath = BuildPath;
-		bIsCompressed = false;
 		
-		// Calculate directory size and file count
-		TArray<FString> Files;
-		PlatformFile.FindFilesRecursively(Files, *BuildPath, nullptr);
-		TotalFileCount = Files.Num();
-		
-		LastBuildSize = 0;
-		for (const FString& File : Files)
+		Window->ViewModel->Update([Snapshot](FGLCManagerState& State)
 		{
-			LastBuildSize += PlatformFile.FileSize(*File);
-		}
-		UncompressedBuildSize = LastBuildSize;
-	}
-	else
-	{
-		bHasBuildReady = false;
-	}
+			State.Build = *Snapshot;
+			State.bIsScanningBuild = false;
+		});
+	});
 }
 
 FReply SGLCManagerWindow::OnBuildOnlyClicked()
 {
-	if (AvailableApps.Num() == 0 || SelectedAppIndex < 0)
+	if (GetState().Apps->Num() == 0 || SelectedAppIndex < 0)
 	{
-		StatusMessage = TEXT("Please select a valid app");
-		StatusMessageType = TEXT("Error");
+		ViewModel->SetStatus(TEXT("Please select a valid app"), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
-	bIsBuilding = true;
-	StatusMessage = TEXT("Starting build process...");
-	StatusMessageType = TEXT("Info");
-	UploadProgress = 0.0f;
+	SyncBuildProfile();
 	
-	// Start build in a separate thread
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
+	ViewModel->Update([Message = FString::Printf(TEXT("Starting build process (%s, %s)..."), *FGLCBuildProfile::GetModeDisplayName(BuildProfile.Mode), *BuildProfile.Configuration)](FGLCManagerState& State)
 	{
-		BuildGame(true); // compressOnly = true
+		State.StatusMessage = Message;
+		State.StatusMessageType = TEXT("Info");
+		State.Progress = 0.0f;
 	});
 	
+	// Build, then compress the packaged build once the build succeeded
+	FGLCJobScheduler& Scheduler = GetJobScheduler();
+	int64 BuildJobId = Scheduler.Submit(MakeShared<FGLCBuildJob, ESPMode::ThreadSafe>(BuildProfile));
+	Scheduler.Submit(MakeShared<FGLCCompressJob, ESPMode::ThreadSafe>(FString(), GetZipPath()), { BuildJobId });
+	
 	return FReply::Handled();
 }
 
@@ -1304,19 +1878,17 @@ FReply SGLCManagerWindow::OnUploadOnlyClicked()
 {
 	UE_LOG(LogTemp, Log, TEXT("[GLC] OnUploadOnlyClicked called"));
 	
-	if (AvailableApps.Num() == 0 || SelectedAppIndex < 0)
+	if (!GetState().Apps->IsValidIndex(SelectedAppIndex))
 	{
 		UE_LOG(LogTemp, Error, TEXT("[GLC] No apps available or invalid selection"));
-		StatusMessage = TEXT("Please select a valid app");
-		StatusMessageType = TEXT("Error");
+		ViewModel->SetStatus(TEXT("Please select a valid app"), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
-	if (!bHasBuildReady)
+	if (!GetState().Build.bHasBuildReady)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[GLC] No build ready"));
-		StatusMessage = TEXT("No build found. Please package your project first (File > Package Project) and place it in Builds/GLC_Upload/ folder.");
-		StatusMessageType = TEXT("Error");
+		ViewModel->SetStatus(TEXT("No build found. Please package your project first (File > Package Project) and place it in Builds/GLC_Upload/ folder."), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
@@ -1327,114 +1899,70 @@ FReply SGLCManagerWindow::OnUploadOnlyClicked()
 	UE_LOG(LogTemp, Log, TEXT("[GLC] Checking for compressed build at: %s"), *ZipPath);
 	UE_LOG(LogTemp, Log, TEXT("[GLC] Build source path: %s"), *BuildPath);
 	
-	if (!FPaths::FileExists(ZipPath))
+	int64 AppId = (*GetState().Apps)[SelectedAppIndex].Id;
+	FGLCSettings Settings = FGLCSettings::Load();
+	FGLCJobScheduler& Scheduler = GetJobScheduler();
+	TArray<int64> UploadDependencies;
+	EGLCUploadMethod Method = EGLCUploadMethod::Archive;
+	FString Message;
+	
+	if (Settings.bChunkedUpload && FPaths::DirectoryExists(BuildPath))
 	{
-		// Need to compress first
-		StatusMessage = TEXT("Compressing build before upload...");
-		StatusMessageType = TEXT("Info");
-		bIsUploading = true;
-		UploadProgress = 0.0f;
-		
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Starting compression from %s to %s"), *BuildPath, *ZipPath);
-		
-		// Compress in background thread and WAIT for completion
-		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, BuildPath, ZipPath]()
-		{
-			bool bSuccess = CompressBuild(BuildPath, ZipPath);
-			
-			// Return to main thread after compression completes
-			AsyncTask(ENamedThreads::GameThread, [this, bSuccess, ZipPath]()
-			{
-				if (bSuccess)
-				{
-					UE_LOG(LogTemp, Log, TEXT("[GLC] Compression successful, starting upload"));
-					// Now the ZIP exists, start upload
-					UploadBuildToCloud(ZipPath);
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("[GLC] Compression failed"));
-					StatusMessage = TEXT("Failed to compress build");
-					StatusMessageType = TEXT("Error");
-					bIsUploading = false;
-					UploadProgress = 0.0f;
-				}
-			});
-		});
+		// Send only the chunks of the build folder the server does not have yet
+		Message = TEXT("Chunking and uploading build...");
+		Method = EGLCUploadMethod::Chunked;
+	}
+	else if (!FPaths::FileExists(ZipPath) && Settings.bStreamCompressedUpload && Settings.bUseMultipartUpload)
+	{
+		// Compress and upload at the same time, without writing the archive to disk
+		Message = TEXT("Compressing and uploading build...");
+		Method = EGLCUploadMethod::Streamed;
+	}
+	else if (!FPaths::FileExists(ZipPath))
+	{
+		// Need to compress first; the upload waits for the archive
+		Message = TEXT("Compressing build before upload...");
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Queueing compression from %s to %s"), *BuildPath, *ZipPath);
+		UploadDependencies.Add(Scheduler.Submit(MakeShared<FGLCCompressJob, ESPMode::ThreadSafe>(BuildPath, ZipPath)));
 	}
 	else
 	{
 		// Already compressed, start upload directly
 		UE_LOG(LogTemp, Log, TEXT("[GLC] Build already compressed, starting upload"));
-		bIsUploading = true;
-		StatusMessage = TEXT("Starting upload...");
-		StatusMessageType = TEXT("Info");
-		UploadProgress = 0.0f;
-		
-		UploadBuildToCloud(ZipPath);
+		Message = TEXT("Starting upload...");
 	}
 	
+	ViewModel->Update([Message](FGLCManagerState& State)
+	{
+		State.StatusMessage = Message;
+		State.StatusMessageType = TEXT("Info");
+		State.Progress = 0.0f;
+	});
+	
+	int64 UploadJobId = Scheduler.Submit(MakeShared<FGLCUploadJob, ESPMode::ThreadSafe>(AppId, BuildNotesInput, Method, BuildPath, ZipPath, GetState().Build.UncompressedBuildSize), UploadDependencies);
+	
+	// Processing status matters more than queued work: polls start as soon as the upload is done
+	Scheduler.Submit(MakeShared<FGLCMonitorJob, ESPMode::ThreadSafe>(0), { UploadJobId }, EGLCJobPriority::High);
+	
 	return FReply::Handled();
 }
 
 FReply SGLCManagerWindow::OnCancelUploadClicked()
 {
-	if (CurrentBuildId <= 0)
+	FGLCJobPtr Job = FindActiveJob(EGLCJobType::Upload);
+	if (!Job.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[GLC] No active build to cancel"));
-		return FReply::Handled();
+		Job = FindActiveJob(EGLCJobType::Monitor);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling build #%lld"), CurrentBuildId);
-	
-	// Show confirmation dialog
-	EAppReturnType::Type Result = FMessageDialog::Open(
-		EAppMsgType::YesNo, 
-		FText::FromString(FString::Printf(TEXT("Are you sure you want to cancel Build #%lld?\n\nThis action cannot be undone."), CurrentBuildId)),
-		FText::FromString(TEXT("Cancel Build"))
-	);
-	
-	if (Result != EAppReturnType::Yes)
+	if (!Job.IsValid())
 	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] No active build to cancel"));
 		return FReply::Handled();
 	}
 	
-	StatusMessage = TEXT("Cancelling build and upload...");
-	StatusMessageType = TEXT("Info");
-	
-	// First, cancel the active HTTP upload if any
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Cancelling active HTTP upload"));
-	ApiClient->CancelActiveUpload();
-	
-	// Then call API to cancel build on server
-	ApiClient->CancelBuildAsync(CurrentBuildId, [this](bool bSuccess, FString Message)
-	{
-		AsyncTask(ENamedThreads::GameThread, [this, bSuccess, Message]()
-		{
-			if (bSuccess)
-			{
-				StatusMessage = FString::Printf(TEXT("✓ Build #%lld cancelled successfully"), CurrentBuildId);
-				StatusMessageType = TEXT("Success");
-				
-				// Stop monitoring
-				StopBuildStatusMonitoring();
-				
-				// Reset states
-				bIsUploading = false;
-				bIsMonitoringBuild = false;
-				UploadProgress = 0.0f;
-				CurrentBuildId = 0;
-				
-				UE_LOG(LogTemp, Log, TEXT("[GLC] Build cancelled successfully"));
-			}
-			else
-			{
-				StatusMessage = FString::Printf(TEXT("Failed to cancel build: %s"), *Message);
-				StatusMessageType = TEXT("Error");
-				UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to cancel build: %s"), *Message);
-			}
-		});
-	});
+	// Cancelling the upload cancels its monitor job as well
+	CancelJobWithConfirmation(Job);
 	
 	return FReply::Handled();
 }
@@ -1448,991 +1976,440 @@ FReply SGLCManagerWindow::OnDashboardClicked()
 
 FReply SGLCManagerWindow::OnManageAppClicked()
 {
-	if (AvailableApps.Num() == 0 || SelectedAppIndex < 0 || SelectedAppIndex >= AvailableApps.Num())
+	if (!GetState().Apps->IsValidIndex(SelectedAppIndex))
 	{
-		StatusMessage = TEXT("Please select a valid app");
-		StatusMessageType = TEXT("Error");
+		ViewModel->SetStatus(TEXT("Please select a valid app"), TEXT("Error"));
 		return FReply::Handled();
 	}
 	
-	int64 AppId = AvailableApps[SelectedAppIndex].Id;
+	int64 AppId = (*GetState().Apps)[SelectedAppIndex].Id;
 	FString ManageUrl = FString::Printf(TEXT("https://app.gamelauncher.cloud/apps/id/%lld/overview"), AppId);
 	FPlatformProcess::LaunchURL(*ManageUrl, nullptr, nullptr);
 	return FReply::Handled();
 }
 
-void SGLCManagerWindow::BuildGame(bool bCompressOnly)
+// ========== JOBS ========== //
+
+FGLCJobScheduler& SGLCManagerWindow::GetJobScheduler()
 {
-	FString BuildPath = FPaths::ProjectDir() / TEXT("Builds") / TEXT("GLC_Upload");
-	FString ProjectFile = FPaths::GetProjectFilePath();
-	
-	// Get platform name
-	FString Platform = TEXT("Win64");
-	
-#if PLATFORM_MAC
-	Platform = TEXT("Mac");
-#elif PLATFORM_LINUX
-	Platform = TEXT("Linux");
-#endif
-	
-	// Get Unreal Engine path
-	FString EnginePath = FPaths::EngineDir();
-	FString UATPath = EnginePath / TEXT("Build/BatchFiles/RunUAT.bat");
-	
-#if PLATFORM_MAC || PLATFORM_LINUX
-	UATPath = EnginePath / TEXT("Build/BatchFiles/RunUAT.sh");
-#endif
-	
-	// Update status on main thread
-	AsyncTask(ENamedThreads::GameThread, [this]()
-	{
-		StatusMessage = TEXT("Building project... This may take several minutes.");
-		StatusMessageType = TEXT("Info");
-		UploadProgress = 0.1f;
-	});
-	
-	// Build command arguments
-	FString Arguments = FString::Printf(
-		TEXT("BuildCookRun -project=\"%s\" -platform=%s -clientconfig=Development -cook -stage -archive -archivedirectory=\"%s\" -build -noP4"),
-		*ProjectFile,
-		*Platform,
-		*BuildPath
-	);
-	
-	// Execute UAT
-	int32 ReturnCode = 0;
-	FString StdOut;
-	FString StdErr;
-	
-	FPlatformProcess::ExecProcess(*UATPath, *Arguments, &ReturnCode, &StdOut, &StdErr);
-	
-	// Update on main thread
-	AsyncTask(ENamedThreads::GameThread, [this, ReturnCode, BuildPath, bCompressOnly, StdErr]()
+	return FGameLauncherCloudEditorModule::Get().GetJobScheduler();
+}
+
+FGLCJobPtr SGLCManagerWindow::FindActiveJob(EGLCJobType Type) const
+{
+	const TArray<FGLCJobPtr>& Jobs = GetJobScheduler().GetJobs();
+	for (int32 Index = Jobs.Num() - 1; Index >= 0; --Index)
 	{
-		if (ReturnCode == 0)
-		{
-			StatusMessage = TEXT("Build completed successfully!");
-			StatusMessageType = TEXT("Success");
-			UploadProgress = 0.5f;
-			
-			// Update build detection
-			CheckForExistingBuild();
-			
-			if (bCompressOnly)
-			{
-				CompressOnly(BuildPath);
-			}
-			else
-			{
-				CompressAndUpload(BuildPath);
-			}
-		}
-		else
+		if (Jobs[Index]->GetType() == Type && !Jobs[Index]->IsDone())
 		{
-			StatusMessage = FString::Printf(TEXT("Build failed with code %d. Check the Output Log for details."), ReturnCode);
-			StatusMessageType = TEXT("Error");
-			bIsBuilding = false;
-			UploadProgress = 0.0f;
-			
-			UE_LOG(LogTemp, Error, TEXT("[GLC] Build error: %s"), *StdErr);
+			return Jobs[Index];
 		}
-	});
+	}
+	return nullptr;
 }
 
-void SGLCManagerWindow::CompressOnly(const FString& BuildPath)
+bool SGLCManagerWindow::IsBuilding() const
 {
-	StatusMessage = TEXT("Starting compression...");
-	StatusMessageType = TEXT("Info");
-	UploadProgress = 0.1f;
-	
-	FString ZipPath = GetZipPath();
-	// Use GetBuildSourcePath() to get the correct path (Windows/Mac/Linux subfolder)
-	FString ActualBuildPath = GetBuildSourcePath();
-	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] CompressOnly: Compressing %s to %s"), *ActualBuildPath, *ZipPath);
-	
-	// Compress in background thread
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, ActualBuildPath, ZipPath]()
-	{
-		bool bSuccess = CompressBuild(ActualBuildPath, ZipPath);
-		
-		AsyncTask(ENamedThreads::GameThread, [this, bSuccess, ZipPath]()
-		{
-			if (bSuccess)
-			{
-				IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-				int64 ZipSize = PlatformFile.FileSize(*ZipPath);
-				
-				StatusMessage = FString::Printf(TEXT("✓ Build compressed successfully! Size: %.2f MB"), ZipSize / (1024.0 * 1024.0));
-				StatusMessageType = TEXT("Success");
-				UploadProgress = 1.0f;
-				
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-				
-				// Update build detection
-				CheckForExistingBuild();
-			}
-			else
-			{
-				StatusMessage = TEXT("❌ Compression failed. Check the Output Log for details.");
-				StatusMessageType = TEXT("Error");
-				
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-			}
-			
-			bIsBuilding = false;
-			UploadProgress = 0.0f;
-		});
-	});
+	const FGLCJobScheduler& Scheduler = GetJobScheduler();
+	return IsMatrixRunning() || Scheduler.HasActiveJobs(EGLCJobType::Build) || Scheduler.HasActiveJobs(EGLCJobType::Compress);
 }
 
-void SGLCManagerWindow::CompressAndUpload(const FString& BuildPath)
+bool SGLCManagerWindow::IsUploading() const
 {
-	StatusMessage = TEXT("Starting compression...");
-	StatusMessageType = TEXT("Info");
-	UploadProgress = 0.1f;
-	
-	FString ZipPath = GetZipPath();
-	// Use GetBuildSourcePath() to get the correct path (Windows/Mac/Linux subfolder)
-	FString ActualBuildPath = GetBuildSourcePath();
-	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] CompressAndUpload: Compressing %s to %s"), *ActualBuildPath, *ZipPath);
-	
-	// Compress in background thread
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, ActualBuildPath, ZipPath]()
-	{
-		bool bSuccess = CompressBuild(ActualBuildPath, ZipPath);
-		
-		AsyncTask(ENamedThreads::GameThread, [this, bSuccess, ZipPath]()
-		{
-			if (bSuccess)
-			{
-				StatusMessage = TEXT("✓ Compression complete. Upload functionality coming soon!");
-				StatusMessageType = TEXT("Info");
-				UploadProgress = 0.8f;
-				
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-				
-				// Update build detection
-				CheckForExistingBuild();
-				
-				// TODO: Implement upload here
-				// For now just finish
-				bIsBuilding = false;
-				UploadProgress = 0.0f;
-			}
-			else
-			{
-				StatusMessage = TEXT("❌ Compression failed. Check the Output Log for details.");
-				StatusMessageType = TEXT("Error");
-				bIsBuilding = false;
-				UploadProgress = 0.0f;
-				
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-			}
-		});
-	});
+	return GetJobScheduler().HasActiveJobs(EGLCJobType::Upload);
 }
 
-bool SGLCManagerWindow::CompressBuild(const FString& SourcePath, const FString& ZipPath)
+bool SGLCManagerWindow::IsMonitoringBuild() const
 {
-	UE_LOG(LogTemp, Log, TEXT("[GLC] CompressBuild - Source: %s"), *SourcePath);
-	UE_LOG(LogTemp, Log, TEXT("[GLC] CompressBuild - Target: %s"), *ZipPath);
-	
-	// Verify source exists
-	if (!FPaths::DirectoryExists(SourcePath))
+	return GetJobScheduler().HasActiveJobs(EGLCJobType::Monitor);
+}
+
+int64 SGLCManagerWindow::GetCurrentBuildId() const
+{
+	if (FGLCJobPtr UploadJob = FindActiveJob(EGLCJobType::Upload))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Source directory does not exist: %s"), *SourcePath);
-		return false;
+		return StaticCastSharedPtr<FGLCUploadJob>(UploadJob)->GetAppBuildId();
 	}
-	
-	// Count total files first for progress tracking
-	TArray<FString> AllFiles;
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	PlatformFile.FindFilesRecursively(AllFiles, *SourcePath, nullptr);
-	int32 TotalFiles = AllFiles.Num();
-	int64 TotalSize = 0;
-	
-	for (const FString& File : AllFiles)
+	if (FGLCJobPtr MonitorJob = FindActiveJob(EGLCJobType::Monitor))
 	{
-		TotalSize += PlatformFile.FileSize(*File);
+		return StaticCastSharedPtr<FGLCMonitorJob>(MonitorJob)->GetAppBuildId();
 	}
+	return 0;
+}
+
+void SGLCManagerWindow::OnJobChanged(const FGLCJobPtr& Job)
+{
+	RefreshJobList();
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Found %d files to compress (%.2f MB total)"), TotalFiles, TotalSize / (1024.0 * 1024.0));
-	
-	// Update UI with file count
-	AsyncTask(ENamedThreads::GameThread, [this, TotalFiles, TotalSize]()
-	{
-		StatusMessage = FString::Printf(TEXT("Preparing to compress %d files (%.2f MB)..."), TotalFiles, TotalSize / (1024.0 * 1024.0));
-		UploadProgress = 0.05f;
-		if (StatusMessageText.IsValid())
-		{
-			StatusMessageText->SetText(FText::FromString(StatusMessage));
-		}
-	});
-	
-	FPlatformProcess::Sleep(0.5f); // Give UI time to update
-	
-	// Ensure target directory exists
-	FString ZipDirectory = FPaths::GetPath(ZipPath);
-	if (!PlatformFile.DirectoryExists(*ZipDirectory))
+	// Matrix jobs add up to one status line
+	if (Job.IsValid() && IsMatrixJob(Job->GetId()))
 	{
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Creating directory: %s"), *ZipDirectory);
-		PlatformFile.CreateDirectoryTree(*ZipDirectory);
+		OnMatrixChanged();
+		return;
 	}
 	
-	// Delete existing zip if exists
-	if (FPaths::FileExists(ZipPath))
+	// Null when finished jobs were cleared; a pending job has nothing to report yet
+	if (!Job.IsValid() || Job->GetState() == EGLCJobState::Pending)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Deleting existing ZIP file"));
-		PlatformFile.DeleteFile(*ZipPath);
+		return;
 	}
 	
-	// Use 7-Zip or platform-specific compression
-	FString CompressCmd;
-	FString Arguments;
-	
-#if PLATFORM_WINDOWS
-	// Try to find 7-Zip
-	FString SevenZipPath = TEXT("C:/Program Files/7-Zip/7z.exe");
-	if (!FPaths::FileExists(SevenZipPath))
+	FString MessageType;
+	switch (Job->GetState())
 	{
-		SevenZipPath = TEXT("C:/Program Files (x86)/7-Zip/7z.exe");
+	case EGLCJobState::Succeeded: MessageType = TEXT("Success"); break;
+	case EGLCJobState::Failed: MessageType = TEXT("Error"); break;
+	case EGLCJobState::Cancelled:
+	case EGLCJobState::Paused: MessageType = TEXT("Warning"); break;
+	default: MessageType = TEXT("Info"); break;
 	}
+	ViewModel->Update([Message = Job->GetMessage(), Progress = Job->GetProgress(), MessageType](FGLCManagerState& State)
+	{
+		State.StatusMessage = Message;
+		State.StatusMessageType = MessageType;
+		State.Progress = Progress;
+	});
 	
-	if (FPaths::FileExists(SevenZipPath))
+	if (Job->GetState() == EGLCJobState::Succeeded && (Job->GetType() == EGLCJobType::Build || Job->GetType() == EGLCJobType::Compress))
 	{
-		CompressCmd = SevenZipPath;
-		Arguments = FString::Printf(TEXT("a -tzip \"%s\" \"%s\\*\""), *ZipPath, *SourcePath);
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Using 7-Zip: %s %s"), *CompressCmd, *Arguments);
+		// Update build detection
+		CheckForExistingBuild();
 	}
-	else
+	else if (Job->IsDone() && Job->GetType() == EGLCJobType::Monitor)
 	{
-		// Fallback to PowerShell - create a temp script file with progress reporting
-		CompressCmd = TEXT("powershell.exe");
-		
-		// Convert forward slashes to backslashes for Windows PowerShell
-		FString WindowsSourcePath = SourcePath.Replace(TEXT("/"), TEXT("\\"));
-		FString WindowsZipPath = ZipPath.Replace(TEXT("/"), TEXT("\\"));
-		
-		// Create progress file path
-		FString ProgressFilePath = FPaths::ProjectIntermediateDir() / TEXT("compress_progress.txt");
-		FString WindowsProgressPath = ProgressFilePath.Replace(TEXT("/"), TEXT("\\"));
-		
-		// Create a temporary PowerShell script file with progress reporting
-		FString ScriptPath = FPaths::ProjectIntermediateDir() / TEXT("compress_build.ps1");
-		FString ScriptContent = FString::Printf(
-			TEXT("$ErrorActionPreference = 'Stop'\n")
-			TEXT("$progressFile = '%s'\n")
-			TEXT("$sourcePath = '%s'\n")
-			TEXT("$zipPath = '%s'\n")
-			TEXT("\n")
-			TEXT("try {\n")
-			TEXT("    # Delete old progress file\n")
-			TEXT("    if (Test-Path $progressFile) { Remove-Item $progressFile -Force }\n")
-			TEXT("    \n")
-			TEXT("    # Get all files to compress\n")
-			TEXT("    Write-Host 'Counting files...'\n")
-			TEXT("    $files = Get-ChildItem -Path $sourcePath -Recurse -File\n")
-			TEXT("    $totalFiles = $files.Count\n")
-			TEXT("    $processedFiles = 0\n")
-			TEXT("    \n")
-			TEXT("    Write-Host \"Found $totalFiles files to compress\"\n")
-			TEXT("    \"0|$totalFiles\" | Out-File -FilePath $progressFile -Encoding ASCII\n")
-			TEXT("    \n")
-			TEXT("    # Load compression assembly\n")
-			TEXT("    Add-Type -Assembly System.IO.Compression\n")
-			TEXT("    Add-Type -Assembly System.IO.Compression.FileSystem\n")
-			TEXT("    \n")
-			TEXT("    # Create ZIP file stream\n")
-			TEXT("    $zipStream = [System.IO.File]::Create($zipPath)\n")
-			TEXT("    $archive = [System.IO.Compression.ZipArchive]::new($zipStream, [System.IO.Compression.ZipArchiveMode]::Create)\n")
-			TEXT("    \n")
-			TEXT("    try {\n")
-			TEXT("        foreach ($file in $files) {\n")
-			TEXT("            $relativePath = $file.FullName.Substring($sourcePath.Length + 1)\n")
-			TEXT("            $entry = $archive.CreateEntry($relativePath, [System.IO.Compression.CompressionLevel]::Optimal)\n")
-			TEXT("            $entryStream = $entry.Open()\n")
-			TEXT("            try {\n")
-			TEXT("                $fileStream = [System.IO.File]::OpenRead($file.FullName)\n")
-			TEXT("                try {\n")
-			TEXT("                    $fileStream.CopyTo($entryStream)\n")
-			TEXT("                } finally {\n")
-			TEXT("                    $fileStream.Close()\n")
-			TEXT("                }\n")
-			TEXT("            } finally {\n")
-			TEXT("                $entryStream.Close()\n")
-			TEXT("            }\n")
-			TEXT("            \n")
-			TEXT("            $processedFiles++\n")
-			TEXT("            if ($processedFiles %% 10 -eq 0 -or $processedFiles -eq $totalFiles) {\n")
-			TEXT("                \"$processedFiles|$totalFiles\" | Out-File -FilePath $progressFile -Encoding ASCII -Force\n")
-			TEXT("            }\n")
-			TEXT("        }\n")
-			TEXT("    } finally {\n")
-			TEXT("        $archive.Dispose()\n")
-			TEXT("        $zipStream.Close()\n")
-			TEXT("    }\n")
-			TEXT("    \n")
-			TEXT("    Write-Host 'Compression completed successfully'\n")
-			TEXT("    \"$totalFiles|$totalFiles|COMPLETE\" | Out-File -FilePath $progressFile -Encoding ASCII -Force\n")
-			TEXT("    exit 0\n")
-			TEXT("} catch {\n")
-			TEXT("    $errorMsg = $_.Exception.Message\n")
-			TEXT("    Write-Host \"Error: $errorMsg\"\n")
-			TEXT("    Write-Host $_.ScriptStackTrace\n")
-			TEXT("    \"ERROR|$errorMsg\" | Out-File -FilePath $progressFile -Encoding ASCII -Force\n")
-			TEXT("    exit 1\n")
-			TEXT("}"),
-			*WindowsProgressPath, *WindowsSourcePath, *WindowsZipPath);
-		
-		if (!FFileHelper::SaveStringToFile(ScriptContent, *ScriptPath))
+		// Not from inside the scheduler's broadcast: the dialogs are modal
+		TWeakPtr<SGLCManagerWindow> WeakWindow = StaticCastSharedRef<SGLCManagerWindow>(AsShared());
+		AsyncTask(ENamedThreads::GameThread, [WeakWindow, Job]()
 		{
-			UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to create PowerShell script"));
-			return false;
-		}
-		
-		Arguments = FString::Printf(
-			TEXT("-NoProfile -ExecutionPolicy Bypass -File \"%s\""),
-			*ScriptPath);
-		
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Using PowerShell script: %s"), *ScriptPath);
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Progress file: %s"), *ProgressFilePath);
-	}
-#elif PLATFORM_MAC || PLATFORM_LINUX
-	CompressCmd = TEXT("/usr/bin/zip");
-	Arguments = FString::Printf(TEXT("-r \"%s\" \"%s\""), *ZipPath, *SourcePath);
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Using zip: %s %s"), *CompressCmd, *Arguments);
-#endif
-	
-	int32 ReturnCode = 0;
-	FString StdOut;
-	FString StdErr;
-	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Executing compression command..."));
-	
-	// Use ExecProcess with proper output handling
-	bool bLaunchDetached = false;
-	bool bLaunchHidden = true;
-	bool bLaunchReallyHidden = true;
-	
-	FProcHandle ProcHandle = FPlatformProcess::CreateProc(
-		*CompressCmd,
-		*Arguments,
-		bLaunchDetached,
-		bLaunchHidden,
-		bLaunchReallyHidden,
-		nullptr,
-		0,
-		nullptr,
-		nullptr
-	);
-	
-	if (!ProcHandle.IsValid())
-	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to start compression process"));
-		return false;
-	}
-	
-	// Wait for process to complete with timeout (10 minutes for large files)
-	const double TimeoutSeconds = 600.0;
-	const double StartTime = FPlatformTime::Seconds();
-	bool bTimedOut = false;
-	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Waiting for compression to complete..."));
-	
-	FString ProgressFilePath = FPaths::ProjectIntermediateDir() / TEXT("compress_progress.txt");
-	int32 LastProcessedFiles = 0;
+			if (TSharedPtr<SGLCManagerWindow> Window = WeakWindow.Pin())
+			{
+				Window->OnMonitorJobFinished(Job);
+			}
+		});
+	}
+}
+
+void SGLCManagerWindow::OnMonitorJobFinished(const FGLCJobPtr& Job)
+{
+	int64 AppBuildId = StaticCastSharedPtr<FGLCMonitorJob>(Job)->GetAppBuildId();
 	
-	while (FPlatformProcess::IsProcRunning(ProcHandle))
+	if (Job->GetState() == EGLCJobState::Succeeded)
 	{
-		FPlatformProcess::Sleep(0.5f);
+		FText DialogTitle = FText::FromString(TEXT("Build Completed"));
+		FText DialogMessage = FText::FromString(FString::Printf(
+			TEXT("Build #%lld processed successfully!\n\nDo you want to view it in Game Launcher Cloud?"),
+			AppBuildId
+		));
 		
-		double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
-		if (ElapsedSeconds > TimeoutSeconds)
+		EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::YesNo, DialogMessage, DialogTitle);
+		if (Result == EAppReturnType::Yes)
 		{
-			UE_LOG(LogTemp, Error, TEXT("[GLC] Compression timeout after %.0f seconds"), TimeoutSeconds);
-			FPlatformProcess::TerminateProc(ProcHandle);
-			bTimedOut = true;
-			break;
-		}
-		
-		// Read progress from file
-		if (FPaths::FileExists(ProgressFilePath))
-		{
-			FString ProgressContent;
-			if (FFileHelper::LoadFileToString(ProgressContent, *ProgressFilePath))
-			{
-				ProgressContent = ProgressContent.TrimStartAndEnd();
-				
-				TArray<FString> Parts;
-				ProgressContent.ParseIntoArray(Parts, TEXT("|"));
-				
-				if (Parts.Num() >= 2)
-				{
-					int32 ProcessedFiles = FCString::Atoi(*Parts[0]);
-					int32 TotalFilesInProgress = FCString::Atoi(*Parts[1]);
-					
-					if (ProcessedFiles != LastProcessedFiles)
-					{
-						LastProcessedFiles = ProcessedFiles;
-						float Progress = TotalFilesInProgress > 0 ? (float)ProcessedFiles / (float)TotalFilesInProgress : 0.0f;
-						
-						UE_LOG(LogTemp, Log, TEXT("[GLC] Compression progress: %d/%d files (%.1f%%)"), 
-							ProcessedFiles, TotalFilesInProgress, Progress * 100.0f);
-						
-						// Update UI on game thread
-						AsyncTask(ENamedThreads::GameThread, [this, ProcessedFiles, TotalFilesInProgress, Progress]()
-						{
-							StatusMessage = FString::Printf(TEXT("Compressing: %d/%d files (%.1f%%)"), 
-								ProcessedFiles, TotalFilesInProgress, Progress * 100.0f);
-							UploadProgress = 0.1f + (Progress * 0.8f); // Progress from 10% to 90%
-							if (StatusMessageText.IsValid())
-							{
-								StatusMessageText->SetText(FText::FromString(StatusMessage));
-							}
-						});
-					}
-				}
-			}
+			int64 AppId = 0;
+			Job->GetOutput()->TryGetNumberField(TEXT("appId"), AppId);
+			FString FrontendUrl = ApiUrl.Replace(TEXT("api."), TEXT("app."));
+			FString BuildUrl = FString::Printf(TEXT("%s/apps/id/%lld/builds"), *FrontendUrl, AppId);
+			FPlatformProcess::LaunchURL(*BuildUrl, nullptr, nullptr);
 		}
 	}
-	
-	// Get return code
-	FPlatformProcess::GetProcReturnCode(ProcHandle, &ReturnCode);
-	FPlatformProcess::CloseProc(ProcHandle);
-	
-	if (bTimedOut)
+	else if (Job->GetState() == EGLCJobState::Failed)
 	{
-		return false;
+		FText DialogTitle = FText::FromString(TEXT("Build Failed"));
+		FText DialogMessage = FText::FromString(FString::Printf(
+			TEXT("Build #%lld processing failed:\n\n%s"),
+			AppBuildId,
+			*Job->GetMessage()
+		));
+		FMessageDialog::Open(EAppMsgType::Ok, DialogMessage, DialogTitle);
 	}
-	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Compression return code: %d"), ReturnCode);
-	
-	if (ReturnCode != 0)
+}
+
+void SGLCManagerWindow::CancelJobWithConfirmation(const FGLCJobPtr& Job)
+{
+	if (!Job.IsValid() || Job->IsDone())
 	{
-		// Try to read error from progress file
-		if (FPaths::FileExists(ProgressFilePath))
-		{
-			FString ErrorContent;
-			if (FFileHelper::LoadFileToString(ErrorContent, *ProgressFilePath))
-			{
-				UE_LOG(LogTemp, Error, TEXT("[GLC] Compression error details: %s"), *ErrorContent);
-			}
-		}
-		
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Compression failed with code %d"), ReturnCode);
-		return false;
+		return;
 	}
 	
-	// Wait a bit for file system to sync
-	FPlatformProcess::Sleep(1.0f);
-	
-	// Verify the ZIP was created
-	if (!FPaths::FileExists(ZipPath))
+	// Cancelling an upload or its monitor also cancels the build on the server
+	int64 AppBuildId = 0;
+	if (Job->GetType() == EGLCJobType::Upload)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] ZIP file was not created at: %s"), *ZipPath);
-		return false;
+		AppBuildId = StaticCastSharedPtr<FGLCUploadJob>(Job)->GetAppBuildId();
 	}
-	
-	int64 ZipSize = PlatformFile.FileSize(*ZipPath);
-	if (ZipSize <= 0)
+	else if (Job->GetType() == EGLCJobType::Monitor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] ZIP file was created but is empty or invalid"));
-		return false;
+		AppBuildId = StaticCastSharedPtr<FGLCMonitorJob>(Job)->GetAppBuildId();
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Compression successful! ZIP size: %lld bytes (%.2f MB)"), ZipSize, ZipSize / (1024.0 * 1024.0));
-	
-	return true;
-}
-
-void SGLCManagerWindow::StartBuildStatusMonitoring(int64 BuildId)
-{
-	UE_LOG(LogTemp, Log, TEXT("[GLC] === Starting Build Status Monitor for Build #%lld ==="), BuildId);
-	
-	CurrentBuildId = BuildId;
-	bIsMonitoringBuild = true;
-	
-	// Start a timer to check status every 5 seconds
-	if (GEditor)
+	if (AppBuildId > 0)
 	{
-		GEditor->GetTimerManager()->SetTimer(
-			BuildStatusTimerHandle,
-			FTimerDelegate::CreateSP(this, &SGLCManagerWindow::CheckBuildStatus),
-			5.0f,  // Check every 5 seconds
-			true   // Loop
+		EAppReturnType::Type Result = FMessageDialog::Open(
+			EAppMsgType::YesNo, 
+			FText::FromString(FString::Printf(TEXT("Are you sure you want to cancel Build #%lld?\n\nThis action cannot be undone."), AppBuildId)),
+			FText::FromString(TEXT("Cancel Build"))
 		);
 		
-		// Check immediately
-		CheckBuildStatus();
-	}
-}
-
-void SGLCManagerWindow::StopBuildStatusMonitoring()
-{
-	if (GEditor && BuildStatusTimerHandle.IsValid())
-	{
-		GEditor->GetTimerManager()->ClearTimer(BuildStatusTimerHandle);
-		BuildStatusTimerHandle.Invalidate();
+		if (Result != EAppReturnType::Yes)
+		{
+			return;
+		}
 	}
 	
-	bIsMonitoringBuild = false;
-	UE_LOG(LogTemp, Log, TEXT("[GLC] === Build Status Monitor Ended ==="));
+	GetJobScheduler().Cancel(Job->GetId());
 }
 
-void SGLCManagerWindow::CheckBuildStatus()
+TSharedRef<SWidget> SGLCManagerWindow::ConstructJobList()
 {
-	if (!ApiClient.IsValid() || !bIsMonitoringBuild || CurrentBuildId == 0)
-	{
-		StopBuildStatusMonitoring();
-		return;
-	}
-	
-	ApiClient->GetBuildStatusAsync(CurrentBuildId,
-		[this](bool bSuccess, FString Error, FGLCBuildStatusResponse Response)
-		{
-			if (!bSuccess)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[GLC] Failed to get build status: %s"), *Error);
-				return;
-			}
-			
-			// Update UI based on status
-			FString StatusIcon = GetStatusIcon(Response.Status);
-			FString StatusDisplayName = GetStatusDisplayName(Response.Status);
+	TSharedRef<SWidget> Widget = SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+		.Padding(FMargin(20.0f, 15.0f))
+		.Visibility_Lambda([]() { return GetJobScheduler().GetJobs().Num() > 0 ? EVisibility::Visible : EVisibility::Collapsed; })
+		[
+			SNew(SVerticalBox)
 			
-			// Build detailed status message
-			if (Response.StageProgress > 0)
-			{
-				StatusMessage = FString::Printf(TEXT("%s Build #%lld: %s (%d%%)"), 
-					*StatusIcon, Response.AppBuildId, *StatusDisplayName, Response.StageProgress);
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(SHorizontalBox)
 				
-				// Update progress bar based on stage and progress
-				float BaseProgress = GetStageBaseProgress(Response.Status);
-				float StageWeight = GetStageWeight(Response.Status);
-				UploadProgress = BaseProgress + (Response.StageProgress / 100.0f) * StageWeight;
-			}
-			else
-			{
-				StatusMessage = FString::Printf(TEXT("%s Build #%lld: %s"), 
-					*StatusIcon, Response.AppBuildId, *StatusDisplayName);
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("JobsTitle", "📋 Jobs"))
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+					.ColorAndOpacity(FLinearColor(0.9f, 0.95f, 1.0f))
+				]
 				
-				// Set progress based on stage
-				UploadProgress = GetStageBaseProgress(Response.Status);
-			}
-			
-			// Update UI
-			AsyncTask(ENamedThreads::GameThread, [this]()
-			{
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-			});
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SButton)
+					.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+					.OnClicked_Lambda([]()
+					{
+						GetJobScheduler().ClearFinishedJobs();
+						return FReply::Handled();
+					})
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("ClearFinishedJobs", "Clear finished"))
+						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+					]
+				]
+			]
 			
-			UE_LOG(LogTemp, Log, TEXT("[GLC] Build status: %s (Progress: %.1f%%)"), *StatusMessage, UploadProgress * 100.0f);
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 5.0f, 0.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("JobsInfo", "Jobs keep running when this window is closed and resume after an editor restart."))
+				.Font(FCoreStyle::GetDefaultFontStyle("Italic", 11))
+				.ColorAndOpacity(FLinearColor(0.7f, 0.8f, 0.9f))
+				.AutoWrapText(true)
+			]
 			
-			// Check if build is in final state
-			if (Response.Status == TEXT("Completed"))
-			{
-				StatusMessage = FString::Printf(TEXT("✅ Build #%lld completed successfully!"), Response.AppBuildId);
-				StatusMessageType = TEXT("Success");
-				StopBuildStatusMonitoring();
-				
-				// Show notification
-				FText DialogTitle = FText::FromString(TEXT("Build Completed"));
-				FText DialogMessage = FText::FromString(FString::Printf(
-					TEXT("Build #%lld processed successfully!\n\nDo you want to view it in Game Launcher Cloud?"),
-					Response.AppBuildId
-				));
-				
-				EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::YesNo, DialogMessage, DialogTitle);
-				if (Result == EAppReturnType::Yes)
-				{
-					FString FrontendUrl = ApiUrl.Replace(TEXT("api."), TEXT("app."));
-					FString BuildUrl = FString::Printf(TEXT("%s/apps/id/%lld/builds"), *FrontendUrl, Response.AppId);
-					FPlatformProcess::LaunchURL(*BuildUrl, nullptr, nullptr);
-				}
-			}
-			else if (Response.Status == TEXT("Failed"))
-			{
-				FString ErrorMsg = Response.ErrorMessage.IsEmpty() ? TEXT("Unknown error") : Response.ErrorMessage;
-				StatusMessage = FString::Printf(TEXT("❌ Build #%lld failed: %s"), Response.AppBuildId, *ErrorMsg);
-				StatusMessageType = TEXT("Error");
-				StopBuildStatusMonitoring();
-				
-				// Show error dialog
-				FText DialogTitle = FText::FromString(TEXT("Build Failed"));
-				FText DialogMessage = FText::FromString(FString::Printf(
-					TEXT("Build #%lld processing failed:\n\n%s"),
-					Response.AppBuildId,
-					*ErrorMsg
-				));
-				FMessageDialog::Open(EAppMsgType::Ok, DialogMessage, DialogTitle);
-			}
-			else if (Response.Status == TEXT("Cancelled") || Response.Status == TEXT("Deleted"))
-			{
-				StatusMessage = FString::Printf(TEXT("⚠️ Build #%lld was %s"), Response.AppBuildId, *Response.Status.ToLower());
-				StatusMessageType = TEXT("Warning");
-				StopBuildStatusMonitoring();
-			}
-			else
-			{
-				// Still processing
-				StatusMessageType = TEXT("Info");
-			}
-		});
-}
-
-FString SGLCManagerWindow::GetStatusIcon(const FString& Status)
-{
-	if (Status == TEXT("Pending")) return TEXT("⏳");
-	if (Status == TEXT("GeneratingPresignedUrl")) return TEXT("🔗");
-	if (Status == TEXT("UploadingBuild")) return TEXT("⬆️");
-	if (Status == TEXT("Enqueued")) return TEXT("📋");
-	if (Status == TEXT("DownloadingBuild")) return TEXT("⬇️");
-	if (Status == TEXT("DownloadingPreviousBuild")) return TEXT("⬇️");
-	if (Status == TEXT("UnzippingBuild")) return TEXT("📦");
-	if (Status == TEXT("UnzippingPreviousBuild")) return TEXT("📦");
-	if (Status == TEXT("CreatingPatch")) return TEXT("🔧");
-	if (Status == TEXT("DeployingPatch")) return TEXT("🚀");
-	if (Status == TEXT("Completed")) return TEXT("✅");
-	if (Status == TEXT("Failed")) return TEXT("❌");
-	if (Status == TEXT("Cancelled")) return TEXT("⚠️");
-	if (Status == TEXT("Deleted")) return TEXT("🗑️");
-	
-	return TEXT("📊");
-}
-
-FString SGLCManagerWindow::GetStatusDisplayName(const FString& Status)
-{
-	if (Status == TEXT("Pending")) return TEXT("Pending");
-	if (Status == TEXT("GeneratingPresignedUrl")) return TEXT("Preparing Upload");
-	if (Status == TEXT("UploadingBuild")) return TEXT("Uploading Build");
-	if (Status == TEXT("Enqueued")) return TEXT("Queued for Processing");
-	if (Status == TEXT("DownloadingBuild")) return TEXT("Downloading Build");
-	if (Status == TEXT("DownloadingPreviousBuild")) return TEXT("Downloading Previous Build");
-	if (Status == TEXT("UnzippingBuild")) return TEXT("Extracting Build");
-	if (Status == TEXT("UnzippingPreviousBuild")) return TEXT("Extracting Previous Build");
-	if (Status == TEXT("CreatingPatch")) return TEXT("Creating Patch");
-	if (Status == TEXT("DeployingPatch")) return TEXT("Deploying Patch");
-	if (Status == TEXT("Completed")) return TEXT("Completed");
-	if (Status == TEXT("Failed")) return TEXT("Failed");
-	if (Status == TEXT("Cancelled")) return TEXT("Cancelled");
-	if (Status == TEXT("Deleted")) return TEXT("Deleted");
-	
-	return Status;
-}
-
-float SGLCManagerWindow::GetStageBaseProgress(const FString& Status)
-{
-	// Map each stage to a base progress percentage (0.0 to 1.0)
-	if (Status == TEXT("Pending")) return 0.0f;
-	if (Status == TEXT("GeneratingPresignedUrl")) return 0.05f;
-	if (Status == TEXT("UploadingBuild")) return 0.10f;
-	if (Status == TEXT("Enqueued")) return 0.30f;
-	if (Status == TEXT("DownloadingBuild")) return 0.35f;
-	if (Status == TEXT("DownloadingPreviousBuild")) return 0.40f;
-	if (Status == TEXT("UnzippingBuild")) return 0.50f;
-	if (Status == TEXT("UnzippingPreviousBuild")) return 0.60f;
-	if (Status == TEXT("CreatingPatch")) return 0.70f;
-	if (Status == TEXT("DeployingPatch")) return 0.85f;
-	if (Status == TEXT("Completed")) return 1.0f;
-	
-	return 0.0f;
-}
-
-float SGLCManagerWindow::GetStageWeight(const FString& Status)
-{
-	// How much progress each stage contributes (0.0 to 1.0)
-	if (Status == TEXT("Pending")) return 0.05f;
-	if (Status == TEXT("GeneratingPresignedUrl")) return 0.05f;
-	if (Status == TEXT("UploadingBuild")) return 0.20f;
-	if (Status == TEXT("Enqueued")) return 0.05f;
-	if (Status == TEXT("DownloadingBuild")) return 0.05f;
-	if (Status == TEXT("DownloadingPreviousBuild")) return 0.10f;
-	if (Status == TEXT("UnzippingBuild")) return 0.10f;
-	if (Status == TEXT("UnzippingPreviousBuild")) return 0.10f;
-	if (Status == TEXT("CreatingPatch")) return 0.15f;
-	if (Status == TEXT("DeployingPatch")) return 0.15f;
-	
-	return 0.05f;
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 10.0f, 0.0f, 0.0f)
+			[
+				SAssignNew(JobListBox, SVerticalBox)
+			]
+		];
+	
+	ShownJobStates.Empty();
+	RefreshJobList();
+	
+	return Widget;
 }
 
-void SGLCManagerWindow::UploadBuildToCloud(const FString& ZipPath)
+void SGLCManagerWindow::RefreshJobList()
 {
-	UE_LOG(LogTemp, Log, TEXT("[GLC] UploadBuildToCloud called with: %s"), *ZipPath);
+	TRACE_CPUPROFILER_EVENT_SCOPE(SGLCManagerWindow::RefreshJobList);
 	
-	if (!ApiClient.IsValid() || !bIsAuthenticated)
+	if (!JobListBox.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Not authenticated or ApiClient invalid"));
-		StatusMessage = TEXT("Not authenticated");
-		StatusMessageType = TEXT("Error");
-		bIsUploading = false;
 		return;
 	}
 	
-	if (SelectedAppIndex < 0 || !AvailableApps.IsValidIndex(SelectedAppIndex))
+	// Progress updates only change texts, which are bound to the jobs; rebuild when jobs come, go or change state
+	const TArray<FGLCJobPtr>& Jobs = GetJobScheduler().GetJobs();
+	TArray<TPair<int64, EGLCJobState>> JobStates;
+	for (const FGLCJobPtr& Job : Jobs)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Invalid app selection. Index: %d, Apps count: %d"), SelectedAppIndex, AvailableApps.Num());
-		StatusMessage = TEXT("Please select an app");
-		StatusMessageType = TEXT("Error");
-		bIsUploading = false;
-		return;
+		JobStates.Emplace(Job->GetId(), Job->GetState());
 	}
 	
-	// Verify file exists
-	if (!FPaths::FileExists(ZipPath))
+	if (JobStates == ShownJobStates)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Build file does not exist: %s"), *ZipPath);
-		StatusMessage = TEXT("Build file not found");
-		StatusMessageType = TEXT("Error");
-		bIsUploading = false;
 		return;
 	}
+	ShownJobStates = MoveTemp(JobStates);
+	
+	JobListBox->ClearChildren();
 	
-	// Get file size
-	int64 FileSize = IFileManager::Get().FileSize(*ZipPath);
-	if (FileSize <= 0)
+	// Newest first
+	for (int32 Index = Jobs.Num() - 1; Index >= 0; --Index)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GLC] Invalid build file size: %lld for file: %s"), FileSize, *ZipPath);
+		FGLCJobPtr Job = Jobs[Index];
 		
-		// Try alternative method using IPlatformFile
-		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-		FileSize = PlatformFile.FileSize(*ZipPath);
-		
-		if (FileSize <= 0)
+		const TCHAR* Icon = TEXT("⏳");
+		switch (Job->GetState())
 		{
-			UE_LOG(LogTemp, Error, TEXT("[GLC] Alternative method also failed. File may be corrupted."));
-			StatusMessage = TEXT("Invalid build file. Please rebuild.");
-			StatusMessageType = TEXT("Error");
-			bIsUploading = false;
-			return;
+		case EGLCJobState::Running: Icon = TEXT("▶️"); break;
+		case EGLCJobState::Succeeded: Icon = TEXT("✓"); break;
+		case EGLCJobState::Failed: Icon = TEXT("❌"); break;
+		case EGLCJobState::Cancelled: Icon = TEXT("⛔"); break;
+		case EGLCJobState::Paused: Icon = TEXT("⏸"); break;
+		default: break;
 		}
 		
-		UE_LOG(LogTemp, Log, TEXT("[GLC] Alternative method succeeded. File size: %lld"), FileSize);
+		JobListBox->AddSlot()
+		.AutoHeight()
+		.Padding(0.0f, 2.0f)
+		[
+			SNew(SHorizontalBox)
+			
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([Job, Icon]()
+				{
+					FString Progress = Job->GetState() == EGLCJobState::Running ? FString::Printf(TEXT(" %d%%"), FMath::RoundToInt(Job->GetProgress() * 100.0f)) : FString();
+					return FText::FromString(FString::Printf(TEXT("%s #%lld %s%s: %s"), Icon, Job->GetId(), *Job->GetDisplayName(), *Progress, *Job->GetMessage()));
+				})
+				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
+				.ColorAndOpacity(FLinearColor(0.8f, 0.9f, 1.0f))
+				.AutoWrapText(true)
+			]
+			
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ToolTipText(LOCTEXT("ResumeJobTooltip", "Start this job over"))
+				.Visibility(Job->GetState() == EGLCJobState::Paused ? EVisibility::Visible : EVisibility::Collapsed)
+				.OnClicked_Lambda([Job]()
+				{
+					GetJobScheduler().Resume(Job->GetId());
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("ResumeJob", "▶"))
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 11))
+				]
+			]
+			
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ToolTipText(LOCTEXT("CancelJobTooltip", "Cancel this job and the jobs waiting for it"))
+				.Visibility(Job->IsDone() ? EVisibility::Collapsed : EVisibility::Visible)
+				.OnClicked_Lambda([this, Job]()
+				{
+					CancelJobWithConfirmation(Job);
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("CancelJob", "✖"))
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 11))
+				]
+			]
+		];
 	}
+}
+
+// ========== BENCHMARK ========== //
+
+void SGLCManagerWindow::RebuildSections()
+{
+	SectionsBox->ClearChildren();
+	
+	SectionsBox->AddSlot()
+	.AutoHeight()
+	[
+		SNew(SBorder)
+		.Padding(20.0f)
+		[
+			GetState().bIsAuthenticated ? ConstructBuildUploadTab() : ConstructLoginTab()
+		]
+	];
+	
+	SectionsBox->AddSlot()
+	.AutoHeight()
+	.Padding(0.0f, 20.0f, 0.0f, 0.0f)
+	[
+		ConstructTipsTab()
+	];
+}
+
+void SGLCManagerWindow::RunUpdateBenchmark(int32 Iterations)
+{
+	// A window of its own, so the one the user has open is left alone; it loads nothing on opening
+	TSharedRef<SGLCManagerWindow> Window = SNew(SGLCManagerWindow).LoadApps(false);
 	
-	FGLCAppInfo SelectedAppInfo = AvailableApps[SelectedAppIndex];
-	FString FileName = FPaths::GetCleanFilename(ZipPath);
+	const FVector2D DrawSize(900.0f, 1200.0f);
+	TSharedRef<SVirtualWindow> VirtualWindow = SNew(SVirtualWindow).Size(DrawSize);
+	VirtualWindow->SetContent(Window);
+	TSharedRef<FHittestGrid> HitTestGrid = MakeShared<FHittestGrid>();
 	
-	UE_LOG(LogTemp, Log, TEXT("[GLC] Starting upload - App: %s, File: %s, Size: %lld bytes"), *SelectedAppInfo.Name, *FileName, FileSize);
+	UTextureRenderTarget2D* RenderTarget = FWidgetRenderer::CreateTargetFor(DrawSize, TF_Bilinear, false);
+	RenderTarget->AddToRoot();
+	FWidgetRenderer Renderer(false, true);
 	
-	// Update UI on game thread
-	AsyncTask(ENamedThreads::GameThread, [this]()
+	// One login or logout, then a frame: layout, paint and the render thread's share of it
+	auto TimeChanges = [&](bool bRebuild)
 	{
-		StatusMessage = TEXT("Checking upload limits...");
-		StatusMessageType = TEXT("Info");
-		UploadProgress = 0.1f;
-		if (StatusMessageText.IsValid())
-		{
-			StatusMessageText->SetText(FText::FromString(StatusMessage));
-		}
-	});
-	
-	// Step 1: Check if upload is allowed
-	ApiClient->CanUploadAsync(FileSize, UncompressedBuildSize, SelectedAppInfo.Id, 
-		[this, SelectedAppInfo, FileName, FileSize, ZipPath](bool bSuccess, FString Error, FGLCCanUploadResponse Response)
+		// Warm up caches, fonts and the allocator
+		Renderer.DrawWindow(RenderTarget, HitTestGrid, VirtualWindow, 1.0f, DrawSize, 1.0f / 60.0f);
+		FlushRenderingCommands();
+		
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
 		{
-			if (!bSuccess)
+			Window->ViewModel->Update([](FGLCManagerState& State)
 			{
-				AsyncTask(ENamedThreads::GameThread, [this, Error]()
-				{
-					StatusMessage = FString::Printf(TEXT("Upload check failed: %s"), *Error);
-					StatusMessageType = TEXT("Error");
-					bIsUploading = false;
-					UploadProgress = 0.0f;
-					if (StatusMessageText.IsValid())
-					{
-						StatusMessageText->SetText(FText::FromString(StatusMessage));
-					}
-				});
-				return;
-			}
-			
-			if (!Response.CanUpload)
+				State.bIsAuthenticated = !State.bIsAuthenticated;
+			});
+			if (bRebuild)
 			{
-				AsyncTask(ENamedThreads::GameThread, [this]()
-				{
-					StatusMessage = TEXT("Cannot upload. Check your plan limits.");
-					StatusMessageType = TEXT("Error");
-					bIsUploading = false;
-					UploadProgress = 0.0f;
-					if (StatusMessageText.IsValid())
-					{
-						StatusMessageText->SetText(FText::FromString(StatusMessage));
-					}
-				});
-				return;
+				Window->RebuildSections();
 			}
-			
-			AsyncTask(ENamedThreads::GameThread, [this]()
-			{
-				StatusMessage = TEXT("Starting upload...");
-				UploadProgress = 0.2f;
-				if (StatusMessageText.IsValid())
-				{
-					StatusMessageText->SetText(FText::FromString(StatusMessage));
-				}
-			});
-			
-			// Use default build notes if empty
-			FString Notes = BuildNotesInput.IsEmpty() ? TEXT("Uploaded from Unreal Engine Extension") : BuildNotesInput;
-			
-			// Step 2: Start upload and get presigned URL
-			ApiClient->StartUploadAsync(SelectedAppInfo.Id, FileName, FileSize, UncompressedBuildSize, Notes,
-				[this, ZipPath, FileSize](bool bSuccess, FString Error, FGLCStartUploadResponse Response)
-				{
-				if (!bSuccess)
-				{
-					AsyncTask(ENamedThreads::GameThread, [this, Error]()
-					{
-						StatusMessage = FString::Printf(TEXT("Failed to start upload: %s"), *Error);
-						StatusMessageType = TEXT("Error");
-						bIsUploading = false;
-						UploadProgress = 0.0f;
-						if (StatusMessageText.IsValid())
-						{
-							StatusMessageText->SetText(FText::FromString(StatusMessage));
-						}
-					});
-					return;
-				}
-				
-				AsyncTask(ENamedThreads::GameThread, [this]()
-				{
-					StatusMessage = TEXT("Uploading file to cloud...");
-					UploadProgress = 0.3f;
-					if (StatusMessageText.IsValid())
-					{
-						StatusMessageText->SetText(FText::FromString(StatusMessage));
-					}
-				});
-				CurrentBuildId = Response.AppBuildId;					// Track if we've already notified (since callback is called multiple times)
-					static bool bHasNotified = false;
-					bHasNotified = false;
-					
-					// Step 3: Upload file to cloud storage
-					ApiClient->UploadFileAsync(Response.UploadUrl, ZipPath,
-						[this, Response, FileSize](bool bSuccess, FString Error, float Progress)
-						{
-							// Check if upload was cancelled
-							if (!bSuccess && Progress < 0.0f)
-							{
-								AsyncTask(ENamedThreads::GameThread, [this, Error]()
-								{
-									StatusMessage = TEXT("⚠️ Upload cancelled by user");
-									StatusMessageType = TEXT("Warning");
-									bIsUploading = false;
-									UploadProgress = 0.0f;
-									if (StatusMessageText.IsValid())
-									{
-										StatusMessageText->SetText(FText::FromString(StatusMessage));
-									}
-								});
-								return;
-							}
-							
-							// Check if this is a real error (not just a progress update)
-							if (!bSuccess && Progress >= 1.0f)
-							{
-								// Only treat as error if upload is complete but failed
-								AsyncTask(ENamedThreads::GameThread, [this, Error]()
-								{
-									StatusMessage = FString::Printf(TEXT("Upload failed: %s"), *Error);
-									StatusMessageType = TEXT("Error");
-									bIsUploading = false;
-									UploadProgress = 0.0f;
-									if (StatusMessageText.IsValid())
-									{
-										StatusMessageText->SetText(FText::FromString(StatusMessage));
-									}
-								});
-								return;
-							}
-							
-							// Update progress (30% to 90%)
-							UploadProgress = 0.3f + (Progress * 0.6f);
-							
-							// Show progress with percentage and size
-							int32 Percentage = FMath::RoundToInt(Progress * 100.0f);
-							float SizeMB = FileSize / (1024.0f * 1024.0f);
-							StatusMessage = FString::Printf(TEXT("Uploading to cloud storage (%d%% of %.2f MB)..."), Percentage, SizeMB);
-							
-							// Update UI on game thread
-							AsyncTask(ENamedThreads::GameThread, [this]()
-							{
-								if (StatusMessageText.IsValid())
-								{
-									StatusMessageText->SetText(FText::FromString(StatusMessage));
-								}
-							});
-							
-							if (bSuccess && Progress >= 1.0f && !bHasNotified)
-							{
-								bHasNotified = true;
-								AsyncTask(ENamedThreads::GameThread, [this]()
-								{
-									StatusMessage = TEXT("Finalizing upload...");
-									UploadProgress = 0.95f;
-									if (StatusMessageText.IsValid())
-									{
-										StatusMessageText->SetText(FText::FromString(StatusMessage));
-									}
-								});
-								
-								// Step 4: Notify backend that file is ready
-								ApiClient->NotifyFileReadyAsync(Response.AppBuildId, Response.Key,
-									[this](bool bSuccess, FString Error)
-									{
-										if (!bSuccess)
-										{
-											AsyncTask(ENamedThreads::GameThread, [this, Error]()
-											{
-												StatusMessage = FString::Printf(TEXT("Failed to finalize upload: %s"), *Error);
-												StatusMessageType = TEXT("Error");
-												bIsUploading = false;
-												UploadProgress = 0.0f;
-												if (StatusMessageText.IsValid())
-												{
-													StatusMessageText->SetText(FText::FromString(StatusMessage));
-												}
-											});
-											return;
-										}
-										
-										AsyncTask(ENamedThreads::GameThread, [this]()
-										{
-											StatusMessage = TEXT("Upload completed! Your build is now processing.");
-											StatusMessageType = TEXT("Success");
-											bIsUploading = false;
-											UploadProgress = 1.0f;
-											if (StatusMessageText.IsValid())
-											{
-												StatusMessageText->SetText(FText::FromString(StatusMessage));
-											}
-										});
-										
-										// Start monitoring build status
-										StartBuildStatusMonitoring(CurrentBuildId);
-									});
-							}
-						});
-				});
-		});
+			Renderer.DrawWindow(RenderTarget, HitTestGrid, VirtualWindow, 1.0f, DrawSize, 1.0f / 60.0f);
+		}
+		FlushRenderingCommands();
+		return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) / Iterations;
+	};
+	
+	// In place first: rebuilding replaces the sections built once
+	const double InPlaceMilliseconds = TimeChanges(false);
+	const double RebuildMilliseconds = TimeChanges(true);
+	
+	RenderTarget->RemoveFromRoot();
+	
+	UE_LOG(LogTemp, Display, TEXT("[GLC] Manager window, %d logins and logouts at %.0fx%.0f: rebuilt %.2f ms, in place %.2f ms, %.1fx faster"),
+		Iterations, DrawSize.X, DrawSize.Y, RebuildMilliseconds, InPlaceMilliseconds, RebuildMilliseconds / FMath::Max(InPlaceMilliseconds, 0.001));
 }
 
+static FAutoConsoleCommand GLCBenchmarkManagerWindowCommand(
+	TEXT("GLC.BenchmarkManagerWindow"),
+	TEXT("Times a login or logout and the frame after it in the manager window, rebuilt against updated in place. Usage: GLC.BenchmarkManagerWindow [Iterations=100]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		SGLCManagerWindow::RunUpdateBenchmark(Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100);
+	}));
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,353 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCMultipartUploader.h"
+#include "GLCUploadJournal.h"
+#include "Async/Async.h"
+
+FGLCMultipartUploader::FGLCMultipartUploader(FGLCApiClient* InApiClient, const FGLCStartMultipartUploadResponse& InUpload, const FString& InFilePath, int64 InFileSize, int32 InMaxConcurrency, TSharedPtr<FGLCUploadJournal> InJournal)
+	: ApiClient(InApiClient)
+	, Upload(InUpload)
+	, FilePath(InFilePath)
+	, FileSize(InFileSize)
+	, MaxConcurrency(FMath::Max(1, InMaxConcurrency))
+	, Journal(InJournal)
+	, TotalPartCount(InUpload.Parts.Num())
+	, CompletedBytes(0)
+	, bCancelRequested(false)
+	, bCancelled(false)
+	, bFailed(false)
+	, bFinished(false)
+{
+	if (Journal.IsValid())
+	{
+		TotalPartCount = Journal->PartCount;
+		CompletedParts = Journal->CompletedParts;
+		for (const FGLCCompletedPart& Part : CompletedParts)
+		{
+			CompletedBytes += GetPartLength(Part.PartNumber, Upload.PartSize, FileSize);
+		}
+	}
+}
+
+int64 FGLCMultipartUploader::GetPartLength(int32 PartNumber, int64 PartSize, int64 FileSize)
+{
+	int64 Offset = GetPartOffset(PartNumber, PartSize);
+	return FMath::Clamp<int64>(FileSize - Offset, 0, PartSize);
+}
+
+bool FGLCMultipartUploader::ValidatePartSize(int64 PartSize, int64 FileSize, FString& OutError)
+{
+	if (PartSize <= 0)
+	{
+		OutError = FString::Printf(TEXT("invalid part size %lld"), PartSize);
+		return false;
+	}
+
+	// A single part is also the last one, which may be smaller
+	if (PartSize < MinPartSize && FileSize > PartSize)
+	{
+		OutError = FString::Printf(TEXT("part size %lld is below the %lld bytes minimum"), PartSize, MinPartSize);
+		return false;
+	}
+
+	return true;
+}
+
+bool FGLCMultipartUploader::ValidateParts(int64 PartSize, int64 FileSize, const TArray<int32>& PartNumbers, FString& OutError)
+{
+	if (!ValidatePartSize(PartSize, FileSize, OutError))
+	{
+		return false;
+	}
+
+	const int64 PartCount = FMath::Max<int64>(FMath::DivideAndRoundUp(FileSize, PartSize), 1);
+	if (PartNumbers.Num() != PartCount)
+	{
+		OutError = FString::Printf(TEXT("expected %lld parts, got %d"), PartCount, PartNumbers.Num());
+		return false;
+	}
+
+	TBitArray<> Seen(false, (int32)PartCount);
+	for (int32 PartNumber : PartNumbers)
+	{
+		if (PartNumber < 1 || PartNumber > PartCount)
+		{
+			OutError = FString::Printf(TEXT("part number %d is outside 1-%lld"), PartNumber, PartCount);
+			return false;
+		}
+		if (Seen[PartNumber - 1])
+		{
+			OutError = FString::Printf(TEXT("part number %d is listed twice"), PartNumber);
+			return false;
+		}
+		Seen[PartNumber - 1] = true;
+	}
+
+	return true;
+}
+
+void FGLCMultipartUploader::Start(TFunction<void(bool, FString, float)> InProgressCallback)
+{
+	ProgressCallback = InProgressCallback;
+
+	// Parts still to send and parts already sent must make up the whole file, each exactly once
+	TArray<int32> PartNumbers;
+	PartNumbers.Reserve(Upload.Parts.Num() + CompletedParts.Num());
+	for (const FGLCMultipartPartUrl& Part : Upload.Parts)
+	{
+		PartNumbers.Add(Part.PartNumber);
+	}
+	for (const FGLCCompletedPart& Part : CompletedParts)
+	{
+		PartNumbers.Add(Part.PartNumber);
+	}
+
+	FString PartsError;
+	if (!ValidateParts(Upload.PartSize, FileSize, PartNumbers, PartsError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Invalid multipart upload: %s"), *PartsError);
+		Finish(false, FString::Printf(TEXT("Upload failed: invalid upload parts (%s)"), *PartsError), 1.0f);
+		return;
+	}
+	if (PartNumbers.Num() != TotalPartCount)
+	{
+		Finish(false, FString::Printf(TEXT("Upload failed: invalid upload parts (expected %d parts, got %d)"), TotalPartCount, PartNumbers.Num()), 1.0f);
+		return;
+	}
+	
+	if (CompletedParts.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GLC] Resuming multipart upload: %d/%d parts already uploaded"), CompletedParts.Num(), TotalPartCount);
+	}
+	
+	// Part checksums must be known before a part is sent; one sequential pass gives them all
+	TSharedRef<FGLCMultipartUploader, ESPMode::ThreadSafe> This = AsShared();
+	Async(EAsyncExecution::ThreadPool, [This]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		bool bSuccess = FGLCFileHasher::HashFile(This->FilePath, This->FileHash, This->Upload.PartSize, &This->PartChecksums, &This->bCancelRequested);
+		if (bSuccess)
+		{
+			const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+			UE_LOG(LogTemp, Log, TEXT("[GLC] Hashed %lld bytes in %.2fs (%.0f MB/s)"), This->FileSize, Seconds, This->FileSize / Seconds / (1024.0 * 1024.0));
+		}
+		
+		AsyncTask(ENamedThreads::GameThread, [This, bSuccess]()
+		{
+			This->OnFileHashed(bSuccess);
+		});
+	});
+}
+
+void FGLCMultipartUploader::OnFileHashed(bool bSuccess)
+{
+	if (bFinished)
+	{
+		return;
+	}
+	
+	if (!bSuccess)
+	{
+		Finish(false, TEXT("Upload failed: could not read the archive"), 1.0f);
+		return;
+	}
+	
+	// Parts restored from a journal written before checksums were recorded
+	for (FGLCCompletedPart& Part : CompletedParts)
+	{
+		if (Part.ChecksumSha256.IsEmpty() && PartChecksums.IsValidIndex(Part.PartNumber - 1))
+		{
+			Part.ChecksumSha256 = PartChecksums[Part.PartNumber - 1];
+		}
+	}
+	
+	if (CompletedParts.Num() >= TotalPartCount)
+	{
+		CompleteUpload();
+		return;
+	}
+
+	PartBytesSent.SetNumZeroed(Upload.Parts.Num());
+	for (int32 PartIndex = 0; PartIndex < Upload.Parts.Num(); PartIndex++)
+	{
+		PendingParts.Add(PartIndex);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Multipart upload started: %d parts of %lld bytes, %d concurrent"), PendingParts.Num(), Upload.PartSize, MaxConcurrency);
+
+	LaunchPendingParts();
+}
+
+void FGLCMultipartUploader::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bCancelled = true;
+	bCancelRequested = true;
+	PendingParts.Empty();
+
+	// Copy first: cancelling may complete the request and modify the map
+	TArray<FGLCRetryingRequestPtr> Requests;
+	InFlightRequests.GenerateValueArray(Requests);
+	for (const FGLCRetryingRequestPtr& Request : Requests)
+	{
+		Request->Cancel();
+	}
+
+	Finish(false, TEXT("Upload cancelled"), -1.0f);
+}
+
+void FGLCMultipartUploader::LaunchPendingParts()
+{
+	while (!bCancelled && !bFailed && PendingParts.Num() > 0 && InFlightRequests.Num() < MaxConcurrency)
+	{
+		int32 PartIndex = PendingParts[0];
+		PendingParts.RemoveAt(0);
+
+		const FGLCMultipartPartUrl& Part = Upload.Parts[PartIndex];
+		int64 Offset = GetPartOffset(Part.PartNumber, Upload.PartSize);
+		int64 Length = GetPartLength(Part.PartNumber, Upload.PartSize, FileSize);
+		const FString Checksum = PartChecksums.IsValidIndex(Part.PartNumber - 1) ? PartChecksums[Part.PartNumber - 1] : FString();
+
+		TWeakPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+		FGLCRetryingRequestPtr Request = ApiClient->UploadPartAsync(Part.Url, FilePath, Offset, Length,
+			[WeakThis, PartIndex](int64 BytesSent)
+			{
+				if (TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->OnPartBytesSent(PartIndex, BytesSent);
+				}
+			},
+			[WeakThis, PartIndex](bool bSuccess, FString Error, FString ETag)
+			{
+				if (TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->OnPartFinished(PartIndex, bSuccess, Error, ETag);
+				}
+			},
+			Checksum);
+
+		if (!Request.IsValid())
+		{
+			OnPartFinished(PartIndex, false, TEXT("Failed to read file"), FString());
+			return;
+		}
+
+		InFlightRequests.Add(PartIndex, Request);
+	}
+}
+
+void FGLCMultipartUploader::OnPartBytesSent(int32 PartIndex, int64 BytesSent)
+{
+	if (bFinished || !PartBytesSent.IsValidIndex(PartIndex))
+	{
+		return;
+	}
+
+	PartBytesSent[PartIndex] = BytesSent;
+
+	int64 InFlightBytes = 0;
+	for (const TPair<int32, FGLCRetryingRequestPtr>& Pair : InFlightRequests)
+	{
+		InFlightBytes += PartBytesSent[Pair.Key];
+	}
+
+	float Progress = FileSize > 0 ? (float)(CompletedBytes + InFlightBytes) / (float)FileSize : 0.0f;
+
+	// Never report 100% until the upload has been completed on the server
+	ProgressCallback(false, TEXT("Uploading..."), FMath::Min(Progress, 0.99f));
+}
+
+void FGLCMultipartUploader::OnPartFinished(int32 PartIndex, bool bSuccess, const FString& Error, const FString& ETag)
+{
+	InFlightRequests.Remove(PartIndex);
+
+	if (bFinished || bCancelled)
+	{
+		return;
+	}
+
+	const FGLCMultipartPartUrl& Part = Upload.Parts[PartIndex];
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Part %d failed: %s"), Part.PartNumber, *Error);
+		bFailed = true;
+		Cancel();
+		return;
+	}
+
+	FGLCCompletedPart CompletedPart;
+	CompletedPart.PartNumber = Part.PartNumber;
+	CompletedPart.ETag = ETag;
+	CompletedPart.ChecksumSha256 = PartChecksums.IsValidIndex(Part.PartNumber - 1) ? PartChecksums[Part.PartNumber - 1] : FString();
+	CompletedParts.Add(CompletedPart);
+	
+	if (Journal.IsValid())
+	{
+		Journal->AddCompletedPart(CompletedPart);
+	}
+
+	int64 PartLength = GetPartLength(Part.PartNumber, Upload.PartSize, FileSize);
+	CompletedBytes += PartLength;
+	PartBytesSent[PartIndex] = 0;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[GLC] Part %d/%d uploaded (%lld bytes)"), CompletedParts.Num(), TotalPartCount, PartLength);
+
+	if (CompletedParts.Num() >= TotalPartCount)
+	{
+		CompleteUpload();
+		return;
+	}
+
+	LaunchPendingParts();
+}
+
+void FGLCMultipartUploader::CompleteUpload()
+{
+	CompletedParts.Sort([](const FGLCCompletedPart& A, const FGLCCompletedPart& B) { return A.PartNumber < B.PartNumber; });
+
+	ProgressCallback(false, TEXT("Completing upload..."), 0.99f);
+
+	TWeakPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	ApiClient->CompleteMultipartUploadAsync(Upload.AppBuildId, Upload.Key, Upload.UploadId, CompletedParts,
+		[WeakThis](bool bSuccess, FString Error)
+		{
+			if (TSharedPtr<FGLCMultipartUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				if (bSuccess)
+				{
+					if (This->Journal.IsValid())
+					{
+						This->Journal->bUploadCompleted = true;
+						This->Journal->Save();
+					}
+					This->Finish(true, TEXT("Upload completed"), 1.0f);
+				}
+				else
+				{
+					This->Finish(false, FString::Printf(TEXT("Upload failed: %s"), *Error), 1.0f);
+				}
+			}
+		}, -1, &FileHash);
+}
+
+void FGLCMultipartUploader::Finish(bool bSuccess, const FString& Message, float Progress)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	// A failed part cancels the others, but the caller should see the failure, not a cancellation
+	float ReportedProgress = (bFailed && Progress < 0.0f) ? 1.0f : Progress;
+	FString ReportedMessage = (bFailed && Progress < 0.0f) ? TEXT("Upload failed: a part could not be uploaded") : Message;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Multipart upload finished: %s"), *ReportedMessage);
+	ProgressCallback(bSuccess, ReportedMessage, ReportedProgress);
+}
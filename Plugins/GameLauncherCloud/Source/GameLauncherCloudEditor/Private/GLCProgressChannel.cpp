@@ -0,0 +1,171 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCProgressChannel.h"
+#include "Misc/ScopeLock.h"
+
+FGLCProgressChannel::FGLCProgressChannel()
+	: ProgressPpm(0)
+	, BytesDone(-1)
+	, BytesTotal(0)
+	, StageHash(0)
+	, Version(0)
+	, SampledVersion(0)
+	, SampledStageHash(0)
+	, LastSampleTime(-1.0)
+	, LastProgress(0.0f)
+	, LastBytesDone(-1)
+	, SmoothedProgressRate(0.0)
+	, SmoothedBytesPerSecond(0.0)
+	, SmoothingWeight(0.0)
+{
+}
+
+void FGLCProgressChannel::Update(float Progress)
+{
+	BytesDone = -1;
+	BytesTotal = 0;
+	ProgressPpm = FMath::RoundToInt(FMath::Clamp(Progress, 0.0f, 1.0f) * 1000000.0f);
+	Version++;
+}
+
+void FGLCProgressChannel::UpdateBytes(float Progress, int64 InBytesDone, int64 InBytesTotal)
+{
+	BytesDone = FMath::Max<int64>(InBytesDone, 0);
+	BytesTotal = InBytesTotal;
+	ProgressPpm = FMath::RoundToInt(FMath::Clamp(Progress, 0.0f, 1.0f) * 1000000.0f);
+	Version++;
+}
+
+void FGLCProgressChannel::SetStage(const FString& InStage)
+{
+	const uint32 Hash = GetTypeHash(InStage);
+	if (StageHash.Load(EMemoryOrder::Relaxed) == Hash)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&StageLock);
+		Stage = InStage;
+		StageHash = Hash;
+	}
+	Version++;
+}
+
+void FGLCProgressChannel::Reset()
+{
+	{
+		FScopeLock Lock(&StageLock);
+		Stage.Empty();
+		StageHash = 0;
+	}
+	ProgressPpm = 0;
+	BytesDone = -1;
+	BytesTotal = 0;
+
+	SampledStageHash = 0;
+	SampledStage.Empty();
+	LastSampleTime = -1.0;
+	LastProgress = 0.0f;
+	LastBytesDone = -1;
+	SmoothedProgressRate = 0.0;
+	SmoothedBytesPerSecond = 0.0;
+	SmoothingWeight = 0.0;
+	Version++;
+}
+
+bool FGLCProgressChannel::Sample(double Now, FSample& OutSample)
+{
+	const uint32 CurrentVersion = Version;
+	const float Progress = ProgressPpm / 1000000.0f;
+	const int64 CurrentBytesDone = BytesDone;
+
+	// The lock is only taken when the stage changed since the last sample
+	const uint32 CurrentStageHash = StageHash;
+	if (CurrentStageHash != SampledStageHash)
+	{
+		FScopeLock Lock(&StageLock);
+		SampledStage = Stage;
+		SampledStageHash = StageHash;
+	}
+
+	// Sampled at a fixed rate, so the rates decay while nothing is reported
+	const double Elapsed = Now - LastSampleTime;
+	if (LastSampleTime >= 0.0 && Elapsed > 0.0)
+	{
+		const double Alpha = 1.0 - FMath::Exp(-Elapsed / SmoothingSeconds);
+		SmoothedProgressRate += Alpha * ((Progress - LastProgress) / Elapsed - SmoothedProgressRate);
+		if (CurrentBytesDone >= 0 && LastBytesDone >= 0)
+		{
+			SmoothedBytesPerSecond += Alpha * ((CurrentBytesDone - LastBytesDone) / Elapsed - SmoothedBytesPerSecond);
+		}
+		SmoothingWeight += Alpha * (1.0 - SmoothingWeight);
+	}
+	LastSampleTime = Now;
+	LastProgress = Progress;
+	LastBytesDone = CurrentBytesDone;
+
+	OutSample.Progress = Progress;
+	OutSample.Stage = SampledStage;
+	OutSample.BytesDone = CurrentBytesDone;
+	OutSample.BytesTotal = BytesTotal;
+	OutSample.BytesPerSecond = 0.0;
+	OutSample.SecondsRemaining = -1.0;
+
+	// An estimate from the first few samples would jump around
+	if (SmoothingWeight >= 0.3)
+	{
+		OutSample.BytesPerSecond = FMath::Max(SmoothedBytesPerSecond / SmoothingWeight, 0.0);
+
+		const double ProgressRate = SmoothedProgressRate / SmoothingWeight;
+		if (ProgressRate > KINDA_SMALL_NUMBER)
+		{
+			OutSample.SecondsRemaining = (1.0 - Progress) / ProgressRate;
+		}
+	}
+
+	const bool bChanged = CurrentVersion != SampledVersion;
+	SampledVersion = CurrentVersion;
+	return bChanged;
+}
+
+FString FGLCProgressChannel::FormatMessage(const FSample& Sample)
+{
+	// Work without bytes reports a complete message of its own
+	if (Sample.BytesDone < 0)
+	{
+		return Sample.Stage;
+	}
+
+	TArray<FString> Details;
+	const int32 Percentage = Sample.BytesTotal > 0 ? (int32)(Sample.BytesDone * 100 / Sample.BytesTotal) : FMath::RoundToInt(Sample.Progress * 100.0f);
+	Details.Add(Sample.BytesTotal > 0
+		? FString::Printf(TEXT("%d%% of %.2f MB"), Percentage, Sample.BytesTotal / (1024.0 * 1024.0))
+		: FString::Printf(TEXT("%d%%"), Percentage));
+
+	if (Sample.BytesPerSecond > 0.0)
+	{
+		Details.Add(FString::Printf(TEXT("%.1f MB/s"), Sample.BytesPerSecond / (1024.0 * 1024.0)));
+	}
+
+	if (Sample.SecondsRemaining >= 0.0)
+	{
+		Details.Add(FString::Printf(TEXT("%s left"), *FormatDuration(Sample.SecondsRemaining)));
+	}
+
+	return FString::Printf(TEXT("%s (%s)"), *Sample.Stage, *FString::Join(Details, TEXT(", ")));
+}
+
+FString FGLCProgressChannel::FormatDuration(double Seconds)
+{
+	const int64 TotalSeconds = FMath::Max<int64>(FMath::CeilToInt64(Seconds), 0);
+	if (TotalSeconds >= 3600)
+	{
+		return FString::Printf(TEXT("%lldh %02lldm"), TotalSeconds / 3600, (TotalSeconds / 60) % 60);
+	}
+	if (TotalSeconds >= 60)
+	{
+		return FString::Printf(TEXT("%lldm %02llds"), TotalSeconds / 60, TotalSeconds % 60);
+	}
+	return FString::Printf(TEXT("%llds"), TotalSeconds);
+}
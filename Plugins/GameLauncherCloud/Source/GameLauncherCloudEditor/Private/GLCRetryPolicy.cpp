@@ -0,0 +1,226 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCRetryPolicy.h"
+#include "Interfaces/IHttpResponse.h"
+
+// ========== FGLCRetryPolicy ========== //
+
+bool FGLCRetryPolicy::ShouldRetry(int32 Attempt, FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded) const
+{
+	if (Attempt >= MaxAttempts)
+	{
+		return false;
+	}
+
+	if (Request.IsValid() && Request->GetFailureReason() == EHttpFailureReason::Cancelled)
+	{
+		return false;
+	}
+
+	// No response at all: the connection failed or timed out
+	if (!bSucceeded || !Response.IsValid())
+	{
+		return true;
+	}
+
+	return IsTransientStatus(Response->GetResponseCode());
+}
+
+float FGLCRetryPolicy::GetRetryDelay(int32 Attempt, FHttpResponsePtr Response) const
+{
+	// Exponential backoff with equal jitter: half of the delay is fixed, half is random
+	float Backoff = FMath::Min(MaxDelay, InitialDelay * FMath::Pow(2.0f, (float)FMath::Max(Attempt - 1, 0)));
+	float Delay = Backoff * 0.5f + FMath::FRandRange(0.0f, Backoff * 0.5f);
+
+	if (Response.IsValid())
+	{
+		float RetryAfter = ParseRetryAfter(Response->GetHeader(TEXT("Retry-After")));
+		if (RetryAfter > MaxRetryAfter)
+		{
+			return -1.0f;
+		}
+		Delay = FMath::Max(Delay, RetryAfter);
+	}
+
+	return Delay;
+}
+
+bool FGLCRetryPolicy::IsTransientStatus(int32 ResponseCode)
+{
+	switch (ResponseCode)
+	{
+	case 408: // Request Timeout
+	case 425: // Too Early
+	case 429: // Too Many Requests
+		return true;
+	case 501: // Not Implemented
+	case 505: // HTTP Version Not Supported
+		return false;
+	default:
+		return ResponseCode >= 500 && ResponseCode < 600;
+	}
+}
+
+float FGLCRetryPolicy::ParseRetryAfter(const FString& Value)
+{
+	FString Trimmed = Value.TrimStartAndEnd();
+	if (Trimmed.IsEmpty())
+	{
+		return -1.0f;
+	}
+
+	if (Trimmed.IsNumeric())
+	{
+		return FMath::Max(FCString::Atof(*Trimmed), 0.0f);
+	}
+
+	FDateTime RetryAt;
+	if (FDateTime::ParseHttpDate(Trimmed, RetryAt))
+	{
+		return FMath::Max((float)(RetryAt - FDateTime::UtcNow()).GetTotalSeconds(), 0.0f);
+	}
+
+	return -1.0f;
+}
+
+FGLCRetryPolicy FGLCRetryPolicy::NoRetry()
+{
+	FGLCRetryPolicy Policy;
+	Policy.MaxAttempts = 1;
+	return Policy;
+}
+
+// ========== FGLCRetryingRequest ========== //
+
+FGLCRetryingRequest::FGLCRetryingRequest(const FGLCRetryPolicy& InPolicy, FMakeRequest InMakeRequest, FHttpRequestCompleteDelegate InOnComplete, FSendRequest InSendRequest, FCancelRequest InCancelRequest)
+	: Policy(InPolicy)
+	, MakeRequest(MoveTemp(InMakeRequest))
+	, OnComplete(MoveTemp(InOnComplete))
+	, SendRequest(MoveTemp(InSendRequest))
+	, CancelRequest(MoveTemp(InCancelRequest))
+	, Attempt(0)
+	, bCancelled(false)
+	, bCompleted(false)
+{
+}
+
+FGLCRetryingRequestPtr FGLCRetryingRequest::Start(const FGLCRetryPolicy& Policy, FMakeRequest MakeRequest, FHttpRequestCompleteDelegate OnComplete, FSendRequest SendRequest, FCancelRequest CancelRequest)
+{
+	FGLCRetryingRequestPtr Request = MakeShareable(new FGLCRetryingRequest(Policy, MoveTemp(MakeRequest), MoveTemp(OnComplete), MoveTemp(SendRequest), MoveTemp(CancelRequest)));
+	if (!Request->SendAttempt())
+	{
+		return nullptr;
+	}
+	return Request;
+}
+
+bool FGLCRetryingRequest::SendAttempt()
+{
+	Attempt++;
+
+	FHttpRequestPtr Request = MakeRequest(Attempt);
+	if (!Request.IsValid())
+	{
+		return false;
+	}
+	CurrentRequest = Request;
+
+	// Keeps this alive until the attempt completed; callers do not have to hold on to it
+	TSharedRef<FGLCRetryingRequest, ESPMode::ThreadSafe> This = AsShared();
+	Request->OnProcessRequestComplete().BindLambda([This](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		This->OnAttemptComplete(CompletedRequest, Response, bSucceeded);
+	});
+
+	if (SendRequest)
+	{
+		SendRequest(Request.ToSharedRef());
+	}
+	else
+	{
+		Request->ProcessRequest();
+	}
+	return true;
+}
+
+void FGLCRetryingRequest::OnAttemptComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+	if (bCancelled || bCompleted || !Policy.ShouldRetry(Attempt, Request, Response, bSucceeded))
+	{
+		Complete(Request, Response, bSucceeded);
+		return;
+	}
+
+	float Delay = Policy.GetRetryDelay(Attempt, Response);
+	if (Delay < 0.0f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Server asked to retry after more than %.0fs, giving up"), Policy.MaxRetryAfter);
+		Complete(Request, Response, bSucceeded);
+		return;
+	}
+
+	// Presigned URLs carry their signature in the query string; keep it out of the log
+	FString Url = Request->GetURL();
+	Url.Split(TEXT("?"), &Url, nullptr);
+	FString Reason = Response.IsValid() ? FString::Printf(TEXT("HTTP %d"), Response->GetResponseCode()) : TEXT("no response");
+	UE_LOG(LogTemp, Warning, TEXT("[GLC] %s %s failed (%s), retrying in %.1fs (attempt %d of %d)"), *Request->GetVerb(), *Url, *Reason, Delay, Attempt + 1, Policy.MaxAttempts);
+
+	TSharedRef<FGLCRetryingRequest, ESPMode::ThreadSafe> This = AsShared();
+	RetryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([This, Request](float DeltaTime)
+	{
+		This->RetryTickerHandle.Reset();
+		if (!This->SendAttempt())
+		{
+			This->Complete(Request, nullptr, false);
+		}
+		return false;
+	}), Delay);
+}
+
+void FGLCRetryingRequest::Cancel()
+{
+	if (bCancelled || bCompleted)
+	{
+		return;
+	}
+	bCancelled = true;
+
+	if (RetryTickerHandle.IsValid())
+	{
+		// Waiting for the next attempt: nothing in flight to cancel
+		FTSTicker::GetCoreTicker().RemoveTicker(RetryTickerHandle);
+		RetryTickerHandle.Reset();
+		Complete(CurrentRequest, nullptr, false);
+	}
+	else if (CurrentRequest.IsValid())
+	{
+		// Completes the attempt, which completes this; the ref keeps the request alive through it
+		FRequestRef Request = CurrentRequest.ToSharedRef();
+		if (CancelRequest)
+		{
+			CancelRequest(Request);
+		}
+		else
+		{
+			Request->CancelRequest();
+		}
+	}
+}
+
+void FGLCRetryingRequest::Complete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+	if (bCompleted)
+	{
+		return;
+	}
+	bCompleted = true;
+
+	// The attempt's completion delegate holds this; dropping the request breaks the cycle
+	FHttpRequestCompleteDelegate Completion = MoveTemp(OnComplete);
+	CurrentRequest.Reset();
+	MakeRequest = nullptr;
+	SendRequest = nullptr;
+	CancelRequest = nullptr;
+
+	Completion.ExecuteIfBound(Request, Response, bSucceeded);
+}
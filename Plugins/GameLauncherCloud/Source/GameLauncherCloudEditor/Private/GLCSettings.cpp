@@ -0,0 +1,100 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCSettings.h"
+#include "GLCBuildStatusStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+FString FGLCSettings::GetConfigPath()
+{
+	return FPaths::ProjectPluginsDir() / TEXT("GameLauncherCloud/Config/glc_config.json");
+}
+
+FGLCSettings FGLCSettings::Load()
+{
+	FGLCSettings Settings;
+	
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetConfigPath()))
+	{
+		return Settings;
+	}
+	
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return Settings;
+	}
+	
+	JsonObject->TryGetStringField(TEXT("apiUrl"), Settings.ApiUrl);
+	JsonObject->TryGetStringField(TEXT("authToken"), Settings.AuthToken);
+	JsonObject->TryGetNumberField(TEXT("appListPageSize"), Settings.AppListPageSize);
+	
+	JsonObject->TryGetBoolField(TEXT("useMultipartUpload"), Settings.bUseMultipartUpload);
+	JsonObject->TryGetNumberField(TEXT("uploadConcurrency"), Settings.UploadConcurrency);
+	JsonObject->TryGetNumberField(TEXT("uploadPartSizeMB"), Settings.UploadPartSizeMB);
+	JsonObject->TryGetBoolField(TEXT("streamCompressedUpload"), Settings.bStreamCompressedUpload);
+	JsonObject->TryGetBoolField(TEXT("chunkedUpload"), Settings.bChunkedUpload);
+	JsonObject->TryGetNumberField(TEXT("chunkAverageSizeKB"), Settings.ChunkAverageSizeKB);
+	JsonObject->TryGetBoolField(TEXT("uploadPartChecksumHeader"), Settings.bSendPartChecksumHeader);
+	JsonObject->TryGetNumberField(TEXT("maxConcurrentBuilds"), Settings.MaxConcurrentBuilds);
+	JsonObject->TryGetNumberField(TEXT("retryMaxAttempts"), Settings.RetryMaxAttempts);
+	JsonObject->TryGetNumberField(TEXT("retryInitialDelaySeconds"), Settings.RetryInitialDelaySeconds);
+	JsonObject->TryGetNumberField(TEXT("retryMaxDelaySeconds"), Settings.RetryMaxDelaySeconds);
+	JsonObject->TryGetNumberField(TEXT("statusPollMaxIntervalSeconds"), Settings.StatusPollMaxIntervalSeconds);
+	JsonObject->TryGetBoolField(TEXT("statusStream"), Settings.bUseStatusStream);
+	JsonObject->TryGetStringField(TEXT("statusStreamUrl"), Settings.StatusStreamUrl);
+	
+	// Compression policy
+	const TArray<TSharedPtr<FJsonValue>>* StoreExtensions = nullptr;
+	if (JsonObject->TryGetArrayField(TEXT("compressionStoreExtensions"), StoreExtensions))
+	{
+		Settings.Compression.StoreExtensions.Empty();
+		for (const TSharedPtr<FJsonValue>& Value : *StoreExtensions)
+		{
+			FString Extension = Value->AsString().ToLower();
+			if (!Extension.IsEmpty())
+			{
+				Settings.Compression.StoreExtensions.Add(Extension.StartsWith(TEXT(".")) ? Extension : TEXT(".") + Extension);
+			}
+		}
+	}
+	
+	int32 FastDeflateAboveMB = (int32)(Settings.Compression.FastDeflateThreshold / (1024 * 1024));
+	JsonObject->TryGetNumberField(TEXT("compressionStoreEntropy"), Settings.Compression.StoreEntropyThreshold);
+	JsonObject->TryGetNumberField(TEXT("compressionFastDeflateAboveMB"), FastDeflateAboveMB);
+	JsonObject->TryGetNumberField(TEXT("compressionFastLevel"), Settings.Compression.FastDeflateLevel);
+	JsonObject->TryGetNumberField(TEXT("compressionHighLevel"), Settings.Compression.HighDeflateLevel);
+	
+	Settings.Compression.FastDeflateThreshold = FMath::Max(FastDeflateAboveMB, 0) * 1024LL * 1024LL;
+	Settings.Compression.FastDeflateLevel = FMath::Clamp(Settings.Compression.FastDeflateLevel, 1, 9);
+	Settings.Compression.HighDeflateLevel = FMath::Clamp(Settings.Compression.HighDeflateLevel, 1, 9);
+	
+	Settings.AppListPageSize = FMath::Clamp(Settings.AppListPageSize, 1, 500);
+	Settings.UploadConcurrency = FMath::Clamp(Settings.UploadConcurrency, 1, 32);
+	Settings.UploadPartSizeMB = FMath::Clamp(Settings.UploadPartSizeMB, 5, 5 * 1024);
+	Settings.ChunkAverageSizeKB = FMath::Clamp(Settings.ChunkAverageSizeKB, 64, 16 * 1024);
+	Settings.MaxConcurrentBuilds = FMath::Clamp(Settings.MaxConcurrentBuilds, 0, 16);
+	Settings.RetryMaxAttempts = FMath::Clamp(Settings.RetryMaxAttempts, 1, 20);
+	Settings.RetryInitialDelaySeconds = FMath::Clamp(Settings.RetryInitialDelaySeconds, 0.1f, 60.0f);
+	Settings.RetryMaxDelaySeconds = FMath::Clamp(Settings.RetryMaxDelaySeconds, Settings.RetryInitialDelaySeconds, 600.0f);
+	Settings.StatusPollMaxIntervalSeconds = FMath::Clamp(Settings.StatusPollMaxIntervalSeconds, 5.0f, 600.0f);
+	
+	return Settings;
+}
+
+FGLCRetryPolicy FGLCSettings::GetRetryPolicy() const
+{
+	FGLCRetryPolicy Policy;
+	Policy.MaxAttempts = RetryMaxAttempts;
+	Policy.InitialDelay = RetryInitialDelaySeconds;
+	Policy.MaxDelay = RetryMaxDelaySeconds;
+	return Policy;
+}
+
+FString FGLCSettings::GetStatusStreamUrl() const
+{
+	return StatusStreamUrl.IsEmpty() ? FGLCBuildStatusStream::GetStreamUrl(ApiUrl) : StatusStreamUrl;
+}
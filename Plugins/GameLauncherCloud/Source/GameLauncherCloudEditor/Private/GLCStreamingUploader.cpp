@@ -0,0 +1,439 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCStreamingUploader.h"
+#include "GLCZipWriter.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+/// <summary>
+/// Forwards the ZIP writer output into the uploader's part buffer
+/// </summary>
+class FGLCStreamingUploader::FPartSink : public FGLCZipSink
+{
+public:
+	explicit FPartSink(FGLCStreamingUploader& InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	virtual bool Write(const uint8* Data, int64 Num) override
+	{
+		return Owner.WriteCompressed(Data, Num);
+	}
+
+private:
+	FGLCStreamingUploader& Owner;
+};
+
+FGLCStreamingUploader::FGLCStreamingUploader(FGLCApiClient* InApiClient, const FGLCStartMultipartUploadResponse& InUpload, int32 InMaxConcurrency)
+	: ApiClient(InApiClient)
+	, Upload(InUpload)
+	, MaxConcurrency(FMath::Max(1, InMaxConcurrency))
+	, RingCapacity(MaxConcurrency + 1)
+	, PartsInRing(0)
+	, SlotFreedEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, bCancelRequested(false)
+	, UncompressedProcessed(0)
+	, UncompressedTotal(0)
+	, ProducedBytes(0)
+	, ProducedPartCount(0)
+	, NextPartNumber(1)
+	, PartsAwaitingUrl(0)
+	, UploadedBytes(0)
+	, bCompressionFinished(false)
+	, bFinished(false)
+{
+}
+
+FGLCStreamingUploader::~FGLCStreamingUploader()
+{
+	FPlatformProcess::ReturnSynchEventToPool(SlotFreedEvent);
+	SlotFreedEvent = nullptr;
+}
+
+void FGLCStreamingUploader::Start(const FString& SourceDirectory, const FGLCCompressionPolicy& Policy, TFunction<void(bool, FString, float)> InProgressCallback)
+{
+	ProgressCallback = InProgressCallback;
+
+	// Parts are held in TArrays, which are limited to int32 sizes
+	if (Upload.PartSize <= 0 || Upload.PartSize > MAX_int32)
+	{
+		Finish(false, TEXT("Upload failed: invalid part size"), 1.0f);
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Streamed upload started: parts of %lld bytes, %d concurrent, ring of %d parts"), Upload.PartSize, MaxConcurrency, RingCapacity);
+
+	CurrentPart.Reserve((int32)Upload.PartSize);
+
+	// Dedicated thread: the compressor blocks while the ring is full
+	TSharedRef<FGLCStreamingUploader, ESPMode::ThreadSafe> This = AsShared();
+	Async(EAsyncExecution::Thread, [This, SourceDirectory, Policy]()
+	{
+		This->RunCompression(SourceDirectory, Policy);
+	});
+}
+
+void FGLCStreamingUploader::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	Stop();
+	Finish(false, TEXT("Upload cancelled"), -1.0f);
+}
+
+// ========== COMPRESSION THREAD ========== //
+
+void FGLCStreamingUploader::RunCompression(const FString& SourceDirectory, const FGLCCompressionPolicy& Policy)
+{
+	FPartSink Sink(*this);
+	FGLCZipWriter ZipWriter(Policy);
+
+	bool bSuccess = ZipWriter.WriteDirectory(SourceDirectory, Sink,
+		[this](int64 BytesProcessed, int64 TotalBytes)
+		{
+			UncompressedProcessed = BytesProcessed;
+			UncompressedTotal = TotalBytes;
+		},
+		&bCancelRequested);
+
+	// The last part is usually smaller than the part size
+	if (bSuccess)
+	{
+		bSuccess = PushCurrentPart();
+	}
+	if (bSuccess)
+	{
+		ArchiveHash = ArchiveHasher.Finalize();
+	}
+
+	FString Error = bSuccess ? FString() : ZipWriter.GetLastError();
+
+	TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess, Error]()
+	{
+		if (TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+		{
+			This->OnCompressionFinished(bSuccess, Error);
+		}
+	});
+}
+
+bool FGLCStreamingUploader::WriteCompressed(const uint8* Data, int64 Num)
+{
+	while (Num > 0)
+	{
+		if (bCancelRequested)
+		{
+			return false;
+		}
+
+		int64 ToCopy = FMath::Min(Upload.PartSize - CurrentPart.Num(), Num);
+		CurrentPart.Append(Data, (int32)ToCopy);
+		Data += ToCopy;
+		Num -= ToCopy;
+
+		if (CurrentPart.Num() >= Upload.PartSize && !PushCurrentPart())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FGLCStreamingUploader::PushCurrentPart()
+{
+	if (CurrentPart.Num() == 0)
+	{
+		return true;
+	}
+
+	const int64 PartLength = CurrentPart.Num();
+
+	// Hash here, while the part is hot in cache and off the game thread
+	ArchiveHasher.Update(CurrentPart.GetData(), PartLength);
+	FString Checksum = FGLCSha256::HashBuffer(CurrentPart.GetData(), PartLength).ToBase64();
+
+	// Wait for a free slot in the ring
+	while (true)
+	{
+		if (bCancelRequested)
+		{
+			return false;
+		}
+
+		{
+			FScopeLock Lock(&Mutex);
+			if (PartsInRing < RingCapacity)
+			{
+				PartsInRing++;
+				FReadyPart& Part = ReadyParts.AddDefaulted_GetRef();
+				Part.PartNumber = NextPartNumber++;
+				Part.Data = MoveTemp(CurrentPart);
+				Part.ChecksumSha256 = MoveTemp(Checksum);
+				break;
+			}
+		}
+
+		SlotFreedEvent->Wait(100);
+	}
+
+	ProducedBytes += PartLength;
+	ProducedPartCount++;
+
+	CurrentPart = TArray<uint8>();
+	CurrentPart.Reserve((int32)Upload.PartSize);
+
+	TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+	{
+		if (TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+		{
+			This->LaunchReadyParts();
+		}
+	});
+
+	return true;
+}
+
+// ========== GAME THREAD ========== //
+
+void FGLCStreamingUploader::LaunchReadyParts()
+{
+	while (!bFinished && InFlightRequests.Num() + PartsAwaitingUrl < MaxConcurrency)
+	{
+		TSharedPtr<FReadyPart> Part = MakeShared<FReadyPart>();
+		{
+			FScopeLock Lock(&Mutex);
+			if (ReadyParts.Num() == 0)
+			{
+				break;
+			}
+			*Part = MoveTemp(ReadyParts[0]);
+			ReadyParts.RemoveAt(0);
+		}
+
+		PartsAwaitingUrl++;
+
+		// The part count is unknown until compression ends, so URLs are requested as parts become ready
+		TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+		ApiClient->GetMultipartPartUrlsAsync(Upload.AppBuildId, Upload.Key, Upload.UploadId, { Part->PartNumber },
+			[WeakThis, Part](bool bSuccess, FString Error, TArray<FGLCMultipartPartUrl> Urls, int32 StatusCode)
+			{
+				TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin();
+				if (!This.IsValid())
+				{
+					return;
+				}
+
+				This->PartsAwaitingUrl--;
+
+				if (This->bFinished)
+				{
+					This->ReleaseSlot();
+					return;
+				}
+
+				if (!bSuccess || Urls.Num() == 0 || Urls[0].PartNumber != Part->PartNumber)
+				{
+					This->ReleaseSlot();
+					This->Fail(FString::Printf(TEXT("Upload failed: no URL for part %d (%s)"), Part->PartNumber, *Error));
+					return;
+				}
+
+				This->UploadPart(Part->PartNumber, MoveTemp(Part->Data), Part->ChecksumSha256, Urls[0].Url);
+			});
+	}
+}
+
+void FGLCStreamingUploader::UploadPart(int32 PartNumber, TArray<uint8>&& Data, const FString& ChecksumSha256, const FString& Url)
+{
+	const int64 PartLength = Data.Num();
+	PartBytesSent.Add(PartNumber, 0);
+
+	TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	FGLCRetryingRequestPtr Request = ApiClient->UploadPartDataAsync(Url, MoveTemp(Data),
+		[WeakThis, PartNumber](int64 BytesSent)
+		{
+			if (TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->OnPartBytesSent(PartNumber, BytesSent);
+			}
+		},
+		[WeakThis, PartNumber, PartLength, ChecksumSha256](bool bSuccess, FString Error, FString ETag)
+		{
+			if (TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->OnPartFinished(PartNumber, PartLength, ChecksumSha256, bSuccess, Error, ETag);
+			}
+		},
+		ChecksumSha256);
+
+	InFlightRequests.Add(PartNumber, Request);
+}
+
+void FGLCStreamingUploader::OnPartBytesSent(int32 PartNumber, int64 BytesSent)
+{
+	if (bFinished || !PartBytesSent.Contains(PartNumber))
+	{
+		return;
+	}
+
+	PartBytesSent[PartNumber] = BytesSent;
+	ReportProgress();
+}
+
+void FGLCStreamingUploader::OnPartFinished(int32 PartNumber, int64 PartLength, const FString& ChecksumSha256, bool bSuccess, const FString& Error, const FString& ETag)
+{
+	InFlightRequests.Remove(PartNumber);
+	PartBytesSent.Remove(PartNumber);
+	ReleaseSlot();
+
+	if (bFinished || bCancelRequested)
+	{
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Part %d failed: %s"), PartNumber, *Error);
+		Fail(TEXT("Upload failed: a part could not be uploaded"));
+		return;
+	}
+
+	FGLCCompletedPart CompletedPart;
+	CompletedPart.PartNumber = PartNumber;
+	CompletedPart.ETag = ETag;
+	CompletedPart.ChecksumSha256 = ChecksumSha256;
+	CompletedParts.Add(CompletedPart);
+	UploadedBytes += PartLength;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[GLC] Streamed part %d uploaded (%lld bytes)"), PartNumber, PartLength);
+
+	if (bCompressionFinished && CompletedParts.Num() >= ProducedPartCount)
+	{
+		CompleteUpload();
+		return;
+	}
+
+	ReportProgress();
+	LaunchReadyParts();
+}
+
+void FGLCStreamingUploader::OnCompressionFinished(bool bSuccess, const FString& Error)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		Fail(FString::Printf(TEXT("Compression failed: %s"), *Error));
+		return;
+	}
+
+	bCompressionFinished = true;
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Streamed compression finished: %lld bytes in %d parts"), ProducedBytes.Load(), ProducedPartCount.Load());
+
+	if (CompletedParts.Num() >= ProducedPartCount)
+	{
+		CompleteUpload();
+		return;
+	}
+
+	LaunchReadyParts();
+}
+
+void FGLCStreamingUploader::ReleaseSlot()
+{
+	{
+		FScopeLock Lock(&Mutex);
+		PartsInRing--;
+	}
+	SlotFreedEvent->Trigger();
+}
+
+void FGLCStreamingUploader::ReportProgress()
+{
+	int64 InFlightBytes = 0;
+	for (const TPair<int32, int64>& Pair : PartBytesSent)
+	{
+		InFlightBytes += Pair.Value;
+	}
+
+	// The archive size is only known at the end; extrapolate it from the compression ratio so far
+	double Produced = (double)ProducedBytes.Load();
+	double Processed = (double)UncompressedProcessed.Load();
+	double EstimatedSize = bCompressionFinished ? Produced : (Processed > 0.0 ? Produced * (double)UncompressedTotal.Load() / Processed : 0.0);
+
+	float Progress = EstimatedSize > 0.0 ? (float)((double)(UploadedBytes + InFlightBytes) / EstimatedSize) : 0.0f;
+
+	// Never report 100% until the upload has been completed on the server
+	ProgressCallback(false, TEXT("Compressing and uploading to cloud storage"), FMath::Min(Progress, 0.99f));
+}
+
+void FGLCStreamingUploader::CompleteUpload()
+{
+	CompletedParts.Sort([](const FGLCCompletedPart& A, const FGLCCompletedPart& B) { return A.PartNumber < B.PartNumber; });
+
+	ProgressCallback(false, TEXT("Completing upload..."), 0.99f);
+
+	TWeakPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	ApiClient->CompleteMultipartUploadAsync(Upload.AppBuildId, Upload.Key, Upload.UploadId, CompletedParts,
+		[WeakThis](bool bSuccess, FString Error)
+		{
+			if (TSharedPtr<FGLCStreamingUploader, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				if (bSuccess)
+				{
+					This->Finish(true, TEXT("Upload completed"), 1.0f);
+				}
+				else
+				{
+					This->Finish(false, FString::Printf(TEXT("Upload failed: %s"), *Error), 1.0f);
+				}
+			}
+		},
+		ProducedBytes.Load(), &ArchiveHash);
+}
+
+void FGLCStreamingUploader::Fail(const FString& Message)
+{
+	Stop();
+	Finish(false, Message, 1.0f);
+}
+
+void FGLCStreamingUploader::Stop()
+{
+	// Stop the compressor and wake it if it is waiting for a slot
+	bCancelRequested = true;
+	SlotFreedEvent->Trigger();
+
+	// Copy first: cancelling may complete the request and modify the map
+	TArray<FGLCRetryingRequestPtr> Requests;
+	InFlightRequests.GenerateValueArray(Requests);
+	for (const FGLCRetryingRequestPtr& Request : Requests)
+	{
+		Request->Cancel();
+	}
+}
+
+void FGLCStreamingUploader::Finish(bool bSuccess, const FString& Message, float Progress)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Streamed upload finished: %s"), *Message);
+	ProgressCallback(bSuccess, Message, Progress);
+}
@@ -0,0 +1,405 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCUatRunner.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+namespace GLCUat
+{
+	struct FStageBanner
+	{
+		const TCHAR* Banner;
+		EGLCUatStage Stage;
+	};
+
+	// UAT prints "********** <NAME> COMMAND STARTED **********" when each phase begins
+	static const FStageBanner StageBanners[] =
+	{
+		{ TEXT("BUILD COMMAND STARTED"), EGLCUatStage::Build },
+		{ TEXT("COOK COMMAND STARTED"), EGLCUatStage::Cook },
+		{ TEXT("STAGE COMMAND STARTED"), EGLCUatStage::Stage },
+		{ TEXT("PACKAGE COMMAND STARTED"), EGLCUatStage::Package },
+		{ TEXT("ARCHIVE COMMAND STARTED"), EGLCUatStage::Archive },
+	};
+
+	/** Share of the whole run at which each stage starts; cooking dominates most builds */
+	static float GetStageStart(EGLCUatStage Stage)
+	{
+		switch (Stage)
+		{
+		case EGLCUatStage::Build:    return 0.0f;
+		case EGLCUatStage::Cook:     return 0.3f;
+		case EGLCUatStage::Stage:    return 0.8f;
+		case EGLCUatStage::Package:  return 0.9f;
+		case EGLCUatStage::Archive:  return 0.95f;
+		case EGLCUatStage::Finished: return 1.0f;
+		default:                     return 0.0f;
+		}
+	}
+
+	static float GetStageEnd(EGLCUatStage Stage)
+	{
+		switch (Stage)
+		{
+		case EGLCUatStage::Build:   return 0.3f;
+		case EGLCUatStage::Cook:    return 0.8f;
+		case EGLCUatStage::Stage:   return 0.9f;
+		case EGLCUatStage::Package: return 0.95f;
+		case EGLCUatStage::Archive: return 1.0f;
+		default:                    return GetStageStart(Stage);
+		}
+	}
+
+	/** Searches raw UTF-8 output for an ASCII marker without converting the line */
+	static bool ContainsAscii(const uint8* Data, int32 Num, const ANSICHAR* Marker)
+	{
+		const int32 MarkerLength = FCStringAnsi::Strlen(Marker);
+		for (int32 Index = 0; Index + MarkerLength <= Num; Index++)
+		{
+			if (Data[Index] == (uint8)Marker[0] && FMemory::Memcmp(Data + Index, Marker, MarkerLength) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Reads the number following Label, e.g. "Total 1801" */
+	static bool ParseCount(const FString& Line, const TCHAR* Label, int32& OutValue)
+	{
+		int32 Index = Line.Find(Label, ESearchCase::CaseSensitive);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		const TCHAR* Digits = *Line + Index + FCString::Strlen(Label);
+		while (*Digits == TEXT(' '))
+		{
+			Digits++;
+		}
+		if (!FChar::IsDigit(*Digits))
+		{
+			return false;
+		}
+		OutValue = FCString::Atoi(Digits);
+		return true;
+	}
+}
+
+// ========== ROTATING LOG ========== //
+
+FGLCRotatingLog::FGLCRotatingLog(const FString& InFilePath, int64 InMaxFileSize, int32 InMaxBackups)
+	: FilePath(InFilePath)
+	, MaxFileSize(InMaxFileSize)
+	, MaxBackups(FMath::Max(0, InMaxBackups))
+{
+}
+
+FGLCRotatingLog::~FGLCRotatingLog()
+{
+	Close();
+}
+
+FString FGLCRotatingLog::GetBackupPath(int32 Index) const
+{
+	return FPaths::GetPath(FilePath) / FString::Printf(TEXT("%s.%d%s"), *FPaths::GetBaseFilename(FilePath), Index, *FPaths::GetExtension(FilePath, true));
+}
+
+void FGLCRotatingLog::Rotate()
+{
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.FileExists(*FilePath))
+	{
+		return;
+	}
+
+	if (MaxBackups == 0)
+	{
+		FileManager.Delete(*FilePath, false, true, true);
+		return;
+	}
+
+	FileManager.Delete(*GetBackupPath(MaxBackups), false, true, true);
+	for (int32 Index = MaxBackups - 1; Index >= 1; Index--)
+	{
+		FString Source = GetBackupPath(Index);
+		if (FileManager.FileExists(*Source))
+		{
+			FileManager.Move(*GetBackupPath(Index + 1), *Source, true, true);
+		}
+	}
+	FileManager.Move(*GetBackupPath(1), *FilePath, true, true);
+}
+
+bool FGLCRotatingLog::Open()
+{
+	Close();
+	Rotate();
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_AllowRead));
+	return Writer.IsValid();
+}
+
+void FGLCRotatingLog::WriteLine(const uint8* Utf8Data, int32 Num)
+{
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	if (Writer->Tell() + Num + 1 > MaxFileSize && Writer->Tell() > 0)
+	{
+		Open();
+		if (!Writer.IsValid())
+		{
+			return;
+		}
+	}
+
+	uint8 NewLine = '\n';
+	Writer->Serialize(const_cast<uint8*>(Utf8Data), Num);
+	Writer->Serialize(&NewLine, 1);
+}
+
+void FGLCRotatingLog::Close()
+{
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+}
+
+// ========== UAT RUNNER ========== //
+
+FGLCUatRunner::FGLCUatRunner(const FString& InUatPath, const FString& InArguments, const FString& InLogPath)
+	: UatPath(InUatPath)
+	, Arguments(InArguments)
+	, LogPath(InLogPath)
+	, Stage(EGLCUatStage::Starting)
+	, StageProgress(0.0f)
+	, LastReportedPercent(-1)
+{
+}
+
+FString FGLCUatRunner::GetDefaultLogPath()
+{
+	return FPaths::ProjectLogDir() / TEXT("GameLauncherCloud/UAT.log");
+}
+
+FString FGLCUatRunner::GetStageDisplayName(EGLCUatStage InStage)
+{
+	switch (InStage)
+	{
+	case EGLCUatStage::Starting: return TEXT("Starting");
+	case EGLCUatStage::Build:    return TEXT("Compiling");
+	case EGLCUatStage::Cook:     return TEXT("Cooking content");
+	case EGLCUatStage::Stage:    return TEXT("Staging");
+	case EGLCUatStage::Package:  return TEXT("Packaging");
+	case EGLCUatStage::Archive:  return TEXT("Archiving");
+	case EGLCUatStage::Finished: return TEXT("Finished");
+	default:                     return TEXT("Building");
+	}
+}
+
+int32 FGLCUatRunner::Run(FProgressCallback OnProgress, const TAtomic<bool>* bCancelRequested)
+{
+	ProgressCallback = OnProgress;
+	PendingLine.Reset();
+	ErrorLines.Reset();
+	Stage = EGLCUatStage::Starting;
+	StageProgress = 0.0f;
+	LastReportedPercent = -1;
+
+	// 16 MB per file, four older files: a runaway cook log cannot fill the disk
+	Log = MakeUnique<FGLCRotatingLog>(LogPath, 16 * 1024 * 1024, 4);
+	if (!Log->Open())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Cannot write UAT log to %s"), *LogPath);
+	}
+
+	void* ReadPipe = nullptr;
+	void* WritePipe = nullptr;
+	if (!FPlatformProcess::CreatePipe(ReadPipe, WritePipe))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to create a pipe for UAT output"));
+		return -1;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Running %s %s"), *UatPath, *Arguments);
+
+	// Standard output and error share the pipe so lines keep their order
+	FProcHandle Process = FPlatformProcess::CreateProc(*UatPath, *Arguments, false, true, true, nullptr, 0, nullptr, WritePipe, nullptr, WritePipe);
+	if (!Process.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to launch %s"), *UatPath);
+		FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+		return -1;
+	}
+
+	ReportProgress();
+
+	bool bCancelled = false;
+	TArray<uint8> Chunk;
+	while (FPlatformProcess::IsProcRunning(Process))
+	{
+		if (bCancelRequested && bCancelRequested->Load())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] Cancelling UAT"));
+			FPlatformProcess::TerminateProc(Process, true);
+			bCancelled = true;
+			break;
+		}
+
+		if (FPlatformProcess::ReadPipeToArray(ReadPipe, Chunk) && Chunk.Num() > 0)
+		{
+			ProcessOutput(Chunk);
+		}
+		else
+		{
+			FPlatformProcess::Sleep(0.05f);
+		}
+	}
+
+	// Whatever was written between the last read and the exit
+	while (FPlatformProcess::ReadPipeToArray(ReadPipe, Chunk) && Chunk.Num() > 0)
+	{
+		ProcessOutput(Chunk);
+	}
+	if (PendingLine.Num() > 0)
+	{
+		ProcessLine(PendingLine.GetData(), PendingLine.Num());
+		PendingLine.Reset();
+	}
+
+	int32 ReturnCode = -1;
+	if (!bCancelled)
+	{
+		FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+	}
+
+	FPlatformProcess::CloseProc(Process);
+	FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+	Log->Close();
+
+	if (ReturnCode == 0)
+	{
+		Stage = EGLCUatStage::Finished;
+		StageProgress = 0.0f;
+		ReportProgress();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] UAT exited with code %d, log: %s"), ReturnCode, *LogPath);
+	return ReturnCode;
+}
+
+void FGLCUatRunner::ProcessOutput(const TArray<uint8>& Chunk)
+{
+	int32 LineStart = 0;
+	for (int32 Index = 0; Index < Chunk.Num(); Index++)
+	{
+		if (Chunk[Index] != '\n')
+		{
+			continue;
+		}
+
+		if (PendingLine.Num() > 0)
+		{
+			PendingLine.Append(Chunk.GetData() + LineStart, Index - LineStart);
+			ProcessLine(PendingLine.GetData(), PendingLine.Num());
+			PendingLine.Reset();
+		}
+		else
+		{
+			ProcessLine(Chunk.GetData() + LineStart, Index - LineStart);
+		}
+		LineStart = Index + 1;
+	}
+
+	PendingLine.Append(Chunk.GetData() + LineStart, Chunk.Num() - LineStart);
+	if (PendingLine.Num() >= MaxLineLength)
+	{
+		ProcessLine(PendingLine.GetData(), PendingLine.Num());
+		PendingLine.Reset();
+	}
+}
+
+void FGLCUatRunner::ProcessLine(const uint8* Utf8Data, int32 Num)
+{
+	if (Num > 0 && Utf8Data[Num - 1] == '\r')
+	{
+		Num--;
+	}
+
+	if (Log.IsValid())
+	{
+		Log->WriteLine(Utf8Data, Num);
+	}
+
+	// Cheap byte checks first; only lines that matter are converted
+	const bool bIsBanner = GLCUat::ContainsAscii(Utf8Data, Num, "COMMAND STARTED");
+	const bool bIsCookProgress = Stage == EGLCUatStage::Cook && GLCUat::ContainsAscii(Utf8Data, Num, "Packages Remain");
+	const bool bIsError = GLCUat::ContainsAscii(Utf8Data, Num, "Error:") || GLCUat::ContainsAscii(Utf8Data, Num, "ERROR:");
+	if (!bIsBanner && !bIsCookProgress && !bIsError)
+	{
+		return;
+	}
+
+	FString Text(FUTF8ToTCHAR((const ANSICHAR*)Utf8Data, Num));
+
+	if (bIsError)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] UAT: %s"), *Text);
+		if (ErrorLines.Num() >= MaxErrorLines)
+		{
+			ErrorLines.RemoveAt(0);
+		}
+		ErrorLines.Add(Text);
+	}
+
+	if (bIsBanner)
+	{
+		for (const GLCUat::FStageBanner& Banner : GLCUat::StageBanners)
+		{
+			if (Text.Contains(Banner.Banner, ESearchCase::CaseSensitive) && Banner.Stage > Stage)
+			{
+				Stage = Banner.Stage;
+				StageProgress = 0.0f;
+				UE_LOG(LogTemp, Log, TEXT("[GLC] UAT stage: %s"), *GetStageDisplayName(Stage));
+				ReportProgress();
+				break;
+			}
+		}
+	}
+	else if (bIsCookProgress)
+	{
+		// "Cooked packages 1234 Packages Remain 567 Total 1801"
+		int32 Remaining = 0;
+		int32 Total = 0;
+		if (GLCUat::ParseCount(Text, TEXT("Packages Remain"), Remaining) && GLCUat::ParseCount(Text, TEXT("Total"), Total) && Total > 0)
+		{
+			StageProgress = FMath::Clamp(1.0f - (float)Remaining / (float)Total, StageProgress, 1.0f);
+			ReportProgress();
+		}
+	}
+}
+
+void FGLCUatRunner::ReportProgress()
+{
+	const float Start = GLCUat::GetStageStart(Stage);
+	const float Progress = Start + (GLCUat::GetStageEnd(Stage) - Start) * StageProgress;
+
+	// Stage changes are always reported, progress at most once per percent
+	const int32 Percent = FMath::FloorToInt(Progress * 100.0f) + (int32)Stage * 1000;
+	if (Percent == LastReportedPercent)
+	{
+		return;
+	}
+	LastReportedPercent = Percent;
+
+	if (ProgressCallback)
+	{
+		ProgressCallback(Stage, Progress);
+	}
+}
@@ -0,0 +1,364 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCUploadCommandlet.h"
+#include "GLCApiClient.h"
+#include "GLCBuildMatrix.h"
+#include "GLCBuildProfile.h"
+#include "GLCJobs.h"
+#include "GLCSettings.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HttpManager.h"
+#include "HttpModule.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+UGLCUploadCommandlet::UGLCUploadCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UGLCUploadCommandlet::Main(const FString& Params)
+{
+	if (FParse::Param(*Params, TEXT("Help")))
+	{
+		PrintUsage();
+		return (int32)EGLCUploadExitCode::Success;
+	}
+
+	// ========== Arguments ========== //
+
+	FGLCSettings Settings = FGLCSettings::Load();
+
+	int64 AppId = 0;
+	FParse::Value(*Params, TEXT("AppId="), AppId);
+	if (AppId <= 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] -AppId=<id> is required"));
+		PrintUsage();
+		return (int32)EGLCUploadExitCode::InvalidArguments;
+	}
+
+	FString Notes;
+	FParse::Value(*Params, TEXT("Notes="), Notes, false);
+
+	FString Platform = FGLCBuildJob::GetHostPlatform();
+	FParse::Value(*Params, TEXT("Platform="), Platform);
+	if (!FGLCBuildMatrix::GetSupportedPlatforms().Contains(Platform))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Unsupported platform '%s' (supported: %s)"), *Platform, *FString::Join(FGLCBuildMatrix::GetSupportedPlatforms(), TEXT(", ")));
+		return (int32)EGLCUploadExitCode::InvalidArguments;
+	}
+
+	FGLCBuildProfile Profile;
+	FParse::Value(*Params, TEXT("Configuration="), Profile.Configuration);
+	if (!FGLCBuildProfile::GetConfigurations().Contains(Profile.Configuration))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Unsupported configuration '%s' (supported: %s)"), *Profile.Configuration, *FString::Join(FGLCBuildProfile::GetConfigurations(), TEXT(", ")));
+		return (int32)EGLCUploadExitCode::InvalidArguments;
+	}
+	Profile.Mode = FParse::Param(*Params, TEXT("FastIteration")) ? EGLCBuildMode::FastIteration : EGLCBuildMode::Full;
+
+	// Without -BuildDir or -Zip the project is built first
+	FString BuildPath;
+	FString ZipPath;
+	FParse::Value(*Params, TEXT("BuildDir="), BuildPath);
+	FParse::Value(*Params, TEXT("Zip="), ZipPath);
+	const bool bBuild = BuildPath.IsEmpty() && ZipPath.IsEmpty();
+
+	if (!BuildPath.IsEmpty())
+	{
+		BuildPath = FPaths::ConvertRelativePathToFull(BuildPath);
+		if (!FPaths::DirectoryExists(BuildPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Build directory not found: %s"), *BuildPath);
+			return (int32)EGLCUploadExitCode::InvalidArguments;
+		}
+	}
+
+	const bool bUploadExistingZip = !ZipPath.IsEmpty() && BuildPath.IsEmpty();
+	if (bUploadExistingZip)
+	{
+		ZipPath = FPaths::ConvertRelativePathToFull(ZipPath);
+		if (!FPaths::FileExists(ZipPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Archive not found: %s"), *ZipPath);
+			return (int32)EGLCUploadExitCode::InvalidArguments;
+		}
+	}
+	else if (ZipPath.IsEmpty())
+	{
+		ZipPath = FGLCCompressJob::GetDefaultZipPath();
+	}
+
+	// Same choice as the manager window unless a method is given
+	EGLCUploadMethod Method = EGLCUploadMethod::Archive;
+	FString MethodName;
+	if (FParse::Value(*Params, TEXT("Method="), MethodName))
+	{
+		if (MethodName == TEXT("streamed"))
+		{
+			Method = EGLCUploadMethod::Streamed;
+		}
+		else if (MethodName == TEXT("chunked"))
+		{
+			Method = EGLCUploadMethod::Chunked;
+		}
+		else if (MethodName != TEXT("archive"))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Unknown upload method '%s' (archive, streamed or chunked)"), *MethodName);
+			return (int32)EGLCUploadExitCode::InvalidArguments;
+		}
+	}
+	else if (Settings.bChunkedUpload)
+	{
+		Method = EGLCUploadMethod::Chunked;
+	}
+	else if (Settings.bStreamCompressedUpload && Settings.bUseMultipartUpload)
+	{
+		Method = EGLCUploadMethod::Streamed;
+	}
+
+	if (bUploadExistingZip && Method != EGLCUploadMethod::Archive)
+	{
+		// Only the archive is available, there is no build directory to stream or chunk
+		Method = EGLCUploadMethod::Archive;
+	}
+
+	// ========== Authentication ========== //
+
+	// Secrets are best passed through the environment: the command line ends up in the log
+	FString ApiUrl = Settings.ApiUrl;
+	FParse::Value(*Params, TEXT("ApiUrl="), ApiUrl);
+
+	FString AuthToken = FPlatformMisc::GetEnvironmentVariable(TEXT("GLC_AUTH_TOKEN"));
+	FParse::Value(*Params, TEXT("Token="), AuthToken);
+
+	FString ApiKey = FPlatformMisc::GetEnvironmentVariable(TEXT("GLC_API_KEY"));
+	FParse::Value(*Params, TEXT("ApiKey="), ApiKey);
+
+	if (AuthToken.IsEmpty() && ApiKey.IsEmpty())
+	{
+		AuthToken = Settings.AuthToken;
+	}
+
+	TSharedPtr<FGLCApiClient> ApiClient = MakeShareable(new FGLCApiClient(ApiUrl, AuthToken));
+	ApiClient->SetSendPartChecksums(Settings.bSendPartChecksumHeader);
+	ApiClient->SetRetryPolicy(Settings.GetRetryPolicy());
+
+	if (!ApiKey.IsEmpty() && !Login(ApiClient, ApiKey))
+	{
+		return (int32)EGLCUploadExitCode::AuthenticationFailed;
+	}
+	if (AuthToken.IsEmpty() && ApiKey.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Not logged in: set GLC_API_KEY, pass -ApiKey= or -Token=, or log in from the manager window"));
+		return (int32)EGLCUploadExitCode::AuthenticationFailed;
+	}
+
+	// ========== Jobs ========== //
+
+	FGLCJobScheduler Scheduler;
+	Scheduler.Initialize(false, ApiClient);
+	Scheduler.OnJobChanged().AddUObject(this, &UGLCUploadCommandlet::OnJobChanged);
+
+	TArray<int64> UploadDependencies;
+	if (bBuild)
+	{
+		UploadDependencies.Add(Scheduler.Submit(MakeShared<FGLCBuildJob, ESPMode::ThreadSafe>(Profile, Platform)));
+	}
+	if (Method == EGLCUploadMethod::Archive && !bUploadExistingZip)
+	{
+		// The build path comes from the build job's output when there is one
+		UploadDependencies = { Scheduler.Submit(MakeShared<FGLCCompressJob, ESPMode::ThreadSafe>(BuildPath, ZipPath), UploadDependencies) };
+	}
+
+	int64 UploadJobId = Scheduler.Submit(MakeShared<FGLCUploadJob, ESPMode::ThreadSafe>(AppId, Notes, Method, BuildPath, ZipPath, 0), UploadDependencies);
+
+	if (FParse::Param(*Params, TEXT("Wait")))
+	{
+		Scheduler.Submit(MakeShared<FGLCMonitorJob, ESPMode::ThreadSafe>(0), { UploadJobId }, EGLCJobPriority::High);
+	}
+
+	PumpUntil([&Scheduler]()
+	{
+		return !Scheduler.GetJobs().ContainsByPredicate([](const FGLCJobPtr& Job) { return !Job->IsDone(); });
+	}, &Scheduler);
+
+	// ========== Result ========== //
+
+	// The first failed job decides the exit code; the jobs after it were cancelled with it
+	EGLCUploadExitCode ExitCode = EGLCUploadExitCode::Success;
+	FString ResultMessage = TEXT("Upload completed");
+	for (const FGLCJobPtr& Job : Scheduler.GetJobs())
+	{
+		if (Job->GetState() == EGLCJobState::Failed)
+		{
+			switch (Job->GetType())
+			{
+			case EGLCJobType::Build: ExitCode = EGLCUploadExitCode::BuildFailed; break;
+			case EGLCJobType::Compress: ExitCode = EGLCUploadExitCode::CompressionFailed; break;
+			case EGLCJobType::Upload: ExitCode = EGLCUploadExitCode::UploadFailed; break;
+			default: ExitCode = EGLCUploadExitCode::ProcessingFailed; break;
+			}
+			ResultMessage = Job->GetMessage();
+			break;
+		}
+		if (Job->GetState() == EGLCJobState::Cancelled && ExitCode == EGLCUploadExitCode::Success)
+		{
+			ExitCode = EGLCUploadExitCode::Cancelled;
+			ResultMessage = Job->GetMessage();
+		}
+	}
+
+	double AppBuildId = 0;
+	if (FGLCJobPtr UploadJob = Scheduler.FindJob(UploadJobId))
+	{
+		UploadJob->GetOutput()->TryGetNumberField(TEXT("appBuildId"), AppBuildId);
+	}
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("exitCode"), (int32)ExitCode);
+	Result->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	Result->SetStringField(TEXT("message"), ResultMessage);
+	PrintEvent(TEXT("result"), Result);
+
+	Scheduler.OnJobChanged().RemoveAll(this);
+	Scheduler.Shutdown();
+
+	return (int32)ExitCode;
+}
+
+bool UGLCUploadCommandlet::Login(const TSharedPtr<FGLCApiClient>& ApiClient, const FString& ApiKey)
+{
+	bool bDone = false;
+	bool bLoggedIn = false;
+
+	ApiClient->LoginWithApiKeyAsync(ApiKey, [&bDone, &bLoggedIn, ApiClient](bool bSuccess, FString Message, FGLCLoginResponse Response)
+	{
+		bDone = true;
+		bLoggedIn = bSuccess;
+
+		if (bSuccess)
+		{
+			ApiClient->SetAuthToken(Response.Token);
+			UE_LOG(LogTemp, Display, TEXT("[GLC] Logged in as %s (%s plan)"), *Response.Email, Response.PlanName.IsEmpty() ? TEXT("Free") : *Response.PlanName);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GLC] Login failed: %s"), *Message);
+		}
+	});
+
+	PumpUntil([&bDone]() { return bDone; });
+	return bLoggedIn;
+}
+
+void UGLCUploadCommandlet::PumpUntil(TFunctionRef<bool()> Done, FGLCJobScheduler* Scheduler)
+{
+	double LastTime = FPlatformTime::Seconds();
+	bool bCancelling = false;
+
+	while (!Done())
+	{
+		// Ctrl+C cancels the jobs; pumping goes on until they finished cancelling
+		if (Scheduler && !bCancelling && IsEngineExitRequested())
+		{
+			bCancelling = true;
+			UE_LOG(LogTemp, Warning, TEXT("[GLC] Exit requested, cancelling jobs"));
+
+			TArray<FGLCJobPtr> Jobs = Scheduler->GetJobs();
+			for (const FGLCJobPtr& Job : Jobs)
+			{
+				if (!Job->IsDone())
+				{
+					Scheduler->Cancel(Job->GetId());
+				}
+			}
+		}
+
+		double Now = FPlatformTime::Seconds();
+		float DeltaTime = (float)(Now - LastTime);
+		LastTime = Now;
+
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+		FHttpModule::Get().GetHttpManager().Tick(DeltaTime);
+
+		FPlatformProcess::Sleep(0.01f);
+	}
+}
+
+void UGLCUploadCommandlet::OnJobChanged(const FGLCJobPtr& Job)
+{
+	if (!Job.IsValid())
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+	Fields->SetNumberField(TEXT("job"), (double)Job->GetId());
+	Fields->SetStringField(TEXT("type"), FGLCJob::GetTypeName(Job->GetType()));
+
+	const EGLCJobState* PrintedState = PrintedStates.Find(Job->GetId());
+	if (!PrintedState || *PrintedState != Job->GetState())
+	{
+		PrintedStates.Add(Job->GetId(), Job->GetState());
+		Fields->SetStringField(TEXT("name"), Job->GetDisplayName());
+		Fields->SetStringField(TEXT("state"), FGLCJob::GetStateName(Job->GetState()));
+		Fields->SetStringField(TEXT("message"), Job->GetMessage());
+		PrintEvent(TEXT("job"), Fields);
+		return;
+	}
+
+	// Whole percents only, progress is reported far more often than a log can take
+	int32 Percent = FMath::FloorToInt(Job->GetProgress() * 100.0f);
+	const int32* PrintedPercent = PrintedProgress.Find(Job->GetId());
+	if (PrintedPercent && *PrintedPercent == Percent)
+	{
+		return;
+	}
+	PrintedProgress.Add(Job->GetId(), Percent);
+
+	Fields->SetNumberField(TEXT("progress"), Percent / 100.0);
+	Fields->SetStringField(TEXT("message"), Job->GetMessage());
+	PrintEvent(TEXT("progress"), Fields);
+}
+
+void UGLCUploadCommandlet::PrintEvent(const FString& Event, const TSharedRef<FJsonObject>& Fields)
+{
+	TSharedRef<FJsonObject> Line = MakeShared<FJsonObject>();
+	Line->SetStringField(TEXT("event"), Event);
+	Line->Values.Append(Fields->Values);
+
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+	FJsonSerializer::Serialize(Line, Writer);
+
+	UE_LOG(LogTemp, Display, TEXT("GLC_EVENT %s"), *Json);
+}
+
+void UGLCUploadCommandlet::PrintUsage()
+{
+	UE_LOG(LogTemp, Display, TEXT("Usage: UnrealEditor-Cmd <Project>.uproject -run=GLCUpload -AppId=<id> [options]"));
+	UE_LOG(LogTemp, Display, TEXT("  -Notes=\"...\"            Build notes"));
+	UE_LOG(LogTemp, Display, TEXT("  -Platform=<platform>    BuildCookRun platform (default: the editor's)"));
+	UE_LOG(LogTemp, Display, TEXT("  -Configuration=<config> Development, Shipping or DebugGame (default: Development)"));
+	UE_LOG(LogTemp, Display, TEXT("  -FastIteration          Cook incrementally and skip the build when nothing changed"));
+	UE_LOG(LogTemp, Display, TEXT("  -BuildDir=<path>        Upload a packaged build instead of building"));
+	UE_LOG(LogTemp, Display, TEXT("  -Zip=<path>             Upload an existing archive, or where to write it with -BuildDir"));
+	UE_LOG(LogTemp, Display, TEXT("  -Method=<method>        archive, streamed or chunked (default: from glc_config.json)"));
+	UE_LOG(LogTemp, Display, TEXT("  -ApiUrl=<url>           API server (default: from glc_config.json)"));
+	UE_LOG(LogTemp, Display, TEXT("  -ApiKey=<key>           API key to log in with (default: GLC_API_KEY)"));
+	UE_LOG(LogTemp, Display, TEXT("  -Token=<token>          Auth token (default: GLC_AUTH_TOKEN, then glc_config.json)"));
+	UE_LOG(LogTemp, Display, TEXT("  -Wait                   Wait until the server finished processing the build"));
+	UE_LOG(LogTemp, Display, TEXT("Exit codes: 0 success, 1 invalid arguments, 2 authentication failed, 3 build failed,"));
+	UE_LOG(LogTemp, Display, TEXT("            4 compression failed, 5 upload failed, 6 processing failed, 7 cancelled"));
+}
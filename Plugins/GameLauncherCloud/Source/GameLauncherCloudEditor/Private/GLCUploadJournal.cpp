@@ -0,0 +1,189 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCUploadJournal.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FString FGLCUploadJournal::GetJournalPath(int64 InAppId, const FString& InFilePath)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(InFilePath);
+#if PLATFORM_WINDOWS || PLATFORM_MAC
+	// Case-insensitive file systems, as in FPaths::IsSamePath
+	Key.ToLowerInline();
+#endif
+	const uint64 Hash = FXxHash64::HashBuffer(*Key, Key.Len() * sizeof(TCHAR)).Hash;
+	return FPaths::ProjectIntermediateDir() / FString::Printf(TEXT("GameLauncherCloud/upload_journal_%lld_%016llx.json"), InAppId, Hash);
+}
+
+FString FGLCUploadJournal::GetFileTimestamp(const FString& InFilePath)
+{
+	return IFileManager::Get().GetTimeStamp(*InFilePath).ToIso8601();
+}
+
+bool FGLCUploadJournal::Load(int64 InAppId, const FString& InFilePath, FGLCUploadJournal& OutJournal)
+{
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetJournalPath(InAppId, InFilePath)))
+	{
+		return false;
+	}
+	
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Upload journal is corrupted, ignoring it"));
+		return false;
+	}
+	
+	FGLCUploadJournal Journal;
+	JsonObject->TryGetNumberField(TEXT("appId"), Journal.AppId);
+	JsonObject->TryGetNumberField(TEXT("appBuildId"), Journal.AppBuildId);
+	JsonObject->TryGetStringField(TEXT("key"), Journal.Key);
+	JsonObject->TryGetStringField(TEXT("uploadId"), Journal.UploadId);
+	JsonObject->TryGetStringField(TEXT("filePath"), Journal.FilePath);
+	JsonObject->TryGetNumberField(TEXT("fileSize"), Journal.FileSize);
+	JsonObject->TryGetStringField(TEXT("fileTimestamp"), Journal.FileTimestamp);
+	JsonObject->TryGetNumberField(TEXT("partSize"), Journal.PartSize);
+	JsonObject->TryGetNumberField(TEXT("partCount"), Journal.PartCount);
+	JsonObject->TryGetBoolField(TEXT("uploadCompleted"), Journal.bUploadCompleted);
+	
+	const TArray<TSharedPtr<FJsonValue>>* PartsArray = nullptr;
+	if (JsonObject->TryGetArrayField(TEXT("completedParts"), PartsArray) && PartsArray)
+	{
+		for (const TSharedPtr<FJsonValue>& PartValue : *PartsArray)
+		{
+			TSharedPtr<FJsonObject> PartObject = PartValue->AsObject();
+			if (PartObject.IsValid())
+			{
+				FGLCCompletedPart Part;
+				Part.PartNumber = 0;
+				PartObject->TryGetNumberField(TEXT("partNumber"), Part.PartNumber);
+				PartObject->TryGetStringField(TEXT("eTag"), Part.ETag);
+				PartObject->TryGetStringField(TEXT("checksumSha256"), Part.ChecksumSha256);
+				Journal.CompletedParts.Add(Part);
+			}
+		}
+	}
+	
+	if (Journal.AppBuildId <= 0 || Journal.UploadId.IsEmpty() || Journal.PartSize <= 0 || Journal.PartCount <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GLC] Upload journal is incomplete, ignoring it"));
+		return false;
+	}
+	
+	OutJournal = MoveTemp(Journal);
+	return true;
+}
+
+void FGLCUploadJournal::Delete(int64 InAppId, const FString& InFilePath)
+{
+	IFileManager::Get().Delete(*GetJournalPath(InAppId, InFilePath), false, true, true);
+}
+
+void FGLCUploadJournal::DeleteForBuild(int64 InAppBuildId)
+{
+	const FString Directory = FPaths::ProjectIntermediateDir() / TEXT("GameLauncherCloud");
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / TEXT("upload_journal_*.json")), true, false);
+
+	for (const FString& FileName : FileNames)
+	{
+		FString FileContent;
+		TSharedPtr<FJsonObject> JsonObject;
+		if (!FFileHelper::LoadFileToString(FileContent, *(Directory / FileName)))
+		{
+			continue;
+		}
+
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+		int64 JournalAppBuildId = 0;
+		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid()
+			&& JsonObject->TryGetNumberField(TEXT("appBuildId"), JournalAppBuildId) && JournalAppBuildId == InAppBuildId)
+		{
+			IFileManager::Get().Delete(*(Directory / FileName), false, true, true);
+		}
+	}
+}
+
+bool FGLCUploadJournal::Save() const
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetNumberField(TEXT("appId"), AppId);
+	JsonObject->SetNumberField(TEXT("appBuildId"), AppBuildId);
+	JsonObject->SetStringField(TEXT("key"), Key);
+	JsonObject->SetStringField(TEXT("uploadId"), UploadId);
+	JsonObject->SetStringField(TEXT("filePath"), FilePath);
+	JsonObject->SetNumberField(TEXT("fileSize"), FileSize);
+	JsonObject->SetStringField(TEXT("fileTimestamp"), FileTimestamp);
+	JsonObject->SetNumberField(TEXT("partSize"), PartSize);
+	JsonObject->SetNumberField(TEXT("partCount"), PartCount);
+	JsonObject->SetBoolField(TEXT("uploadCompleted"), bUploadCompleted);
+	
+	TArray<TSharedPtr<FJsonValue>> PartsArray;
+	for (const FGLCCompletedPart& Part : CompletedParts)
+	{
+		TSharedPtr<FJsonObject> PartObject = MakeShareable(new FJsonObject);
+		PartObject->SetNumberField(TEXT("partNumber"), Part.PartNumber);
+		PartObject->SetStringField(TEXT("eTag"), Part.ETag);
+		if (!Part.ChecksumSha256.IsEmpty())
+		{
+			PartObject->SetStringField(TEXT("checksumSha256"), Part.ChecksumSha256);
+		}
+		PartsArray.Add(MakeShareable(new FJsonValueObject(PartObject)));
+	}
+	JsonObject->SetArrayField(TEXT("completedParts"), PartsArray);
+	
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	
+	// Write to a temp file first so a crash mid-write never leaves a truncated journal
+	FString JournalPath = GetJournalPath(AppId, FilePath);
+	FString TempPath = JournalPath + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(OutputString, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to write upload journal: %s"), *TempPath);
+		return false;
+	}
+	
+	return IFileManager::Get().Move(*JournalPath, *TempPath, true, true);
+}
+
+bool FGLCUploadJournal::Matches(int64 InAppId, const FString& InFilePath) const
+{
+	return AppId == InAppId
+		&& FPaths::IsSamePath(FilePath, InFilePath)
+		&& FileSize == IFileManager::Get().FileSize(*InFilePath)
+		&& FileTimestamp == GetFileTimestamp(InFilePath);
+}
+
+void FGLCUploadJournal::AddCompletedPart(const FGLCCompletedPart& Part)
+{
+	CompletedParts.RemoveAll([&Part](const FGLCCompletedPart& Existing) { return Existing.PartNumber == Part.PartNumber; });
+	CompletedParts.Add(Part);
+	Save();
+}
+
+TArray<int32> FGLCUploadJournal::GetMissingPartNumbers() const
+{
+	TSet<int32> Completed;
+	for (const FGLCCompletedPart& Part : CompletedParts)
+	{
+		Completed.Add(Part.PartNumber);
+	}
+	
+	TArray<int32> Missing;
+	for (int32 PartNumber = 1; PartNumber <= PartCount; PartNumber++)
+	{
+		if (!Completed.Contains(PartNumber))
+		{
+			Missing.Add(PartNumber);
+		}
+	}
+	return Missing;
+}
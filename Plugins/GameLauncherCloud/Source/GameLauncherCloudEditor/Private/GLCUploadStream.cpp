@@ -0,0 +1,195 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCUploadStream.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+TSharedPtr<FGLCFileRangeReader, ESPMode::ThreadSafe> FGLCFileRangeReader::Open(const FString& FilePath, int64 Offset, int64 Length, int32 BufferSize)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* Handle = PlatformFile.OpenRead(*FilePath);
+	if (!Handle)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to open file for streaming: %s"), *FilePath);
+		return nullptr;
+	}
+
+	int64 FileSize = Handle->Size();
+	if (Length < 0)
+	{
+		Length = FileSize - Offset;
+	}
+
+	if (Offset < 0 || Length < 0 || Offset + Length > FileSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Invalid stream range [%lld, +%lld) for file of %lld bytes: %s"), Offset, Length, FileSize, *FilePath);
+		delete Handle;
+		return nullptr;
+	}
+
+	return MakeShareable(new FGLCFileRangeReader(Handle, FilePath, Offset, Length, FMath::Max(BufferSize, 64 * 1024)));
+}
+
+FGLCFileRangeReader::FGLCFileRangeReader(IFileHandle* InHandle, const FString& InFilePath, int64 InRangeStart, int64 InRangeLength, int32 InBufferSize)
+	: Handle(InHandle)
+	, FilePath(InFilePath)
+	, RangeStart(InRangeStart)
+	, RangeLength(InRangeLength)
+	, Position(0)
+	, BufferStart(0)
+	, BufferCount(0)
+{
+	SetIsLoading(true);
+	SetIsPersistent(true);
+
+	// Never allocate more than the range itself needs
+	Buffer.SetNumUninitialized((int32)FMath::Min<int64>(InBufferSize, FMath::Max<int64>(RangeLength, 1)));
+}
+
+FGLCFileRangeReader::~FGLCFileRangeReader()
+{
+	Close();
+}
+
+bool FGLCFileRangeReader::FillBuffer()
+{
+	int64 BytesToRead = FMath::Min<int64>(Buffer.Num(), RangeLength - Position);
+	if (BytesToRead <= 0 || !Handle.IsValid())
+	{
+		return false;
+	}
+
+	if (!Handle->Seek(RangeStart + Position) || !Handle->Read(Buffer.GetData(), BytesToRead))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Read failed at offset %lld in %s"), RangeStart + Position, *FilePath);
+		return false;
+	}
+
+	BufferStart = Position;
+	BufferCount = BytesToRead;
+	return true;
+}
+
+void FGLCFileRangeReader::Serialize(void* Data, int64 Num)
+{
+	if (Num <= 0 || IsError())
+	{
+		return;
+	}
+
+	if (Position + Num > RangeLength)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Attempted to read past the end of the stream (%lld + %lld > %lld)"), Position, Num, RangeLength);
+		SetError();
+		return;
+	}
+
+	uint8* Dest = static_cast<uint8*>(Data);
+	while (Num > 0)
+	{
+		// Serve from the buffer when the current position is inside it
+		if (Position >= BufferStart && Position < BufferStart + BufferCount)
+		{
+			int64 Available = BufferStart + BufferCount - Position;
+			int64 ToCopy = FMath::Min(Available, Num);
+			FMemory::Memcpy(Dest, Buffer.GetData() + (Position - BufferStart), ToCopy);
+			Dest += ToCopy;
+			Position += ToCopy;
+			Num -= ToCopy;
+			continue;
+		}
+
+		// Large reads bypass the buffer entirely
+		if (Num >= Buffer.Num())
+		{
+			if (!Handle->Seek(RangeStart + Position) || !Handle->Read(Dest, Num))
+			{
+				UE_LOG(LogTemp, Error, TEXT("[GLC] Read failed at offset %lld in %s"), RangeStart + Position, *FilePath);
+				SetError();
+				return;
+			}
+			Position += Num;
+			return;
+		}
+
+		if (!FillBuffer())
+		{
+			SetError();
+			return;
+		}
+	}
+}
+
+void FGLCFileRangeReader::Seek(int64 InPos)
+{
+	Position = FMath::Clamp<int64>(InPos, 0, RangeLength);
+}
+
+int64 FGLCFileRangeReader::Tell()
+{
+	return Position;
+}
+
+int64 FGLCFileRangeReader::TotalSize()
+{
+	return RangeLength;
+}
+
+bool FGLCFileRangeReader::Close()
+{
+	Handle.Reset();
+	return !IsError();
+}
+
+FString FGLCFileRangeReader::GetArchiveName() const
+{
+	return FilePath;
+}
+
+// ========== FGLCSharedBufferReader ========== //
+
+FGLCSharedBufferReader::FGLCSharedBufferReader(TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> InData)
+	: Buffer(InData)
+	, Position(0)
+{
+	SetIsLoading(true);
+	SetIsPersistent(false);
+}
+
+void FGLCSharedBufferReader::Serialize(void* Data, int64 Num)
+{
+	if (Num <= 0 || IsError())
+	{
+		return;
+	}
+
+	if (Position + Num > Buffer->Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Attempted to read past the end of the buffer (%lld + %lld > %d)"), Position, Num, Buffer->Num());
+		SetError();
+		return;
+	}
+
+	FMemory::Memcpy(Data, Buffer->GetData() + Position, Num);
+	Position += Num;
+}
+
+void FGLCSharedBufferReader::Seek(int64 InPos)
+{
+	Position = FMath::Clamp<int64>(InPos, 0, Buffer->Num());
+}
+
+int64 FGLCSharedBufferReader::Tell()
+{
+	return Position;
+}
+
+int64 FGLCSharedBufferReader::TotalSize()
+{
+	return Buffer->Num();
+}
+
+FString FGLCSharedBufferReader::GetArchiveName() const
+{
+	return TEXT("FGLCSharedBufferReader");
+}
@@ -0,0 +1,559 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#include "GLCZipWriter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace GLCZip
+{
+	// Record signatures
+	static constexpr uint32 LocalFileHeaderSignature = 0x04034b50;
+	static constexpr uint32 DataDescriptorSignature = 0x08074b50;
+	static constexpr uint32 CentralFileHeaderSignature = 0x02014b50;
+	static constexpr uint32 Zip64EndOfCentralDirectorySignature = 0x06064b50;
+	static constexpr uint32 Zip64EndOfCentralDirectoryLocatorSignature = 0x07064b50;
+	static constexpr uint32 EndOfCentralDirectorySignature = 0x06054b50;
+
+	static constexpr uint16 Zip64ExtraFieldTag = 0x0001;
+	static constexpr uint16 VersionNeededDeflate = 20;
+	static constexpr uint16 VersionNeededZip64 = 45;
+
+	// General purpose flags: sizes and CRC follow the data, names are UTF-8.
+	// Bits 1-2 record the deflate option used (maximum or fast).
+	static constexpr uint16 FlagDeflateMaximum = 0x0002;
+	static constexpr uint16 FlagDeflateFast = 0x0004;
+	static constexpr uint16 FlagDataDescriptor = 0x0008;
+	static constexpr uint16 FlagUtf8 = 0x0800;
+
+	static constexpr uint16 MethodStore = 0;
+	static constexpr uint16 MethodDeflate = 8;
+
+	// Fixed DOS timestamp (1980-01-01 00:00:00) so archives do not depend on file times
+	static constexpr uint16 DosTime = 0x0000;
+	static constexpr uint16 DosDate = 0x0021;
+
+	// Entries at or above this size carry ZIP64 sizes in their local header and data
+	// descriptor. The margin covers the worst-case deflate expansion of incompressible data.
+	static constexpr int64 Zip64LocalThreshold = 0xFF000000LL;
+
+	static void Put16(TArray<uint8>& Out, uint16 Value)
+	{
+		Out.Add((uint8)(Value & 0xFF));
+		Out.Add((uint8)((Value >> 8) & 0xFF));
+	}
+
+	static void Put32(TArray<uint8>& Out, uint32 Value)
+	{
+		Put16(Out, (uint16)(Value & 0xFFFF));
+		Put16(Out, (uint16)((Value >> 16) & 0xFFFF));
+	}
+
+	static void Put64(TArray<uint8>& Out, uint64 Value)
+	{
+		Put32(Out, (uint32)(Value & 0xFFFFFFFF));
+		Put32(Out, (uint32)((Value >> 32) & 0xFFFFFFFF));
+	}
+
+	static uint32 Clamp32(int64 Value)
+	{
+		return Value >= 0xFFFFFFFFLL ? 0xFFFFFFFFu : (uint32)Value;
+	}
+}
+
+// ========== FILE SINK ========== //
+
+FGLCZipFileSink::FGLCZipFileSink(const FString& InFilePath)
+	: FilePath(InFilePath)
+{
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GLC] Failed to create archive: %s"), *FilePath);
+	}
+}
+
+FGLCZipFileSink::~FGLCZipFileSink()
+{
+	Close();
+}
+
+bool FGLCZipFileSink::Write(const uint8* Data, int64 Num)
+{
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	Writer->Serialize(const_cast<uint8*>(Data), Num);
+	return !Writer->IsError();
+}
+
+bool FGLCZipFileSink::Close()
+{
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	bool bSuccess = Writer->Close();
+	Writer.Reset();
+	return bSuccess;
+}
+
+// ========== ZIP WRITER ========== //
+
+FGLCZipWriter::FGLCZipWriter(const FGLCCompressionPolicy& InPolicy)
+	: Policy(InPolicy)
+	, Sink(nullptr)
+	, BytesWritten(0)
+	, UncompressedSize(0)
+{
+}
+
+bool FGLCZipWriter::Fail(const FString& Error)
+{
+	LastError = Error;
+	UE_LOG(LogTemp, Error, TEXT("[GLC] %s"), *Error);
+	return false;
+}
+
+bool FGLCZipWriter::Emit(const uint8* Data, int64 Num)
+{
+	if (Num <= 0)
+	{
+		return true;
+	}
+
+	if (!Sink->Write(Data, Num))
+	{
+		return Fail(TEXT("Failed to write archive data"));
+	}
+
+	BytesWritten += Num;
+	return true;
+}
+
+bool FGLCZipWriter::Emit(const TArray<uint8>& Bytes)
+{
+	return Emit(Bytes.GetData(), Bytes.Num());
+}
+
+bool FGLCZipWriter::WriteDirectoryToFile(const FString& SourceDirectory, const FString& ZipPath, FProgressCallback ProgressCallback, const TAtomic<bool>* bCancelRequested)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*FPaths::GetPath(ZipPath), true);
+
+	// Never leave a half-written archive where a finished one is expected
+	FString TempPath = ZipPath + TEXT(".tmp");
+	bool bSuccess = false;
+	{
+		FGLCZipFileSink FileSink(TempPath);
+		if (!FileSink.IsValid())
+		{
+			return Fail(FString::Printf(TEXT("Failed to create archive: %s"), *TempPath));
+		}
+
+		bSuccess = WriteDirectory(SourceDirectory, FileSink, ProgressCallback, bCancelRequested);
+		bSuccess = FileSink.Close() && bSuccess;
+	}
+
+	if (!bSuccess)
+	{
+		FileManager.Delete(*TempPath, false, true, true);
+		return false;
+	}
+
+	if (!FileManager.Move(*ZipPath, *TempPath, true, true))
+	{
+		FileManager.Delete(*TempPath, false, true, true);
+		return Fail(FString::Printf(TEXT("Failed to move archive into place: %s"), *ZipPath));
+	}
+
+	return true;
+}
+
+bool FGLCZipWriter::WriteDirectory(const FString& SourceDirectory, FGLCZipSink& InSink, FProgressCallback ProgressCallback, const TAtomic<bool>* bCancelRequested)
+{
+	Sink = &InSink;
+	BytesWritten = 0;
+	UncompressedSize = 0;
+	Entries.Reset();
+	LastError.Empty();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	FString Root = FPaths::ConvertRelativePathToFull(SourceDirectory);
+	FPaths::NormalizeDirectoryName(Root);
+	if (!PlatformFile.DirectoryExists(*Root))
+	{
+		return Fail(FString::Printf(TEXT("Source directory does not exist: %s"), *Root));
+	}
+
+	// Sorted relative paths keep the entry order independent of the file system
+	TArray<FString> Files;
+	PlatformFile.FindFilesRecursively(Files, *Root, nullptr);
+
+	TArray<TPair<FString, FString>> SortedFiles;
+	SortedFiles.Reserve(Files.Num());
+	for (const FString& File : Files)
+	{
+		FString RelativePath = File.RightChop(Root.Len());
+		RelativePath.ReplaceInline(TEXT("\\"), TEXT("/"));
+		while (RelativePath.StartsWith(TEXT("/")))
+		{
+			RelativePath.RightChopInline(1);
+		}
+		SortedFiles.Emplace(RelativePath, File);
+	}
+	SortedFiles.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+	{
+		return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+	});
+
+	int64 TotalBytes = 0;
+	Entries.Reserve(SortedFiles.Num());
+	for (const TPair<FString, FString>& File : SortedFiles)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.AbsolutePath = File.Value;
+		FTCHARToUTF8 Utf8Name(*File.Key);
+		Entry.Name.Append(reinterpret_cast<const uint8*>(Utf8Name.Get()), Utf8Name.Length());
+		Entry.UncompressedSize = FMath::Max<int64>(PlatformFile.FileSize(*File.Value), 0);
+		Entry.bZip64Local = Entry.UncompressedSize >= GLCZip::Zip64LocalThreshold;
+		TotalBytes += Entry.UncompressedSize;
+	}
+	UncompressedSize = TotalBytes;
+
+	// Choose the method of every file; sampling reads a little of each file so run it in parallel
+	TArray<EGLCCompressionMethod> Methods;
+	Methods.SetNum(Entries.Num());
+	ParallelFor(Entries.Num(), [this, &Methods](int32 Index)
+	{
+		Methods[Index] = Policy.ChooseMethod(Entries[Index].AbsolutePath, Entries[Index].UncompressedSize);
+	});
+
+	int64 MethodBytes[3] = {};
+	for (int32 Index = 0; Index < Entries.Num(); Index++)
+	{
+		FEntry& Entry = Entries[Index];
+		EGLCCompressionMethod Method = Methods[Index];
+
+		Entry.Level = Policy.GetLevel(Method);
+		Entry.Method = Entry.Level > 0 ? GLCZip::MethodDeflate : GLCZip::MethodStore;
+		Entry.Flags = GLCZip::FlagDataDescriptor | GLCZip::FlagUtf8;
+		if (Method == EGLCCompressionMethod::HighDeflate)
+		{
+			Entry.Flags |= GLCZip::FlagDeflateMaximum;
+		}
+		else if (Method == EGLCCompressionMethod::FastDeflate)
+		{
+			Entry.Flags |= GLCZip::FlagDeflateFast;
+		}
+
+		MethodBytes[(int32)Method] += Entry.UncompressedSize;
+		UE_LOG(LogTemp, Verbose, TEXT("[GLC] %s: %s"), *SortedFiles[Index].Key, FGLCCompressionPolicy::LexToString(Method));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Compression policy: store %.2f MB, fast deflate %.2f MB, high deflate %.2f MB"),
+		MethodBytes[(int32)EGLCCompressionMethod::Store] / (1024.0 * 1024.0),
+		MethodBytes[(int32)EGLCCompressionMethod::FastDeflate] / (1024.0 * 1024.0),
+		MethodBytes[(int32)EGLCCompressionMethod::HighDeflate] / (1024.0 * 1024.0));
+
+	// Split every file into chunks; empty files still get one (empty) chunk
+	TArray<FChunk> Chunks;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+	{
+		int64 Size = Entries[EntryIndex].UncompressedSize;
+		int64 Offset = 0;
+		do
+		{
+			FChunk& Chunk = Chunks.AddDefaulted_GetRef();
+			Chunk.EntryIndex = EntryIndex;
+			Chunk.Offset = Offset;
+			Chunk.Length = FMath::Min(ChunkSize, Size - Offset);
+			Chunk.bFirst = Offset == 0;
+			Offset += Chunk.Length;
+			Chunk.bLast = Offset >= Size;
+		}
+		while (Offset < Size);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] Writing ZIP: %d files, %.2f MB in %d chunks"), Entries.Num(), TotalBytes / (1024.0 * 1024.0), Chunks.Num());
+
+	// Bound memory by only keeping a window of chunks in flight
+	const int32 WindowSize = FMath::Max(8, FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 2);
+	int64 BytesProcessed = 0;
+
+	for (int32 WindowStart = 0; WindowStart < Chunks.Num(); WindowStart += WindowSize)
+	{
+		if (bCancelRequested && bCancelRequested->Load())
+		{
+			return Fail(TEXT("Compression cancelled"));
+		}
+
+		int32 WindowCount = FMath::Min(WindowSize, Chunks.Num() - WindowStart);
+
+		ParallelFor(WindowCount, [this, &Chunks, WindowStart](int32 Index)
+		{
+			FChunk& Chunk = Chunks[WindowStart + Index];
+			Chunk.bFailed = !ProcessChunk(Chunk);
+		});
+
+		// Append the window in order
+		for (int32 Index = 0; Index < WindowCount; Index++)
+		{
+			FChunk& Chunk = Chunks[WindowStart + Index];
+			FEntry& Entry = Entries[Chunk.EntryIndex];
+
+			if (Chunk.bFailed)
+			{
+				return Fail(FString::Printf(TEXT("Failed to read %s"), *Entry.AbsolutePath));
+			}
+
+			if (Chunk.bFirst && !WriteLocalHeader(Entry))
+			{
+				return false;
+			}
+
+			if (!Emit(Chunk.Output))
+			{
+				return false;
+			}
+
+			Entry.Crc = Chunk.bFirst ? Chunk.Crc : (uint32)crc32_combine(Entry.Crc, Chunk.Crc, (z_off_t)Chunk.Length);
+			Entry.CompressedSize += Chunk.Output.Num();
+			BytesProcessed += Chunk.Length;
+
+			if (Chunk.bLast && !WriteDataDescriptor(Entry))
+			{
+				return false;
+			}
+
+			// Release the memory as soon as the chunk is written
+			Chunk.Output.Empty();
+		}
+
+		if (ProgressCallback)
+		{
+			ProgressCallback(BytesProcessed, TotalBytes);
+		}
+	}
+
+	if (!WriteCentralDirectory())
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GLC] ZIP written: %d files, %.2f MB -> %.2f MB"), Entries.Num(), TotalBytes / (1024.0 * 1024.0), BytesWritten / (1024.0 * 1024.0));
+	return true;
+}
+
+bool FGLCZipWriter::ProcessChunk(FChunk& Chunk) const
+{
+	const FEntry& Entry = Entries[Chunk.EntryIndex];
+
+	TArray<uint8> Input;
+	Input.SetNumUninitialized((int32)Chunk.Length);
+
+	if (Chunk.Length > 0)
+	{
+		TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Entry.AbsolutePath));
+		if (!Handle.IsValid() || !Handle->Seek(Chunk.Offset) || !Handle->Read(Input.GetData(), Chunk.Length))
+		{
+			return false;
+		}
+	}
+
+	Chunk.Crc = (uint32)crc32(0, Input.GetData(), (uInt)Input.Num());
+
+	if (Entry.Method == GLCZip::MethodStore)
+	{
+		Chunk.Output = MoveTemp(Input);
+		return true;
+	}
+
+	// Raw deflate (no zlib header). Chunks other than the last end with a sync flush so
+	// they are byte aligned and the concatenation forms a single valid deflate stream.
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (deflateInit2(&Stream, Entry.Level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	{
+		return false;
+	}
+
+	Chunk.Output.SetNumUninitialized((int32)deflateBound(&Stream, (uLong)Input.Num()) + 16);
+
+	Stream.next_in = Input.GetData();
+	Stream.avail_in = (uInt)Input.Num();
+	Stream.next_out = Chunk.Output.GetData();
+	Stream.avail_out = (uInt)Chunk.Output.Num();
+
+	int32 Result = deflate(&Stream, Chunk.bLast ? Z_FINISH : Z_SYNC_FLUSH);
+	bool bSuccess = Chunk.bLast ? (Result == Z_STREAM_END) : (Result == Z_OK && Stream.avail_in == 0);
+
+	Chunk.Output.SetNum((int32)Stream.total_out, EAllowShrinking::No);
+	deflateEnd(&Stream);
+
+	return bSuccess;
+}
+
+bool FGLCZipWriter::WriteLocalHeader(FEntry& Entry)
+{
+	Entry.LocalHeaderOffset = BytesWritten;
+
+	TArray<uint8> Header;
+	GLCZip::Put32(Header, GLCZip::LocalFileHeaderSignature);
+	GLCZip::Put16(Header, Entry.bZip64Local ? GLCZip::VersionNeededZip64 : GLCZip::VersionNeededDeflate);
+	GLCZip::Put16(Header, Entry.Flags);
+	GLCZip::Put16(Header, Entry.Method);
+	GLCZip::Put16(Header, GLCZip::DosTime);
+	GLCZip::Put16(Header, GLCZip::DosDate);
+
+	// CRC and sizes are written in the data descriptor
+	GLCZip::Put32(Header, 0);
+	GLCZip::Put32(Header, Entry.bZip64Local ? 0xFFFFFFFFu : 0u);
+	GLCZip::Put32(Header, Entry.bZip64Local ? 0xFFFFFFFFu : 0u);
+	GLCZip::Put16(Header, (uint16)Entry.Name.Num());
+	GLCZip::Put16(Header, Entry.bZip64Local ? 20 : 0);
+	Header.Append(Entry.Name);
+
+	if (Entry.bZip64Local)
+	{
+		GLCZip::Put16(Header, GLCZip::Zip64ExtraFieldTag);
+		GLCZip::Put16(Header, 16);
+		GLCZip::Put64(Header, 0);
+		GLCZip::Put64(Header, 0);
+	}
+
+	return Emit(Header);
+}
+
+bool FGLCZipWriter::WriteDataDescriptor(const FEntry& Entry)
+{
+	TArray<uint8> Descriptor;
+	GLCZip::Put32(Descriptor, GLCZip::DataDescriptorSignature);
+	GLCZip::Put32(Descriptor, Entry.Crc);
+
+	if (Entry.bZip64Local)
+	{
+		GLCZip::Put64(Descriptor, (uint64)Entry.CompressedSize);
+		GLCZip::Put64(Descriptor, (uint64)Entry.UncompressedSize);
+	}
+	else
+	{
+		if (Entry.CompressedSize >= 0xFFFFFFFFLL)
+		{
+			return Fail(FString::Printf(TEXT("Entry grew past the ZIP32 limit: %s"), *Entry.AbsolutePath));
+		}
+		GLCZip::Put32(Descriptor, (uint32)Entry.CompressedSize);
+		GLCZip::Put32(Descriptor, (uint32)Entry.UncompressedSize);
+	}
+
+	return Emit(Descriptor);
+}
+
+bool FGLCZipWriter::WriteCentralDirectory()
+{
+	const int64 CentralDirectoryOffset = BytesWritten;
+
+	for (const FEntry& Entry : Entries)
+	{
+		bool bZip64Uncompressed = Entry.UncompressedSize >= 0xFFFFFFFFLL;
+		bool bZip64Compressed = Entry.CompressedSize >= 0xFFFFFFFFLL;
+		bool bZip64Offset = Entry.LocalHeaderOffset >= 0xFFFFFFFFLL;
+
+		// The ZIP64 extra field lists only the values that overflowed, in this order
+		TArray<uint8> Extra;
+		if (bZip64Uncompressed || bZip64Compressed || bZip64Offset)
+		{
+			uint16 ExtraSize = (bZip64Uncompressed ? 8 : 0) + (bZip64Compressed ? 8 : 0) + (bZip64Offset ? 8 : 0);
+			GLCZip::Put16(Extra, GLCZip::Zip64ExtraFieldTag);
+			GLCZip::Put16(Extra, ExtraSize);
+			if (bZip64Uncompressed)
+			{
+				GLCZip::Put64(Extra, (uint64)Entry.UncompressedSize);
+			}
+			if (bZip64Compressed)
+			{
+				GLCZip::Put64(Extra, (uint64)Entry.CompressedSize);
+			}
+			if (bZip64Offset)
+			{
+				GLCZip::Put64(Extra, (uint64)Entry.LocalHeaderOffset);
+			}
+		}
+
+		uint16 VersionNeeded = (Entry.bZip64Local || Extra.Num() > 0) ? GLCZip::VersionNeededZip64 : GLCZip::VersionNeededDeflate;
+
+		TArray<uint8> Header;
+		GLCZip::Put32(Header, GLCZip::CentralFileHeaderSignature);
+		GLCZip::Put16(Header, GLCZip::VersionNeededZip64);
+		GLCZip::Put16(Header, VersionNeeded);
+		GLCZip::Put16(Header, Entry.Flags);
+		GLCZip::Put16(Header, Entry.Method);
+		GLCZip::Put16(Header, GLCZip::DosTime);
+		GLCZip::Put16(Header, GLCZip::DosDate);
+		GLCZip::Put32(Header, Entry.Crc);
+		GLCZip::Put32(Header, GLCZip::Clamp32(Entry.CompressedSize));
+		GLCZip::Put32(Header, GLCZip::Clamp32(Entry.UncompressedSize));
+		GLCZip::Put16(Header, (uint16)Entry.Name.Num());
+		GLCZip::Put16(Header, (uint16)Extra.Num());
+		GLCZip::Put16(Header, 0); // Comment length
+		GLCZip::Put16(Header, 0); // Disk number
+		GLCZip::Put16(Header, 0); // Internal attributes
+		GLCZip::Put32(Header, 0); // External attributes
+		GLCZip::Put32(Header, GLCZip::Clamp32(Entry.LocalHeaderOffset));
+		Header.Append(Entry.Name);
+		Header.Append(Extra);
+
+		if (!Emit(Header))
+		{
+			return false;
+		}
+	}
+
+	const int64 CentralDirectorySize = BytesWritten - CentralDirectoryOffset;
+	const int64 EntryCount = Entries.Num();
+	bool bNeedsZip64 = EntryCount >= 0xFFFF || CentralDirectoryOffset >= 0xFFFFFFFFLL || CentralDirectorySize >= 0xFFFFFFFFLL;
+
+	TArray<uint8> Trailer;
+	if (bNeedsZip64)
+	{
+		const int64 Zip64RecordOffset = BytesWritten;
+
+		GLCZip::Put32(Trailer, GLCZip::Zip64EndOfCentralDirectorySignature);
+		GLCZip::Put64(Trailer, 44); // Size of the remaining record
+		GLCZip::Put16(Trailer, GLCZip::VersionNeededZip64);
+		GLCZip::Put16(Trailer, GLCZip::VersionNeededZip64);
+		GLCZip::Put32(Trailer, 0);
+		GLCZip::Put32(Trailer, 0);
+		GLCZip::Put64(Trailer, (uint64)EntryCount);
+		GLCZip::Put64(Trailer, (uint64)EntryCount);
+		GLCZip::Put64(Trailer, (uint64)CentralDirectorySize);
+		GLCZip::Put64(Trailer, (uint64)CentralDirectoryOffset);
+
+		GLCZip::Put32(Trailer, GLCZip::Zip64EndOfCentralDirectoryLocatorSignature);
+		GLCZip::Put32(Trailer, 0);
+		GLCZip::Put64(Trailer, (uint64)Zip64RecordOffset);
+		GLCZip::Put32(Trailer, 1);
+	}
+
+	uint16 EntryCount16 = EntryCount >= 0xFFFF ? 0xFFFF : (uint16)EntryCount;
+	GLCZip::Put32(Trailer, GLCZip::EndOfCentralDirectorySignature);
+	GLCZip::Put16(Trailer, 0);
+	GLCZip::Put16(Trailer, 0);
+	GLCZip::Put16(Trailer, EntryCount16);
+	GLCZip::Put16(Trailer, EntryCount16);
+	GLCZip::Put32(Trailer, GLCZip::Clamp32(CentralDirectorySize));
+	GLCZip::Put32(Trailer, GLCZip::Clamp32(CentralDirectoryOffset));
+	GLCZip::Put16(Trailer, 0); // Comment length
+
+	return Emit(Trailer);
+}
@@ -2,6 +2,7 @@
 
 #include "GameLauncherCloudEditorModule.h"
 #include "GLCManagerWindow.h"
+#include "GLCJobScheduler.h"
 #include "GLCCommands.h"
 #include "ToolMenus.h"
 #include "WorkspaceMenuStructure.h"
@@ -29,6 +30,10 @@ void FGameLauncherCloudEditorModule::StartupModule()
 	
 	FSlateStyleRegistry::RegisterSlateStyle(*StyleSet);
 	
+	// Restore the job queue saved by the previous session; commandlets leave it to the next editor session
+	JobScheduler = MakeUnique<FGLCJobScheduler>();
+	JobScheduler->Initialize(!IsRunningCommandlet());
+	
 	// Register commands
 	FGLCCommands::Register();
 	
@@ -66,6 +71,13 @@ void FGameLauncherCloudEditorModule::ShutdownModule()
 
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(GLCManagerTabName);
 	
+	// Running jobs are saved and start again next session
+	if (JobScheduler.IsValid())
+	{
+		JobScheduler->Shutdown();
+		JobScheduler.Reset();
+	}
+	
 	// Unregister style
 	if (StyleSet.IsValid())
 	{
@@ -76,6 +88,11 @@ void FGameLauncherCloudEditorModule::ShutdownModule()
 	UE_LOG(LogTemp, Log, TEXT("GameLauncherCloud Editor Module Shutdown"));
 }
 
+FGameLauncherCloudEditorModule& FGameLauncherCloudEditorModule::Get()
+{
+	return FModuleManager::LoadModuleChecked<FGameLauncherCloudEditorModule>("GameLauncherCloudEditor");
+}
+
 void FGameLauncherCloudEditorModule::OpenManagerWindow()
 {
 	FGlobalTabmanager::Get()->TryInvokeTab(GLCManagerTabName);
@@ -5,6 +5,13 @@
 #include "CoreMinimal.h"
 #include "Http.h"
 #include "Dom/JsonObject.h"
+#include "GLCCompressionPolicy.h"
+#include "GLCChunker.h"
+#include "GLCFileHasher.h"
+#include "GLCRetryPolicy.h"
+
+class FGLCHttpSession;
+class FGLCBuildStatusStream;
 
 /// <summary>
 /// Response structure for login operations
@@ -31,6 +38,17 @@ struct FGLCAppInfo
 	bool IsOwnedByUser;
 };
 
+/// <summary>
+/// One page of the app list
+/// </summary>
+struct FGLCAppListPage
+{
+	TArray<FGLCAppInfo> Apps;
+	
+	/** Passed back to get the next page; empty on the last page, and from servers that return every app at once */
+	FString NextCursor;
+};
+
 /// <summary>
 /// Upload validation response
 /// </summary>
@@ -55,6 +73,57 @@ struct FGLCStartUploadResponse
 	FString FinalUrl;
 };
 
+/// <summary>
+/// Presigned URL for a single part of a multipart upload
+/// </summary>
+struct FGLCMultipartPartUrl
+{
+	int32 PartNumber;
+	FString Url;
+};
+
+/// <summary>
+/// Start multipart upload response with one presigned URL per part
+/// </summary>
+struct FGLCStartMultipartUploadResponse
+{
+	int64 AppBuildId;
+	FString Key;
+	FString UploadId;
+	int64 PartSize;
+	TArray<FGLCMultipartPartUrl> Parts;
+};
+
+/// <summary>
+/// Part that has been uploaded and acknowledged by the storage backend
+/// </summary>
+struct FGLCCompletedPart
+{
+	int32 PartNumber;
+	FString ETag;
+	
+	// Base64 SHA-256 of the part data, empty if unknown
+	FString ChecksumSha256;
+};
+
+/// <summary>
+/// Start chunked upload response
+/// </summary>
+struct FGLCStartChunkedUploadResponse
+{
+	int64 AppBuildId;
+	FString Key;
+};
+
+/// <summary>
+/// Presigned URL for a chunk the server does not have yet
+/// </summary>
+struct FGLCChunkUploadUrl
+{
+	FString Hash;
+	FString Url;
+};
+
 /// <summary>
 /// Build status response
 /// </summary>
@@ -82,20 +151,71 @@ public:
 	
 	void SetAuthToken(const FString& Token);
 	
+	// Shared session every API request goes through: default headers, kept-alive connections and request timing
+	TSharedRef<FGLCHttpSession, ESPMode::ThreadSafe> GetSession() const { return Session; }
+	
+	// Set once by whoever creates the client, before any request; the client is shared by every job.
+	// Sends each part's SHA-256 as x-amz-checksum-sha256 so storage rejects corrupted parts.
+	// Off by default: the presigned part URLs must have been signed for the header.
+	void SetSendPartChecksums(bool bEnabled) { bSendPartChecksums = bEnabled; }
+	
+	// Applied to every API request and upload part; requests changing server state carry an Idempotency-Key.
+	// Set once when the client is created, like the part checksums.
+	void SetRetryPolicy(const FGLCRetryPolicy& Policy) { RetryPolicy = Policy; }
+	
 	// Authentication
 	void LoginWithApiKeyAsync(const FString& ApiKey, TFunction<void(bool, FString, FGLCLoginResponse)> Callback);
 	
 	// App management
-	void GetAppListAsync(TFunction<void(bool, FString, TArray<FGLCAppInfo>)> Callback);
+	// Pages follow the cursor of the previous page, starting from an empty one; Limit 0 leaves the page size to the server
+	void GetAppListAsync(const FString& Cursor, int32 Limit, TFunction<void(bool, FString, FGLCAppListPage)> Callback);
 	
 	// Build upload
 	void CanUploadAsync(int64 FileSizeBytes, int64 UncompressedSizeBytes, int64 AppId, TFunction<void(bool, FString, FGLCCanUploadResponse)> Callback);
 	void StartUploadAsync(int64 AppId, const FString& FileName, int64 FileSize, int64 UncompressedFileSize, const FString& BuildNotes, TFunction<void(bool, FString, FGLCStartUploadResponse)> Callback);
+	// Streams the file from disk; memory use is bounded by FGLCFileRangeReader's read buffer.
+	// ProgressCallback(false, Message, Progress < 1) reports progress; the upload ends with exactly one of
+	// (true, Message, 1) on success, (false, Error, 1) on failure or (false, Message, -1) when cancelled.
 	void UploadFileAsync(const FString& PresignedUrl, const FString& FilePath, TFunction<void(bool, FString, float)> ProgressCallback);
+	
+	// Multipart build upload
+	void StartMultipartUploadAsync(int64 AppId, const FString& FileName, int64 FileSize, int64 UncompressedFileSize, const FString& BuildNotes, int64 PartSize, int32 PartCount, TFunction<void(bool, FString, FGLCStartMultipartUploadResponse)> Callback);
+	// ChecksumSha256 is the base64 SHA-256 of the part, sent as a header when part checksums are enabled
+	FGLCRetryingRequestPtr UploadPartAsync(const FString& PresignedUrl, const FString& FilePath, int64 Offset, int64 Length, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback, const FString& ChecksumSha256 = FString());
+	FGLCRetryingRequestPtr UploadPartDataAsync(const FString& PresignedUrl, TArray<uint8>&& Data, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback, const FString& ChecksumSha256 = FString());
+	// StatusCode is the HTTP status of the response, 0 when there was none
+	void GetMultipartPartUrlsAsync(int64 AppBuildId, const FString& Key, const FString& UploadId, const TArray<int32>& PartNumbers, TFunction<void(bool, FString, TArray<FGLCMultipartPartUrl>, int32 /*StatusCode*/)> Callback);
+	// FileSize is sent when >= 0, for uploads whose size was not known when they were started.
+	// FileHash, when given, lets the server verify the assembled archive.
+	void CompleteMultipartUploadAsync(int64 AppBuildId, const FString& Key, const FString& UploadId, const TArray<FGLCCompletedPart>& Parts, TFunction<void(bool, FString)> Callback, int64 FileSize = -1, const FGLCFileHash* FileHash = nullptr);
+	// Uploads every part with at most MaxConcurrency requests in flight, then completes the upload.
+	// ProgressCallback follows the UploadFileAsync contract. With a journal, only parts missing from it are sent.
+	void UploadFileMultipartAsync(const FGLCStartMultipartUploadResponse& Upload, const FString& FilePath, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback, TSharedPtr<struct FGLCUploadJournal> Journal = nullptr);
+	// Compresses SourceDirectory and uploads the archive parts as they are produced, without writing the archive to disk.
+	// Upload is a multipart upload started without part URLs; they are requested part by part.
+	void UploadDirectoryStreamedAsync(const FGLCStartMultipartUploadResponse& Upload, const FString& SourceDirectory, const FGLCCompressionPolicy& Policy, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback);
+	
+	// Chunked build upload: only chunks missing on the server are sent, the build is described by a chunk manifest
+	void StartChunkedUploadAsync(int64 AppId, int64 UncompressedFileSize, const FString& BuildNotes, TFunction<void(bool, FString, FGLCStartChunkedUploadResponse)> Callback);
+	// Returns an upload URL for every hash the server does not already store
+	void GetMissingChunksAsync(int64 AppBuildId, const TArray<FString>& ChunkHashes, TFunction<void(bool, FString, TArray<FGLCChunkUploadUrl>)> Callback);
+	void CompleteChunkedUploadAsync(int64 AppBuildId, const FString& Key, TSharedRef<FJsonObject> Manifest, TFunction<void(bool, FString)> Callback);
+	// Chunks SourceDirectory (reusing the app's chunk index for unchanged files), uploads the missing chunks and completes the upload.
+	// ProgressCallback follows the UploadFileAsync contract.
+	void UploadDirectoryChunkedAsync(int64 AppId, const FGLCStartChunkedUploadResponse& Upload, const FString& SourceDirectory, const FGLCChunkingParams& Params, FGLCFileHashesPtr FileHashes, int32 MaxConcurrency, TFunction<void(bool, FString, float)> ProgressCallback);
+	
 	void NotifyFileReadyAsync(int64 AppBuildId, const FString& Key, TFunction<void(bool, FString)> Callback);
 	
 	// Build status
 	void GetBuildStatusAsync(int64 AppBuildId, TFunction<void(bool, FString, FGLCBuildStatusResponse)> Callback);
+	// Conditional request: given the ETag of the last response, an unchanged status is answered with 304 and
+	// the callback gets bNotModified (third argument) and no response. The last argument is the ETag for the next request.
+	void GetBuildStatusAsync(int64 AppBuildId, const FString& IfNoneMatch, TFunction<void(bool, FString, bool, FGLCBuildStatusResponse, FString)> Callback);
+	// Statuses of several builds in one request, conditional like the single-build request with an ETag covering
+	// the whole set. Builds the server does not report are missing from the result.
+	void GetBuildStatusesAsync(const TArray<int64>& AppBuildIds, const FString& IfNoneMatch, TFunction<void(bool, FString, bool, TArray<FGLCBuildStatusResponse>, FString)> Callback);
+	// Pushed build statuses, shared by every monitor of this client; created on first use with the current token
+	TSharedRef<FGLCBuildStatusStream, ESPMode::ThreadSafe> GetBuildStatusStream(const FString& StreamUrl);
 	
 	// Build cancellation
 	void CancelBuildAsync(int64 AppBuildId, TFunction<void(bool, FString)> Callback);
@@ -104,13 +224,22 @@ public:
 	void CancelActiveUpload();
 
 private:
-	FString BaseUrl;
+	TSharedRef<FGLCHttpSession, ESPMode::ThreadSafe> Session;
 	FString AuthToken;
+	bool bSendPartChecksums;
+	FGLCRetryPolicy RetryPolicy;
+	
+	// Set once the server answered the batch status endpoint with 404; statuses are then requested build by build
+	bool bBatchStatusUnsupported;
 	
 	// Active upload request tracking
-	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> ActiveUploadRequest;
+	FGLCRetryingRequestPtr ActiveUploadRequest;
+	TSharedPtr<class FGLCMultipartUploader, ESPMode::ThreadSafe> ActiveMultipartUpload;
+	TSharedPtr<class FGLCStreamingUploader, ESPMode::ThreadSafe> ActiveStreamingUpload;
+	TSharedPtr<class FGLCChunkedUploader, ESPMode::ThreadSafe> ActiveChunkedUpload;
+	
+	TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> StatusStream;
 	
 	// Helper functions
-	TSharedPtr<FJsonObject> ParseJsonResponse(const FString& ResponseString);
-	bool ExtractApiResult(TSharedPtr<FJsonObject> JsonObject, TSharedPtr<FJsonObject>& OutResult, FString& OutError);
+	FGLCRetryingRequestPtr ProcessPartRequest(FGLCRetryingRequest::FMakeRequest MakeRequest, const FString& ChecksumSha256, TFunction<void(int64)> BytesSentCallback, TFunction<void(bool, FString, FString)> Callback);
 };
@@ -0,0 +1,91 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCApiClient.h"
+#include "GLCJsonReader.h"
+
+/// <summary>
+/// Typed decoding of Game Launcher Cloud API responses
+/// The response envelope (isSuccess, result, errorMessages) and the result structs are read straight
+/// from the UTF-8 body in one pass, without converting the body to a string or building a DOM.
+/// Keys match camelCase and PascalCase alike. Compare with the DOM path: GLC.BenchmarkJson.
+/// </summary>
+namespace GLCApiJson
+{
+	inline bool Read(FGLCJsonReader& Reader, FString& Out) { return Reader.Read(Out); }
+
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCLoginResponse& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCAppInfo& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCAppListPage& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCCanUploadResponse& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCStartUploadResponse& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCMultipartPartUrl& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCStartMultipartUploadResponse& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCStartChunkedUploadResponse& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCChunkUploadUrl& Out);
+	GAMELAUNCHERCLOUDEDITOR_API bool Read(FGLCJsonReader& Reader, FGLCBuildStatusResponse& Out);
+
+	/**
+	 * Appends the object elements of an array; they start zeroed, so fields missing from the payload read as 0
+	 * Null and other non-object elements are skipped without adding an entry.
+	 */
+	template <typename ElementType>
+	bool Read(FGLCJsonReader& Reader, TArray<ElementType>& Out)
+	{
+		return Reader.ReadArray([&Reader, &Out]()
+		{
+			if (!Reader.IsNextObject())
+			{
+				return true;
+			}
+			ElementType Element;
+			if (!Read(Reader, Element))
+			{
+				return false;
+			}
+			Out.Add(MoveTemp(Element));
+			return true;
+		});
+	}
+
+	/** Appends the string elements of an array, numbers keeping their text; other elements are skipped */
+	inline bool Read(FGLCJsonReader& Reader, TArray<FString>& Out)
+	{
+		return Reader.ReadArray([&Reader, &Out]()
+		{
+			return !Reader.IsNextString() || Reader.Read(Out.Emplace_GetRef());
+		});
+	}
+
+	/** Reads one field of an object, such as the list wrapped in a result, and skips the others */
+	template <typename ValueType>
+	bool ReadField(FGLCJsonReader& Reader, const ANSICHAR* Name, ValueType& Out)
+	{
+		return Reader.ReadObject([&Reader, Name, &Out](const FGLCJsonKey& Key)
+		{
+			return !Key.Is(Name) || Read(Reader, Out);
+		});
+	}
+
+	/**
+	 * Decodes a response envelope, ReadResult reading the result value
+	 * Returns true if the request succeeded with a result; otherwise OutError holds the first
+	 * error message of the response, or why the body could not be decoded.
+	 */
+	GAMELAUNCHERCLOUDEDITOR_API bool ReadEnvelope(TConstArrayView<uint8> Payload, TFunctionRef<bool(FGLCJsonReader&)> ReadResult, FString& OutError);
+
+	template <typename ResultType>
+	bool ReadApiResult(TConstArrayView<uint8> Payload, ResultType& OutResult, FString& OutError)
+	{
+		return ReadEnvelope(Payload, [&OutResult](FGLCJsonReader& Reader)
+		{
+			// Any other value would be skipped and pass for an empty result
+			return Reader.RequireObject() && Read(Reader, OutResult);
+		}, OutError);
+	}
+
+	/** First entry of the envelope's errorMessages, or Fallback when there is none */
+	GAMELAUNCHERCLOUDEDITOR_API FString ReadErrorMessage(TConstArrayView<uint8> Payload, const FString& Fallback);
+}
@@ -0,0 +1,98 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "GLCFileHasher.h"
+
+struct FFileChangeData;
+
+/// <summary>
+/// Persistent manifest (path, size, modification time, optional hash) of a packaged build directory
+/// The manifest is saved in the project's Intermediate directory and revalidated with a single stat
+/// pass the first time it is used in a session. After that a directory watcher reports changed files,
+/// so Refresh() only touches those and size/file count are available in constant time.
+/// Refresh() may run on a background thread; UpdateWatcher() and destruction belong on the game thread.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildManifest
+{
+public:
+	struct FEntry
+	{
+		int64 Size = 0;
+		FDateTime ModifiedTime;
+
+		/** Content hashes, cleared whenever size or modification time change */
+		FGLCFileHash Hash;
+	};
+
+	explicit FGLCBuildManifest(const FString& InRootDirectory);
+	~FGLCBuildManifest();
+
+	/**
+	 * Brings the manifest up to date: full stat pass when needed, otherwise only the files reported by the watcher
+	 * Returns false if it was cancelled; the next call then scans again
+	 */
+	bool Refresh(const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Starts or stops watching the root depending on whether it exists. Game thread only */
+	void UpdateWatcher();
+
+	const FString& GetRootDirectory() const { return RootDirectory; }
+	bool RootExists() const { return bRootExists; }
+	int32 GetFileCount() const { return Entries.Num(); }
+	int64 GetTotalSize() const { return TotalSize; }
+
+	/** Entries keyed by path relative to the root, with forward slashes */
+	const TMap<FString, FEntry>& GetEntries() const { return Entries; }
+
+	/** Stores the content hash of a file whose size and modification time are unchanged */
+	void SetHash(const FString& RelativePath, const FGLCFileHash& Hash);
+
+	/**
+	 * Hashes every file without a cached hash, in parallel; unchanged files keep the hash from earlier sessions
+	 * Same threading rules as Refresh(); returns false if it was cancelled or a file could not be read
+	 */
+	bool UpdateHashes(const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Manifest location inside the project's Intermediate directory, one per root directory */
+	FString GetManifestPath() const;
+
+	/**
+	 * Lists every file below Directory with its stat data
+	 * Each directory level is listed in parallel across worker threads
+	 */
+	static bool CollectFiles(const FString& Directory, TArray<TPair<FString, FFileStatData>>& OutFiles, const TAtomic<bool>* bCancelRequested = nullptr);
+
+private:
+	bool Load();
+	bool Save();
+	bool FullScan(const TAtomic<bool>* bCancelRequested);
+	void UpdatePath(const FString& AbsolutePath);
+	void SetEntry(const FString& RelativePath, int64 Size, const FDateTime& ModifiedTime);
+	void RemoveEntries(const FString& RelativePath);
+	FString ToRelativePath(const FString& AbsolutePath) const;
+
+	void StartWatching();
+	void StopWatching();
+	void OnDirectoryChanged(const TArray<FFileChangeData>& Changes);
+
+	FString RootDirectory;
+	TMap<FString, FEntry> Entries;
+	int64 TotalSize;
+
+	// Paths reported by the watcher since the last Refresh(), guarded by ChangesLock
+	FCriticalSection ChangesLock;
+	TSet<FString> PendingChanges;
+	bool bNeedsFullScan;
+	bool bWatching;
+
+	FDelegateHandle WatcherHandle;
+
+	bool bLoaded;
+	bool bRootExists;
+	bool bDirty;
+};
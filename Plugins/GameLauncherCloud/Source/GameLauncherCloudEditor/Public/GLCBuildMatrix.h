@@ -0,0 +1,53 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCBuildProfile.h"
+#include "GLCSettings.h"
+
+class FGLCJobScheduler;
+
+/// <summary>
+/// One platform/configuration combination of a build matrix
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCBuildMatrixEntry
+{
+	FString Platform;
+	FString Configuration;
+
+	FString GetName() const { return FString::Printf(TEXT("%s %s"), *Platform, *Configuration); }
+};
+
+/// <summary>
+/// Jobs submitted for one matrix entry, in the order they run: build, compress when the upload needs an archive, upload
+/// </summary>
+struct FGLCBuildMatrixJobs
+{
+	FGLCBuildMatrixEntry Entry;
+	TArray<int64> JobIds;
+};
+
+/// <summary>
+/// Builds several platforms/configurations of the project and uploads each one as its own app build
+/// Every entry becomes a chain of scheduler jobs archiving into its own directory, so the matrix
+/// shares the scheduler's concurrency limits, persistence and cancellation with single builds and
+/// uploads. Builds of different platforms run side by side up to the Build job limit; builds of one
+/// platform share the cooked output and run one after the other. Each entry is uploaded as soon as it
+/// is built while the others keep building. Game thread only.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildMatrix
+{
+public:
+	/** Queues the jobs of every entry; returns them per entry */
+	static TArray<FGLCBuildMatrixJobs> Submit(FGLCJobScheduler& Scheduler, int64 AppId, const FString& BuildNotes, EGLCBuildMode Mode, const TArray<FGLCBuildMatrixEntry>& Entries, const FGLCSettings& Settings);
+
+	/** Platforms the current host can build */
+	static const TArray<FString>& GetSupportedPlatforms();
+
+	/** UAT archive directory of an entry, below Builds/GLC_Matrix */
+	static FString GetArchiveDirectory(const FGLCBuildMatrixEntry& Entry);
+
+	/** Archive an entry is compressed to, or named after when it is streamed: Builds/GLC_Matrix/<Project>_<Platform>_<Configuration>.zip */
+	static FString GetZipPath(const FGLCBuildMatrixEntry& Entry);
+};
@@ -0,0 +1,89 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/// <summary>
+/// How much work a build does
+/// Full compiles, cooks everything and stages from scratch; FastIteration cooks incrementally,
+/// skips compiling when no code changed and skips the build entirely when nothing changed
+/// </summary>
+enum class EGLCBuildMode : uint8
+{
+	Full,
+	FastIteration
+};
+
+/// <summary>
+/// Build settings chosen for an app, stored per app in glc_build_profiles.json
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCBuildProfile
+{
+	EGLCBuildMode Mode = EGLCBuildMode::Full;
+
+	/** BuildCookRun client configuration: Development, Shipping or DebugGame */
+	FString Configuration = TEXT("Development");
+
+	bool IsFastIteration() const { return Mode == EGLCBuildMode::FastIteration; }
+
+	/** Identifies everything that changes the build output for a given project state */
+	FString GetKey(const FString& Platform) const;
+
+	/**
+	 * BuildCookRun arguments for this profile
+	 * bCompile is false when the previous build's binaries can be reused because no code changed
+	 */
+	FString MakeArguments(const FString& ProjectFile, const FString& Platform, const FString& ArchiveDirectory, bool bCompile) const;
+
+	static const TArray<FString>& GetConfigurations();
+	static FString GetModeDisplayName(EGLCBuildMode InMode);
+
+	/** Profile file next to glc_config.json */
+	static FString GetProfilesPath();
+
+	/** Profile saved for an app, or the default profile */
+	static FGLCBuildProfile LoadForApp(int64 AppId);
+	static bool SaveForApp(int64 AppId, const FGLCBuildProfile& Profile);
+};
+
+/// <summary>
+/// Fingerprint of the project inputs of a build, used to detect up-to-date builds
+/// Hashes the path, size and modification time of every code file (Source, .uproject, .uplugin)
+/// and content file (Content, Config) of the project and its plugins. Files are not read.
+/// The stamp of the last build is kept per platform and configuration, with the archive directory
+/// the build went into, so builds that archive to different directories do not forget each other.
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCBuildStamp
+{
+	uint64 CodeHash = 0;
+	uint64 ContentHash = 0;
+
+	/** FGLCBuildProfile::GetKey of the build */
+	FString ProfileKey;
+
+	/** Full path of the directory the build was archived to */
+	FString ArchiveDirectory;
+
+	/** Scans the project; returns false if cancelled */
+	static bool Compute(const FString& ProfileKey, FGLCBuildStamp& OutStamp, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Stamp of the last successful build for a platform and configuration, if it was archived to InArchiveDirectory */
+	static bool LoadLast(const FString& Platform, const FString& Configuration, const FString& InArchiveDirectory, FGLCBuildStamp& OutStamp);
+
+	/** Records a successful build archived to InArchiveDirectory */
+	bool SaveAsLast(const FString& Platform, const FString& Configuration, const FString& InArchiveDirectory);
+
+	/** Forgets every build archived to InArchiveDirectory, whatever its platform and configuration; called before a build replaces it */
+	static void DeleteForArchive(const FString& InArchiveDirectory);
+
+	/** Stamp file of a platform and configuration inside the project's Intermediate directory */
+	static FString GetStampPath(const FString& Platform, const FString& Configuration);
+
+	bool HasSameCode(const FGLCBuildStamp& Other) const { return ProfileKey == Other.ProfileKey && CodeHash == Other.CodeHash; }
+	bool IsUpToDate(const FGLCBuildStamp& Other) const { return HasSameCode(Other) && ContentHash == Other.ContentHash; }
+
+private:
+	static bool LoadFile(const FString& StampPath, FGLCBuildStamp& OutStamp);
+};
@@ -0,0 +1,78 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCFileHasher.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+
+class FGLCBuildManifest;
+
+/// <summary>
+/// Result of one build detection pass, published as a whole so the UI never sees a partial update
+/// </summary>
+struct FGLCBuildSnapshot
+{
+	bool bHasBuildReady = false;
+	bool bIsCompressed = false;
+	FDateTime LastBuildDate;
+	FString LastBuildPath;
+	int64 LastBuildSize = 0;
+	int64 UncompressedBuildSize = 0;
+	int32 TotalFileCount = 0;
+};
+
+/// <summary>
+/// Runs build detection on a background task so Slate never walks the file system
+/// A new request cancels the scan in progress; only the result of the latest request is published.
+/// The build manifest (and its directory watcher) is owned here and only released on the game thread.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildScanner : public TSharedFromThis<FGLCBuildScanner, ESPMode::ThreadSafe>
+{
+public:
+	typedef TSharedPtr<const FGLCBuildSnapshot, ESPMode::ThreadSafe> FSnapshotPtr;
+
+	FGLCBuildScanner();
+
+	/**
+	 * Starts scanning the archive and the build directory. Game thread only
+	 * OnComplete is invoked on the game thread with the new snapshot, unless a newer request superseded this one
+	 */
+	void RequestScan(const FString& ZipPath, const FString& BuildPath, TFunction<void(FSnapshotPtr)> OnComplete);
+
+	/**
+	 * Hashes every file of the build directory of the latest request on a background task. Game thread only
+	 * Hashes cached in the build manifest are reused for unchanged files. OnComplete is invoked on the game
+	 * thread with the hashes keyed by relative path, or null if hashing failed or was cancelled.
+	 * A BuildPath other than the latest request's switches the manifest to that directory first.
+	 */
+	void RequestHashes(TFunction<void(FGLCFileHashesPtr)> OnComplete, const FString& BuildPath = FString());
+
+	/** Cancels the scan and hashing in progress, if any */
+	void Cancel();
+
+	bool IsScanning() const { return bIsScanning; }
+
+	/** Latest published snapshot, null until the first scan completes. Safe from any thread */
+	FSnapshotPtr GetSnapshot() const;
+
+	/** Manifest of the build directory of the latest request, may be null */
+	TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> GetManifest() const { return Manifest; }
+
+private:
+	/** Background part of a scan; returns false if it was cancelled */
+	static bool Scan(const FString& ZipPath, TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> BuildManifest, const TAtomic<bool>& bCancelRequested, FGLCBuildSnapshot& OutSnapshot);
+
+	mutable FCriticalSection SnapshotLock;
+	FSnapshotPtr Snapshot;
+
+	// Serializes scans so only one touches the manifest at a time
+	FCriticalSection ScanLock;
+
+	TSharedPtr<FGLCBuildManifest, ESPMode::ThreadSafe> Manifest;
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> ActiveCancelToken;
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> HashCancelToken;
+	int32 ScanGeneration;
+	bool bIsScanning;
+};
@@ -0,0 +1,84 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GLCApiClient.h"
+
+class FGLCBuildStatusStream;
+
+/// <summary>
+/// Watches the processing status of any number of builds with one shared poll, owned by the job scheduler
+/// Builds that are due go out together in one batched status request, along with builds due within half
+/// their interval, so however many builds are watched they cost one request per poll. A build's interval
+/// follows its stage and doubles with every poll that brings no change, up to the configured maximum,
+/// which is also used while the editor is in the background. With the status stream enabled, statuses
+/// are pushed instead and polling pauses while the stream is connected. Game thread.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildStatusMonitor : public TSharedFromThis<FGLCBuildStatusMonitor, ESPMode::ThreadSafe>
+{
+public:
+	typedef TFunction<void(const FGLCBuildStatusResponse&)> FOnStatus;
+
+	explicit FGLCBuildStatusMonitor(TSharedPtr<FGLCApiClient> InApiClient);
+	~FGLCBuildStatusMonitor();
+
+	/** Statuses of AppBuildId, polled or pushed, go to OnStatus until unsubscribed; the build is polled on the next tick */
+	FDelegateHandle Subscribe(int64 AppBuildId, FOnStatus OnStatus);
+	void Unsubscribe(FDelegateHandle Handle);
+
+	/** Builds with at least one subscriber */
+	int32 GetNumWatchedBuilds() const { return Builds.Num(); }
+
+	/** Seconds between two status requests during a stage, while the status keeps changing */
+	static float GetStagePollInterval(const FString& Status);
+
+	/** Period of the ticker checking whether a request is due */
+	static constexpr float PollTickInterval = 1.0f;
+
+	/** Builds per status request; the least overdue ones wait for the next poll */
+	static constexpr int32 MaxBuildsPerRequest = 50;
+
+private:
+	struct FSubscriber
+	{
+		FDelegateHandle Handle;
+		FOnStatus OnStatus;
+	};
+
+	struct FWatchedBuild
+	{
+		int64 AppBuildId;
+		TArray<FSubscriber> Subscribers;
+		FDelegateHandle StreamHandle;
+		FString LastStatus;
+		int32 LastStageProgress;
+		int32 UnchangedPolls;
+		double LastPollTime;
+		float PollJitter;
+	};
+
+	void Start();
+	void Stop();
+	bool OnPollTick(float DeltaTime);
+	void Poll(const TArray<int64>& AppBuildIds);
+	void HandleStatus(const FGLCBuildStatusResponse& Response);
+	FWatchedBuild* FindBuild(int64 AppBuildId);
+
+	/** Seconds from the last request for the build to the next one */
+	float GetPollInterval(const FWatchedBuild& Build) const;
+
+	static bool IsEditorInBackground();
+
+	TSharedPtr<FGLCApiClient> ApiClient;
+	TArray<FWatchedBuild> Builds;
+	TSharedPtr<FGLCBuildStatusStream, ESPMode::ThreadSafe> StatusStream;
+	FTSTicker::FDelegateHandle PollTickerHandle;
+	bool bRequestInFlight;
+	float MaxPollInterval;
+
+	/** ETag of the last batch, sent again only when polling the same builds */
+	FString BatchETag;
+	TArray<int64> BatchETagBuilds;
+};
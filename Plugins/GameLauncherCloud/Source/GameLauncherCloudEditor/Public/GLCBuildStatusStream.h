@@ -0,0 +1,76 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GLCApiClient.h"
+#include "GLCRetryPolicy.h"
+
+class IWebSocket;
+
+/// <summary>
+/// Build status changes pushed by the API over a WebSocket, for any number of builds
+/// Connects while at least one build is subscribed and sends {"type":"subscribe","appBuildIds":[...]}
+/// (and "unsubscribe"); the server answers with the current status of each build, then pushes every
+/// change as a build status object. Dropped connections are re-established with the retry policy's
+/// backoff and resubscribed. When the stream cannot be reached at all it gives up and reports
+/// unavailable, and subscribers keep polling. Game thread.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildStatusStream : public TSharedFromThis<FGLCBuildStatusStream, ESPMode::ThreadSafe>
+{
+public:
+	typedef TFunction<void(const FGLCBuildStatusResponse&)> FOnStatus;
+
+	FGLCBuildStatusStream(const FString& InUrl, const FString& InAuthToken, const FGLCRetryPolicy& InReconnectPolicy);
+	~FGLCBuildStatusStream();
+
+	/** Statuses of AppBuildId go to OnStatus until unsubscribed */
+	FDelegateHandle Subscribe(int64 AppBuildId, FOnStatus OnStatus);
+	void Unsubscribe(FDelegateHandle Handle);
+
+	/** True while connected: subscribers get every change without polling */
+	bool IsConnected() const;
+
+	/** True once the stream gave up connecting */
+	bool IsUnavailable() const { return bUnavailable; }
+
+	const FString& GetUrl() const { return Url; }
+
+	/** Stream endpoint of an API base URL, ws:// or wss:// like the API */
+	static FString GetStreamUrl(const FString& ApiBaseUrl);
+
+private:
+	struct FSubscription
+	{
+		FDelegateHandle Handle;
+		int64 AppBuildId;
+		FOnStatus OnStatus;
+	};
+
+	void Connect();
+	void Disconnect();
+
+	/** Drops the socket; it is destroyed on the next tick, as this may run inside one of its callbacks */
+	void ReleaseSocket();
+	void OnConnected();
+	void OnDisconnected(const FString& Reason);
+	void OnMessage(const FString& Message);
+	void SendSubscription(const TCHAR* Type, const TArray<int64>& AppBuildIds);
+	TArray<int64> GetSubscribedBuilds() const;
+
+	FString Url;
+	FString AuthToken;
+	FGLCRetryPolicy ReconnectPolicy;
+
+	TSharedPtr<IWebSocket> Socket;
+	TArray<FSubscription> Subscriptions;
+	FTSTicker::FDelegateHandle ReconnectTickerHandle;
+
+	/** Incremented with every socket released, so late callbacks of an old socket are ignored */
+	int32 Generation;
+
+	int32 FailedConnects;
+	bool bEverConnected;
+	bool bUnavailable;
+};
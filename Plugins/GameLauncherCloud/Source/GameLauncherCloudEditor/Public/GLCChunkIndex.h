@@ -0,0 +1,55 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCChunker.h"
+#include "GLCFileHasher.h"
+
+class FJsonObject;
+
+/// <summary>
+/// Chunk layout of a build: every file with the chunks it is made of
+/// The same data is sent to the server as the build manifest and kept locally, per app, for the
+/// last uploaded build. Locally it also records each file's size and modification time so
+/// unchanged files reuse their chunk list instead of being read and hashed again.
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCChunkIndex
+{
+	struct FFileEntry
+	{
+		int64 Size = 0;
+		FDateTime ModifiedTime;
+		TArray<FGLCChunk> Chunks;
+
+		/** Whole-file hashes the server can verify the reassembled file against, if known */
+		FGLCFileHash Hash;
+	};
+
+	int64 AppId = 0;
+	int64 AppBuildId = 0;
+	FGLCChunkingParams Params;
+
+	/** Files keyed by path relative to the build root, with forward slashes */
+	TMap<FString, FFileEntry> Files;
+
+	/** Index location inside the project's Intermediate directory */
+	static FString GetIndexPath(int64 InAppId);
+
+	/** Loads the index of the last build uploaded for an app, returns false if there is none */
+	static bool Load(int64 InAppId, FGLCChunkIndex& OutIndex);
+
+	/** Writes the index atomically (temp file + rename) */
+	bool Save() const;
+
+	/** Chunks of a file, if it is in the index with the same size and modification time */
+	const TArray<FGLCChunk>* FindUnchangedFile(const FString& RelativePath, int64 Size, const FDateTime& ModifiedTime) const;
+
+	int64 GetTotalSize() const;
+
+	/**
+	 * Serializes the index
+	 * The server manifest omits local data (modification times); the local index keeps it
+	 */
+	TSharedRef<FJsonObject> ToJson(bool bIncludeLocalData) const;
+};
@@ -0,0 +1,84 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCApiClient.h"
+#include "GLCChunkIndex.h"
+#include "Templates/Atomic.h"
+
+/// <summary>
+/// Uploads a build directory as content-defined chunks, sending only the chunks the server does not have
+/// Files are chunked and hashed on worker threads; files whose size and modification time match the
+/// app's chunk index reuse their previous chunk list without being read. The game thread then asks
+/// the server which unique chunks are missing, uploads those with up to MaxConcurrency requests in
+/// flight, and completes the upload with a manifest of the new build, including the whole-file
+/// hashes in FileHashes so the server can verify reassembled files. On success the manifest
+/// becomes the app's chunk index for the next upload.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCChunkedUploader : public TSharedFromThis<FGLCChunkedUploader, ESPMode::ThreadSafe>
+{
+public:
+	FGLCChunkedUploader(FGLCApiClient* InApiClient, int64 InAppId, const FGLCStartChunkedUploadResponse& InUpload, const FGLCChunkingParams& InParams, FGLCFileHashesPtr InFileHashes, int32 InMaxConcurrency);
+
+	/** Starts chunking and uploading. ProgressCallback follows the FGLCApiClient::UploadFileAsync contract */
+	void Start(const FString& SourceDirectory, TFunction<void(bool, FString, float)> InProgressCallback);
+
+	/** Stops chunking and cancels every in-flight chunk; the callback reports a cancellation */
+	void Cancel();
+
+	bool IsFinished() const { return bFinished; }
+
+private:
+	/** Where the bytes of a chunk can be read from */
+	struct FChunkSource
+	{
+		FString FilePath;
+		int64 Offset = 0;
+		int64 Size = 0;
+	};
+
+	// ========== WORKER THREADS ========== //
+	bool BuildIndex(const FString& SourceDirectory, FString& OutError);
+
+	// ========== GAME THREAD ========== //
+	void OnIndexBuilt(bool bSuccess, const FString& Error);
+	void QueryNextBatch();
+	void LaunchPendingChunks();
+	void OnChunkBytesSent(int32 ChunkIndex, int64 BytesSent);
+	void OnChunkFinished(int32 ChunkIndex, bool bSuccess, const FString& Error);
+	void ReportProgress();
+	void CompleteUpload();
+	void Finish(bool bSuccess, const FString& Message, float Progress);
+
+	FGLCApiClient* ApiClient;
+	int64 AppId;
+	FGLCStartChunkedUploadResponse Upload;
+	FGLCChunkingParams Params;
+	FGLCFileHashesPtr FileHashes;
+	int32 MaxConcurrency;
+	TFunction<void(bool, FString, float)> ProgressCallback;
+
+	// Shared with the chunking workers
+	TAtomic<bool> bCancelRequested;
+	TAtomic<int64> ChunkedBytes;
+	TAtomic<int64> TotalBytes;
+	TAtomic<int32> LastReportedPercent;
+
+	// Written by the workers, read by the game thread once chunking has finished
+	FGLCChunkIndex NewIndex;
+	TMap<FString, FChunkSource> ChunkSources;
+	TArray<FString> UniqueHashes;
+
+	// Game thread only
+	int32 NextQueryIndex;
+	bool bQueryFinished;
+	TArray<FGLCChunkUploadUrl> MissingChunks;
+	int32 NextChunkToLaunch;
+	TMap<int32, FGLCRetryingRequestPtr> InFlightRequests;
+	TMap<int32, int64> ChunkBytesSent;
+	int64 MissingBytes;
+	int64 UploadedBytes;
+	bool bChunkingFinished;
+	bool bFinished;
+};
@@ -0,0 +1,63 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/// <summary>
+/// One content-defined chunk of a file, identified by the BLAKE3 hash of its bytes
+/// </summary>
+struct FGLCChunk
+{
+	/** Lower case hex BLAKE3 hash of the chunk content */
+	FString Hash;
+	int64 Offset = 0;
+	int64 Size = 0;
+};
+
+/// <summary>
+/// Chunk size bounds; changing them invalidates every chunk index
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCChunkingParams
+{
+	int32 MinSize = 256 * 1024;
+	int32 AverageSize = 1024 * 1024;
+	int32 MaxSize = 4 * 1024 * 1024;
+
+	FGLCChunkingParams() {}
+
+	/** Bounds around an average size, rounded to a power of two */
+	explicit FGLCChunkingParams(int32 InAverageSize);
+
+	bool operator==(const FGLCChunkingParams& Other) const
+	{
+		return MinSize == Other.MinSize && AverageSize == Other.AverageSize && MaxSize == Other.MaxSize;
+	}
+};
+
+/// <summary>
+/// Content-defined chunking (FastCDC) of build files
+/// Cut points are chosen by a gear rolling hash over the content, so inserting or removing bytes
+/// only changes the chunks around the edit and the rest of the file still deduplicates against
+/// the previous build. Normalized chunking (a stricter mask below the average size and a looser
+/// one above it) keeps most chunks close to the average size.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCChunker
+{
+public:
+	/** Identifies the algorithm and hash in manifests so the server can reject unknown layouts */
+	static const TCHAR* GetAlgorithmName() { return TEXT("fastcdc-gear64/blake3"); }
+
+	/**
+	 * Splits a file into chunks and hashes them, reading it sequentially in large blocks
+	 * Safe to call from worker threads; returns false on read failure or cancellation
+	 */
+	static bool ChunkFile(const FString& FilePath, const FGLCChunkingParams& Params, TArray<FGLCChunk>& OutChunks, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Length of the first chunk of Data (Num bytes, at most MaxSize are examined) */
+	static int64 FindCutPoint(const uint8* Data, int64 Num, const FGLCChunkingParams& Params);
+
+	/** Lower case hex BLAKE3 hash of a buffer */
+	static FString HashBuffer(const uint8* Data, int64 Num);
+};
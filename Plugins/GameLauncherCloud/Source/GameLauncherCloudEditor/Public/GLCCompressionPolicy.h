@@ -0,0 +1,57 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/// <summary>
+/// How a single file is stored in the build archive
+/// </summary>
+enum class EGLCCompressionMethod : uint8
+{
+	Store,
+	FastDeflate,
+	HighDeflate
+};
+
+/// <summary>
+/// Chooses the compression method of each file in the build archive
+/// Cooked content (.pak/.ucas/.utoc) is already Oodle/zlib compressed, so deflating it again
+/// costs CPU for no size gain. Files are stored when their extension says so or when a sample
+/// of their content looks incompressible; the rest use fast or high deflate depending on size.
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCCompressionPolicy
+{
+	/** Extensions (lower case, with dot) that are always stored */
+	TArray<FString> StoreExtensions;
+
+	/** Sampled entropy in bits per byte at or above which a file is stored */
+	double StoreEntropyThreshold = 7.5;
+
+	/** Files larger than this use fast deflate instead of high deflate */
+	int64 FastDeflateThreshold = 256LL * 1024 * 1024;
+
+	/** Files smaller than this are stored, deflate overhead would outweigh any gain */
+	int64 MinCompressSize = 128;
+
+	/** zlib levels used for the two deflate methods */
+	int32 FastDeflateLevel = 1;
+	int32 HighDeflateLevel = 9;
+
+	FGLCCompressionPolicy();
+
+	/**
+	 * Picks the method for one file
+	 * Reads a few small samples of the file when the extension rules are not conclusive
+	 * Safe to call from worker threads
+	 */
+	EGLCCompressionMethod ChooseMethod(const FString& FilePath, int64 FileSize) const;
+
+	/** zlib level for a method, 0 for Store */
+	int32 GetLevel(EGLCCompressionMethod Method) const;
+
+	/** Shannon entropy in bits per byte of sampled regions of the file, or -1 on read failure */
+	static double EstimateEntropy(const FString& FilePath, int64 FileSize);
+
+	static const TCHAR* LexToString(EGLCCompressionMethod Method);
+};
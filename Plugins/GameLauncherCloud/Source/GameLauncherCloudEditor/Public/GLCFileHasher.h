@@ -0,0 +1,63 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCSha256.h"
+#include "Hash/xxhash.h"
+#include "Templates/Atomic.h"
+
+/// <summary>
+/// Integrity and identity hashes of a file
+/// XXH3 (64-bit) is cheap enough to compare files locally; SHA-256 is what the server verifies
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCFileHash
+{
+	uint64 XxHash3 = 0;
+
+	/** Lower case hex SHA-256, empty when the file has not been hashed */
+	FString Sha256;
+
+	bool IsSet() const { return !Sha256.IsEmpty(); }
+
+	FString GetXxHash3String() const { return FString::Printf(TEXT("%016llx"), XxHash3); }
+
+	/** Parses the form written by GetXxHash3String */
+	static uint64 ParseXxHash3(const FString& Value);
+};
+
+/** File hashes keyed by path relative to the build root, shared between threads */
+typedef TSharedPtr<const TMap<FString, FGLCFileHash>, ESPMode::ThreadSafe> FGLCFileHashesPtr;
+
+/// <summary>
+/// Computes XXH3 and SHA-256 in a single sequential pass over the data
+/// Files are read in large blocks; HashFiles spreads whole files across worker threads
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCFileHasher
+{
+public:
+	FGLCFileHasher();
+
+	void Update(const uint8* Data, int64 Num);
+	FGLCFileHash Finalize();
+
+	/**
+	 * Hashes one file
+	 * With PartSize > 0, also returns the base64 SHA-256 of every PartSize range (multipart upload parts)
+	 * Safe to call from worker threads; returns false on read failure or cancellation
+	 */
+	static bool HashFile(const FString& FilePath, FGLCFileHash& OutHash, int64 PartSize = 0, TArray<FString>* OutPartChecksums = nullptr, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/**
+	 * Hashes files in parallel; OutHashes matches FilePaths by index
+	 * BytesHashed, when given, is increased as data is read so callers can report progress
+	 */
+	static bool HashFiles(const TArray<FString>& FilePaths, TArray<FGLCFileHash>& OutHashes, const TAtomic<bool>* bCancelRequested = nullptr, TAtomic<int64>* BytesHashed = nullptr);
+
+	/** Size of the blocks files are read in */
+	static constexpr int64 ReadBlockSize = 8 * 1024 * 1024;
+
+private:
+	FXxHash64Builder XxHashBuilder;
+	FGLCSha256 Sha256;
+};
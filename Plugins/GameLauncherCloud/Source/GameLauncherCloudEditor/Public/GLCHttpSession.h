@@ -0,0 +1,117 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "GLCRetryPolicy.h"
+
+/// <summary>
+/// Timing of a request sent through FGLCHttpSession, in seconds
+/// The engine's HTTP interface does not report DNS, connect and TLS separately; they are part of
+/// TimeToFirstByte, which drops to the server time alone once a kept-alive connection is reused.
+/// </summary>
+struct FGLCHttpTiming
+{
+	/** Waiting for a free connection slot to the host */
+	double QueueTime = 0.0;
+
+	/** From sending to the first response header: DNS, connect and TLS when no connection was reused, plus server time */
+	double TimeToFirstByte = 0.0;
+
+	/** From sending to the complete response */
+	double TotalTime = 0.0;
+
+	int32 ResponseCode = 0;
+};
+
+/// <summary>
+/// Shared HTTP session for the Game Launcher Cloud API
+/// Builds requests against the base URL with preset default headers (authorization, keep-alive,
+/// user agent) and sends at most a few requests per host at once, so the engine's HTTP layer keeps
+/// reusing the same warm connections instead of opening and TLS-handshaking new ones for bursts of
+/// calls. Requests to the API get the current Authorization header when they are actually sent, so
+/// queued and retried requests pick up a refreshed token. Records the timing of every request. Thread safe.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCHttpSession : public TSharedFromThis<FGLCHttpSession, ESPMode::ThreadSafe>
+{
+public:
+	typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FRequestRef;
+
+	explicit FGLCHttpSession(const FString& InBaseUrl);
+
+	const FString& GetBaseUrl() const { return BaseUrl; }
+
+	/** Header added to every request; an empty value removes it */
+	void SetDefaultHeader(const FString& Name, const FString& Value);
+
+	/** Sets or, when empty, removes the bearer Authorization header */
+	void SetAuthToken(const FString& Token);
+
+	void SetMaxConnectionsPerHost(int32 MaxConnections);
+
+	/** Request to BaseUrl + Path with the default headers; requests other than GET get a JSON content type */
+	FRequestRef CreateRequest(const FString& Verb, const FString& Path) const;
+
+	/**
+	 * Sends a request as soon as its host has a free connection slot
+	 * The request's completion delegate must be bound before and runs as usual. Each request is sent once.
+	 */
+	void ProcessRequest(const FRequestRef& Request);
+
+	/**
+	 * Sends a request and sends copies of it again per the retry policy
+	 * For requests with an in-memory body; the completion delegate runs once, with the last attempt.
+	 * Copies carry every header but Authorization, which is taken from the current token.
+	 * Cancelling the returned request goes through CancelRequest.
+	 */
+	FGLCRetryingRequestPtr ProcessRequest(const FRequestRef& Request, const FGLCRetryPolicy& Policy);
+
+	/**
+	 * Cancels a request given to ProcessRequest
+	 * A request still waiting for a connection slot is dropped from the queue, never sent, and its
+	 * completion delegate runs right away as a failure without response; one in flight is cancelled
+	 * through the HTTP layer and completes from there.
+	 */
+	void CancelRequest(const FRequestRef& Request);
+
+	/** Adds a unique Idempotency-Key header so the server recognises retries of a request that changes its state */
+	static void AddIdempotencyKey(const FRequestRef& Request);
+
+	FGLCHttpTiming GetLastTiming() const;
+
+	/** Mean timing of all completed requests */
+	FGLCHttpTiming GetAverageTiming() const;
+
+	int32 GetCompletedRequestCount() const;
+
+	/** Requests in flight per host; matches the connections kept alive to the API */
+	static constexpr int32 DefaultMaxConnectionsPerHost = 4;
+
+private:
+	struct FPendingRequest
+	{
+		FRequestRef Request;
+		double QueuedAt;
+	};
+
+	struct FHostState
+	{
+		int32 ActiveRequests = 0;
+		TArray<FPendingRequest> Pending;
+	};
+
+	void Send(const FRequestRef& Request, const FString& Host, double QueuedAt);
+	void OnRequestFinished(const FString& Host, const FGLCHttpTiming& Timing);
+
+	FString BaseUrl;
+	TMap<FString, FString> DefaultHeaders;
+	int32 MaxConnectionsPerHost;
+
+	TMap<FString, FHostState> Hosts;
+	FGLCHttpTiming LastTiming;
+	FGLCHttpTiming TotalTiming;
+	int32 CompletedRequests;
+
+	mutable FCriticalSection Lock;
+};
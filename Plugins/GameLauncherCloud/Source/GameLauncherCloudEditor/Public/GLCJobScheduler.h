@@ -0,0 +1,243 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "GLCProgressChannel.h"
+#include "Templates/Atomic.h"
+
+class FGLCApiClient;
+class FGLCBuildStatusMonitor;
+class FGLCBuildScanner;
+class FGLCJobScheduler;
+
+enum class EGLCJobType : uint8
+{
+	Build,
+	Compress,
+	Upload,
+	Monitor
+};
+
+enum class EGLCJobState : uint8
+{
+	Pending,
+	Running,
+	Succeeded,
+	Failed,
+	Cancelled,
+	/** Interrupted and waiting for the user to resume it */
+	Paused
+};
+
+enum class EGLCJobPriority : uint8
+{
+	Low,
+	Normal,
+	High
+};
+
+/// <summary>
+/// Unit of work run by FGLCJobScheduler
+/// Inputs live in a JSON parameter object so the queue can be saved and restored across editor sessions.
+/// A job runs on the game thread and hands long work to other threads; it reports back through
+/// ReportProgress and Finish, which are safe from any thread. Progress goes into the job's progress
+/// channel and reaches the UI when the scheduler samples it, however often it is reported.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCJob : public TSharedFromThis<FGLCJob, ESPMode::ThreadSafe>
+{
+public:
+	virtual ~FGLCJob() {}
+
+	int64 GetId() const { return Id; }
+	EGLCJobType GetType() const { return Type; }
+	EGLCJobPriority GetPriority() const { return Priority; }
+	EGLCJobState GetState() const { return State; }
+	float GetProgress() const { return Progress; }
+	const FString& GetMessage() const { return Message; }
+
+	/** Smoothed transfer rate of a job reporting bytes, 0 otherwise */
+	double GetBytesPerSecond() const { return LastSample.BytesPerSecond; }
+
+	/** Estimated seconds until the job's work is done; negative when unknown */
+	double GetSecondsRemaining() const { return LastSample.SecondsRemaining; }
+	const TArray<int64>& GetDependencies() const { return Dependencies; }
+	bool IsDone() const { return State == EGLCJobState::Succeeded || State == EGLCJobState::Failed || State == EGLCJobState::Cancelled; }
+
+	/** Inputs; the outputs of the dependencies are merged in before the job starts */
+	TSharedRef<FJsonObject> GetParams() const { return Params; }
+
+	/** Results handed to dependent jobs. Game thread only */
+	TSharedRef<FJsonObject> GetOutput() const { return Output; }
+
+	/** Short description for the job list */
+	virtual FString GetDisplayName() const = 0;
+
+	/** Jobs naming the same resource never run at the same time, whatever their type's limit; empty for none */
+	virtual FString GetExclusiveResource() const { return FString(); }
+
+	static FString GetTypeName(EGLCJobType InType);
+	static FString GetStateName(EGLCJobState InState);
+
+	/** Empty job of a type, filled from the saved queue */
+	static TSharedPtr<FGLCJob, ESPMode::ThreadSafe> Create(EGLCJobType InType);
+
+protected:
+	explicit FGLCJob(EGLCJobType InType);
+
+	/** Starts the work. Game thread; the job must eventually call Finish */
+	virtual void Start() = 0;
+
+	/** Stops the work at the user's request. Game thread; Finish is still expected */
+	virtual void Cancel() = 0;
+
+	/**
+	 * Stops the work because the editor is shutting down; the job starts again next session, or waits
+	 * to be resumed. Defaults to Cancel. Finish is not expected anymore.
+	 */
+	virtual void Suspend() { Cancel(); }
+
+	/** Safe from any thread and lock-free while the message stays the same */
+	void ReportProgress(float InProgress, const FString& InMessage);
+
+	/** Safe from any thread; the message adds size, throughput and time left to Stage. BytesTotal may be 0 when unknown */
+	void ReportBytes(float InProgress, const FString& InStage, int64 BytesDone, int64 BytesTotal);
+
+	/** Safe from any thread; InOutput is merged into Output on the game thread */
+	void Finish(EGLCJobState FinalState, const FString& InMessage, TSharedPtr<FJsonObject> InOutput = nullptr);
+
+	bool IsCancelRequested() const { return bCancelRequested; }
+
+	/** For work that polls for cancellation on other threads */
+	const TAtomic<bool>* GetCancelFlag() const { return &bCancelRequested; }
+
+	/** Null once the scheduler shut down */
+	FGLCJobScheduler* GetScheduler() const { return Scheduler; }
+
+	TSharedRef<FJsonObject> Params;
+	TSharedRef<FJsonObject> Output;
+
+private:
+	friend class FGLCJobScheduler;
+
+	int64 Id;
+	EGLCJobType Type;
+	EGLCJobPriority Priority;
+	EGLCJobState State;
+	float Progress;
+	FString Message;
+	TArray<int64> Dependencies;
+
+	FGLCProgressChannel ProgressChannel;
+	FGLCProgressChannel::FSample LastSample;
+
+	FGLCJobScheduler* Scheduler;
+	TAtomic<bool> bCancelRequested;
+};
+
+typedef TSharedPtr<FGLCJob, ESPMode::ThreadSafe> FGLCJobPtr;
+
+/// <summary>
+/// Persistent queue of build, compress, upload and monitor jobs, owned by the editor module
+/// Jobs start once all their dependencies succeeded, highest priority first and in submission order
+/// within a priority, with a concurrency limit per job type and at most one job per exclusive resource
+/// at a time. The Build limit comes from glc_config.json. A job whose dependency failed or was
+/// cancelled is cancelled as well. The queue is saved on every state change. Uploads and monitors that
+/// were running when the editor closed start again in the next session (uploads resume from their
+/// journal); builds and compressions come back paused, as restarting UAT is for the user to decide.
+/// The scheduler also owns the API client, build scanner and build status monitor shared by the jobs and
+/// the manager window.
+/// Game thread only.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCJobScheduler
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnJobChanged, const FGLCJobPtr& /*Job*/);
+
+	FGLCJobScheduler();
+	~FGLCJobScheduler();
+
+	/**
+	 * Creates and configures the API client from glc_config.json unless one is given, which the caller
+	 * configures; jobs start on the next tick
+	 * A persistent scheduler restores the saved queue and saves every change; the upload commandlet
+	 * runs an in-memory one so it neither picks up nor overwrites the editor's queue
+	 */
+	void Initialize(bool bInPersistent = true, TSharedPtr<FGLCApiClient> InApiClient = nullptr);
+
+	/** Suspends running jobs and saves the queue */
+	void Shutdown();
+
+	/** Queues a job; returns its id */
+	int64 Submit(const FGLCJobPtr& Job, const TArray<int64>& Dependencies = TArray<int64>(), EGLCJobPriority Priority = EGLCJobPriority::Normal);
+
+	/** Cancels a job and every job that depends on it */
+	void Cancel(int64 JobId);
+
+	/** Queues a paused job again; the jobs waiting for it follow once it succeeded */
+	void Resume(int64 JobId);
+
+	/** Moves a pending job ahead of or behind the others */
+	void SetPriority(int64 JobId, EGLCJobPriority Priority);
+
+	void SetMaxConcurrentJobs(EGLCJobType Type, int32 MaxJobs);
+
+	/** Removes finished jobs from the queue */
+	void ClearFinishedJobs();
+
+	FGLCJobPtr FindJob(int64 JobId) const;
+
+	/** Most recently submitted job of a type, if any */
+	FGLCJobPtr FindLatestJob(EGLCJobType Type) const;
+
+	/** True if a job of the type is pending or running */
+	bool HasActiveJobs(EGLCJobType Type) const;
+
+	/** Jobs in submission order */
+	const TArray<FGLCJobPtr>& GetJobs() const { return Jobs; }
+
+	TSharedPtr<FGLCApiClient> GetApiClient() const { return ApiClient; }
+	TSharedPtr<FGLCBuildScanner, ESPMode::ThreadSafe> GetBuildScanner() const { return BuildScanner; }
+	TSharedPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> GetStatusMonitor() const { return StatusMonitor; }
+
+	/** Broadcast when a job is queued, changes state or reports progress; with null when jobs were removed */
+	FOnJobChanged& OnJobChanged() { return JobChangedEvent; }
+
+	/** Saved queue inside the project's Intermediate directory */
+	static FString GetQueuePath();
+
+	/** Finished jobs kept in the queue for the job list */
+	static constexpr int32 MaxFinishedJobs = 20;
+
+	/** Times per second the progress of running jobs is sampled and broadcast */
+	static constexpr float ProgressSampleRate = 20.0f;
+
+private:
+	friend class FGLCJob;
+
+	void Schedule();
+	void StartJob(const FGLCJobPtr& Job);
+	void SetJobState(const FGLCJobPtr& Job, EGLCJobState State, const FString& Message);
+	bool OnSampleProgress(float DeltaTime);
+	void OnJobFinished(const FGLCJobPtr& Job, EGLCJobState State, const FString& Message);
+	void TrimFinishedJobs();
+
+	bool Load();
+	void Save() const;
+
+	TArray<FGLCJobPtr> Jobs;
+	TMap<EGLCJobType, int32> MaxConcurrentJobs;
+	int64 NextJobId;
+
+	TSharedPtr<FGLCApiClient> ApiClient;
+	TSharedPtr<FGLCBuildScanner, ESPMode::ThreadSafe> BuildScanner;
+	TSharedPtr<FGLCBuildStatusMonitor, ESPMode::ThreadSafe> StatusMonitor;
+
+	FOnJobChanged JobChangedEvent;
+	FTSTicker::FDelegateHandle StartTickerHandle;
+	FTSTicker::FDelegateHandle ProgressTickerHandle;
+	bool bPersistent;
+	bool bShuttingDown;
+};
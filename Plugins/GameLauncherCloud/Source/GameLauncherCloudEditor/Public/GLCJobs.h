@@ -0,0 +1,171 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCJobScheduler.h"
+#include "GLCApiClient.h"
+#include "GLCBuildProfile.h"
+#include "GLCSettings.h"
+
+struct FGLCUploadJournal;
+
+/// <summary>
+/// Runs BuildCookRun for a build profile into Builds/GLC_Upload, or another archive directory, on a dedicated thread
+/// In fast iteration mode the build is skipped when nothing changed since the last one and the
+/// compile step is skipped when no code changed. Builds of one platform share the cooked and staged
+/// output, so they never run at the same time. Params: mode, configuration, platform, archiveDirectory.
+/// Output: buildPath.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCBuildJob : public FGLCJob
+{
+public:
+	FGLCBuildJob();
+	/** Builds for the editor's platform unless a BuildCookRun platform is given, into GetArchiveDirectory unless another one is given */
+	explicit FGLCBuildJob(const FGLCBuildProfile& Profile, const FString& Platform = FString(), const FString& ArchiveDirectory = FString());
+
+	virtual FString GetDisplayName() const override;
+
+	/** The platform's cooked and staged output */
+	virtual FString GetExclusiveResource() const override;
+
+	/** Builds that fit the machine: roughly 8 logical cores and 16 GB of memory per cook */
+	static int32 GetDefaultMaxConcurrentBuilds();
+
+	/** Platform the editor runs on, in BuildCookRun's naming */
+	static FString GetHostPlatform();
+
+	/** Directory UAT archives the build to */
+	static FString GetArchiveDirectory();
+
+	/** Folder UAT archives a BuildCookRun platform to: Windows for Win64, the platform name otherwise */
+	static FString GetArchivePlatformFolder(const FString& Platform);
+
+	/** Packaged build of Platform inside an archive directory; the archive directory itself when there is none */
+	static FString GetBuildOutputPath(const FString& ArchiveDirectory, const FString& Platform);
+
+protected:
+	virtual void Start() override;
+
+	/** UAT polls the cancel flag */
+	virtual void Cancel() override {}
+};
+
+/// <summary>
+/// Writes a build directory to a ZIP archive on the thread pool
+/// Params: buildPath, zipPath. Output: buildPath, zipPath, zipSize, uncompressedSize.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCCompressJob : public FGLCJob
+{
+public:
+	FGLCCompressJob();
+	FGLCCompressJob(const FString& BuildPath, const FString& ZipPath);
+
+	virtual FString GetDisplayName() const override;
+
+	/** Archive uploads are compressed to: Builds/<Project>_upload.zip */
+	static FString GetDefaultZipPath();
+
+protected:
+	virtual void Start() override;
+
+	/** The ZIP writer polls the cancel flag */
+	virtual void Cancel() override {}
+};
+
+enum class EGLCUploadMethod : uint8
+{
+	/** Upload an existing archive, as multipart upload with a resume journal when it is large */
+	Archive,
+	/** Compress the build directory while uploading it */
+	Streamed,
+	/** Upload the build directory as content-defined chunks */
+	Chunked
+};
+
+/// <summary>
+/// Uploads a build as a new app build and notifies the server once the file is ready
+/// Params: appId, notes, method, buildPath, zipPath, uncompressedSize. Output: appBuildId.
+/// Cancelling also cancels the build on the server; suspending keeps the resume journal.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCUploadJob : public FGLCJob
+{
+public:
+	FGLCUploadJob();
+	FGLCUploadJob(int64 AppId, const FString& Notes, EGLCUploadMethod Method, const FString& BuildPath, const FString& ZipPath, int64 UncompressedSize);
+
+	virtual FString GetDisplayName() const override;
+
+	/** Server build created by this upload, 0 until the upload started. Safe from any thread */
+	int64 GetAppBuildId() const { return AppBuildId; }
+
+	static const TCHAR* LexToString(EGLCUploadMethod Method);
+
+protected:
+	virtual void Start() override;
+	virtual void Cancel() override;
+	virtual void Suspend() override;
+
+private:
+	void StartUpload();
+	void UploadArchive();
+	void UploadMultipart(int64 FileSize, int64 PartSize);
+	void ResumeMultipart(TSharedPtr<FGLCUploadJournal> Journal, int64 FileSize, int64 PartSize);
+	void UploadStreamed();
+	void UploadChunked();
+
+	void SetAppBuildId(int64 InAppBuildId);
+	void Fail(const FString& Message);
+
+	/** Finishes the job as cancelled if cancellation was requested; true if it did */
+	bool FinishIfCancelled();
+
+	/** Reports upload progress and, once the upload completed, notifies the server */
+	TFunction<void(bool, FString, float)> MakeProgressHandler(int64 InAppBuildId, const FString& Key, int64 FileSize);
+
+	TSharedPtr<FGLCApiClient> ApiClient;
+	FGLCSettings Settings;
+	int64 AppId;
+	FString Notes;
+	EGLCUploadMethod Method;
+	FString BuildPath;
+	FString ZipPath;
+	int64 UncompressedSize;
+
+	TAtomic<int64> AppBuildId;
+};
+
+/// <summary>
+/// Follows the processing status of an uploaded build until it completes, fails or is cancelled
+/// Statuses come from the scheduler's FGLCBuildStatusMonitor, which polls every monitored build in one
+/// batched request or receives them from the status stream. Params: appBuildId.
+/// Output: appId, status. Cancelling cancels the build on the server.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCMonitorJob : public FGLCJob
+{
+public:
+	FGLCMonitorJob();
+	explicit FGLCMonitorJob(int64 AppBuildId);
+
+	virtual FString GetDisplayName() const override;
+
+	int64 GetAppBuildId() const;
+
+	static FString GetStatusIcon(const FString& Status);
+	static FString GetStatusDisplayName(const FString& Status);
+	static float GetStageBaseProgress(const FString& Status);
+	static float GetStageWeight(const FString& Status);
+
+protected:
+	virtual void Start() override;
+	virtual void Cancel() override;
+	virtual void Suspend() override;
+
+private:
+	void HandleStatus(const FGLCBuildStatusResponse& Response);
+	void StopPolling();
+
+	TSharedPtr<FGLCApiClient> ApiClient;
+	TSharedPtr<class FGLCBuildStatusMonitor, ESPMode::ThreadSafe> StatusMonitor;
+	FDelegateHandle StatusHandle;
+};
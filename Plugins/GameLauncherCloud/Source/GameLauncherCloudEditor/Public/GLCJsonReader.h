@@ -0,0 +1,85 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/// <summary>
+/// Object key as it appears in the payload, without unescaping
+/// </summary>
+struct FGLCJsonKey
+{
+	const uint8* Data = nullptr;
+	int32 Length = 0;
+
+	/** ASCII case-insensitive match, so camelCase and PascalCase keys are accepted alike */
+	bool Is(const ANSICHAR* Name) const;
+};
+
+/// <summary>
+/// Pull reader over a UTF-8 JSON payload
+/// Reads values straight into the caller's fields without building a DOM: keys are compared in
+/// place and only the strings that are read get converted. Unknown keys are skipped; null or a
+/// value of another type leaves the target untouched, like FJsonObject::TryGet*Field.
+/// Only malformed JSON, and numbers that do not fit the type they are read into, fail a read.
+/// The payload must outlive the reader.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCJsonReader
+{
+public:
+	explicit FGLCJsonReader(TConstArrayView<uint8> InPayload);
+
+	/**
+	 * Reads an object; ReadField runs for every key and reads the value it wants, the others are skipped
+	 * Returns false on malformed input or when ReadField returns false.
+	 */
+	bool ReadObject(TFunctionRef<bool(const FGLCJsonKey& Key)> ReadField);
+
+	/** Reads an array; ReadElement runs for every element and reads it, or leaves it to be skipped */
+	bool ReadArray(TFunctionRef<bool()> ReadElement);
+
+	bool Read(FString& OutValue);
+	bool Read(bool& OutValue);
+	bool Read(int32& OutValue);
+	bool Read(int64& OutValue);
+	bool Read(double& OutValue);
+
+	/** Skips the next value, whatever its type */
+	bool Skip();
+
+	/** Fails unless the next value is an object; consumes nothing */
+	bool RequireObject();
+
+	/** True if the next value is null; consumes it */
+	bool TryReadNull();
+
+	/** True if the next value is an object; consumes nothing */
+	bool IsNextObject();
+
+	/** True if the next value reads as a string, that is a string or a number; consumes nothing */
+	bool IsNextString();
+
+	/** True once the whole payload was read, allowing trailing whitespace */
+	bool IsAtEnd();
+
+	bool HasError() const { return !Error.IsEmpty(); }
+	const FString& GetError() const { return Error; }
+
+	/** Deepest nesting of objects and arrays accepted */
+	static constexpr int32 MaxDepth = 64;
+
+private:
+	uint8 Peek();
+	bool Expect(uint8 Char);
+	bool ReadStringSpan(const uint8*& OutStart, int32& OutLength, bool& bOutEscaped);
+	bool ReadNumberSpan(const uint8*& OutStart, int32& OutLength, bool& bOutInteger);
+	bool ReadNumberText(const uint8*& OutStart, int32& OutLength, bool& bOutFound);
+	bool ReadLiteral(const ANSICHAR* Literal);
+	bool Fail(const TCHAR* Message);
+
+	const uint8* Begin;
+	const uint8* Cursor;
+	const uint8* End;
+	int32 Depth;
+	FString Error;
+};
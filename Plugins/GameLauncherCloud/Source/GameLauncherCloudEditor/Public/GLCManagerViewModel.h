@@ -0,0 +1,87 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Templates/Atomic.h"
+#include "GLCApiClient.h"
+#include "GLCBuildScanner.h"
+
+/// <summary>
+/// State shown by the manager window, one immutable snapshot per change
+/// </summary>
+struct FGLCManagerState
+{
+	typedef TSharedRef<const TArray<FGLCAppInfo>, ESPMode::ThreadSafe> FAppsRef;
+
+	FGLCManagerState();
+
+	// ========== ACCOUNT ========== //
+	bool bIsAuthenticated;
+	bool bIsLoggingIn;
+	FString UserEmail;
+	FString UserPlan;
+
+	// ========== APPS ========== //
+	/** Shared between snapshots; replaced as a whole, so a new pointer means a new list. Pages only append to it */
+	FAppsRef Apps;
+
+	/** Cursor of the next page; empty once every page was loaded */
+	FString AppsNextCursor;
+
+	/** Loading the first page, or a further page */
+	bool bIsLoadingApps;
+	bool bIsLoadingMoreApps;
+
+	// ========== BUILD DETECTION ========== //
+	FGLCBuildSnapshot Build;
+	bool bIsScanningBuild;
+
+	// ========== STATUS ========== //
+	FString StatusMessage;
+	FString StatusMessageType; // "Info", "Warning", "Error", "Success"
+	float Progress;
+};
+
+/// <summary>
+/// Owns the manager window state and publishes it as immutable snapshots
+/// The game thread is the only writer: every change is a command applied to a copy of the current
+/// state, which then replaces it. Commands from other threads are queued and applied together by a
+/// single game thread task, so any number of jobs or requests can report concurrently. Slate attributes
+/// read the current snapshot, which stays valid for as long as they hold on to it.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCManagerViewModel : public TSharedFromThis<FGLCManagerViewModel, ESPMode::ThreadSafe>
+{
+public:
+	typedef TSharedRef<const FGLCManagerState, ESPMode::ThreadSafe> FStateRef;
+	typedef TFunction<void(FGLCManagerState&)> FCommand;
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnStateChanged, const FStateRef& /*State*/);
+
+	FGLCManagerViewModel();
+
+	/** Current snapshot. Game thread only */
+	const FStateRef& GetState() const { return State; }
+
+	/** Applies Command right away on the game thread, after any commands still queued; queues it from other threads */
+	void Update(FCommand Command);
+
+	/** Any thread */
+	void SetStatus(const FString& Message, const FString& MessageType);
+
+	/** Broadcast on the game thread once per published snapshot */
+	FOnStateChanged& OnStateChanged() { return StateChangedEvent; }
+
+private:
+	/** Applies the queued commands, then Command if given, and publishes the result. Game thread */
+	void Flush(FCommand* Command = nullptr);
+
+	FStateRef State;
+	FOnStateChanged StateChangedEvent;
+
+	TQueue<FCommand, EQueueMode::Mpsc> PendingCommands;
+
+	/** Set while a game thread task is on its way to flush the queue, so a burst of commands costs one task */
+	TAtomic<bool> bFlushScheduled;
+};
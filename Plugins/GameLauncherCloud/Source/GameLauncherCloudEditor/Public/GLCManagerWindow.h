@@ -6,27 +6,48 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Views/SListView.h"
 #include "Widgets/Notifications/SProgressBar.h"
 #include "GLCApiClient.h"
+#include "GLCBuildMatrix.h"
+#include "GLCBuildProfile.h"
+#include "GLCJobScheduler.h"
+#include "GLCManagerViewModel.h"
 
 /// <summary>
 /// Main editor window for Game Launcher Cloud
 /// Provides UI for authentication and build & upload
+/// Builds, uploads and monitoring run as jobs of the module's FGLCJobScheduler; the window submits
+/// them and shows the queue, so closing it does not stop them.
+/// Everything they report goes through FGLCManagerViewModel, whose snapshots the widgets read.
+/// Both tabs are built once and switched on login; each section sits in an invalidation panel.
+/// Apps load a page at a time into a virtualized list, searched locally as the user types.
 /// </summary>
 class GAMELAUNCHERCLOUDEDITOR_API SGLCManagerWindow : public SCompoundWidget
 {
 public:
-	SLATE_BEGIN_ARGS(SGLCManagerWindow) {}
+	SLATE_BEGIN_ARGS(SGLCManagerWindow)
+		: _LoadApps(true)
+		{}
+		/** Loads the apps and scans the build folder on opening when logged in */
+		SLATE_ARGUMENT(bool, LoadApps)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	
+	/**
+	 * Times logging in and out on a window drawn offscreen, rebuilding the tab and tips as the window
+	 * used to against switching between the tabs built once, and logs the time per change of both
+	 */
+	static void RunUpdateBenchmark(int32 Iterations);
 
 private:
 	// ========== UI CONSTRUCTION ========== //
 	TSharedRef<SWidget> ConstructLoginTab();
 	TSharedRef<SWidget> ConstructBuildUploadTab();
 	TSharedRef<SWidget> ConstructTipsTab();
+	TSharedRef<SWidget> ConstructMatrixOptions(const TArray<FString>& Options, TSet<FString>& Selection);
 	
 	// ========== LOGIN HANDLERS ========== //
 	FReply OnLoginWithApiKeyClicked();
@@ -37,73 +58,99 @@ private:
 	FReply OnBuildAndUploadClicked();
 	void OnAppSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo);
 	
+	// ========== APP LIST ========== //
+	/** Requests the page at Cursor, the first page if empty; a response to an older request is dropped */
+	void LoadAppsPage(const FString& Cursor);
+	
+	/** Requests the next page unless all were loaded or one is on its way */
+	void LoadMoreApps();
+	
+	void OnAppSearchChanged(const FText& SearchText);
+	bool MatchesAppFilter(const FString& Name) const;
+	TSharedRef<ITableRow> OnGenerateAppRow(TSharedPtr<FString> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	
 	// ========== HELPER FUNCTIONS ========== //
 	void SaveConfig();
 	void LoadConfig();
 	FString GetBuildDirectory() const;
 	void PackageProject(const FString& OutputDirectory);
-	int64 GetDirectorySize(const FString& DirectoryPath);
-	void StartBuildStatusMonitoring(int64 BuildId);
-	void StopBuildStatusMonitoring();
-	void CheckBuildStatus();
-	FString GetStatusIcon(const FString& Status);
-	FString GetStatusDisplayName(const FString& Status);
-	float GetStageBaseProgress(const FString& Status);
-	float GetStageWeight(const FString& Status);
 	
 	// Path helpers
 	FString GetBuildSourcePath() const;
 	FString GetZipPath() const;
 	
 	// ========== STATE ========== //
+	// Shared with the jobs, owned by the job scheduler
 	TSharedPtr<FGLCApiClient> ApiClient;
 	FString ApiUrl;
 	FString AuthToken;
-	FString UserEmail;
-	FString UserPlan;
 	FString CurrentEnvironment;
-	bool bIsAuthenticated;
+	
+	// Account, apps, build detection and status; only changed through its commands
+	TSharedPtr<FGLCManagerViewModel, ESPMode::ThreadSafe> ViewModel;
+	
+	/** Current snapshot of the view-model. Game thread only */
+	const FGLCManagerState& GetState() const { return *ViewModel->GetState(); }
+	
+	/** Updates the sections whose data differs from the last shown snapshot */
+	void OnStateChanged(const FGLCManagerViewModel::FStateRef& State);
+	
+	/** Snapshot the widgets were last updated from */
+	TSharedPtr<const FGLCManagerState, ESPMode::ThreadSafe> ShownState;
+	
+	// Texts bound to the widgets, only replaced when their data changes
+	FText StatusText;
+	FText WelcomeText;
 	
 	// ========== UI STATE ========== //
 	FString ApiKeyInput;
 	FString BuildNotesInput;
-	TArray<FGLCAppInfo> AvailableApps;
+	// One name per loaded app, in the order of the view-model's apps, and the ones matching the search
 	TArray<TSharedPtr<FString>> AppNames;
+	TArray<TSharedPtr<FString>> FilteredAppNames;
+	FString AppFilter;
+	FText AppFilterText;
+	int32 AppListRequest;
+	
 	TSharedPtr<FString> SelectedApp;
 	int32 SelectedAppIndex;
 	
-	bool bIsLoggingIn;
-	bool bIsLoadingApps;
-	bool bIsBuilding;
-	bool bIsUploading;
-	bool bIsMonitoringBuild;
+	// ========== BUILD PROFILE ========== //
+	// Profile of the selected app, loaded when the selection changes
+	FGLCBuildProfile BuildProfile;
+	int64 BuildProfileAppId;
+	TArray<TSharedPtr<FString>> BuildModeOptions;
+	TArray<TSharedPtr<FString>> BuildConfigurationOptions;
 	
-	FString StatusMessage;
-	FString StatusMessageType; // "Info", "Warning", "Error", "Success"
-	float UploadProgress;
+	// ========== BUILD MATRIX ========== //
+	TSet<FString> MatrixPlatforms;
+	TSet<FString> MatrixConfigurations;
+	// Jobs of the last matrix submitted from this window
+	TArray<FGLCBuildMatrixJobs> MatrixJobs;
+	bool bMatrixFinished;
 	
-	// ========== BUILD DETECTION ========== //
-	bool bHasBuildReady;
-	FDateTime LastBuildDate;
-	FString LastBuildPath;
-	int64 LastBuildSize;
-	int64 UncompressedBuildSize;
-	int32 TotalFileCount;
-	bool bIsCompressed;
-	
-	int64 CurrentBuildId;
-	FTimerHandle BuildStatusTimerHandle;
+	// Detects the build on a background task, using a cached listing kept current by a directory watcher
+	// Shared with chunked upload jobs, which reuse its cached file hashes
+	TSharedPtr<class FGLCBuildScanner, ESPMode::ThreadSafe> BuildScanner;
 	
 	// ========== UI WIDGETS ========== //
-	TSharedPtr<SVerticalBox> MainContentBox;
 	TSharedPtr<SEditableTextBox> ApiKeyTextBox;
 	TSharedPtr<SEditableTextBox> BuildNotesTextBox;
-	TSharedPtr<SComboBox<TSharedPtr<FString>>> AppComboBox;
+	TSharedPtr<SListView<TSharedPtr<FString>>> AppListView;
 	TSharedPtr<SProgressBar> UploadProgressBar;
-	TSharedPtr<STextBlock> StatusMessageText;
+	TSharedPtr<SVerticalBox> JobListBox;
+	
+	// Holds the tab switcher and the tips section
+	TSharedPtr<SVerticalBox> SectionsBox;
+	
+	// Jobs and states shown in the job list; the list is rebuilt when they change
+	TArray<TPair<int64, EGLCJobState>> ShownJobStates;
 	
 	// ========== UI REFRESH ========== //
-	void RefreshUI();
+	void RefreshAppNames(const TArray<FGLCAppInfo>& Apps);
+	
+	/** Replaces the sections with newly built ones, the way every login and logout used to; for RunUpdateBenchmark */
+	void RebuildSections();
 	
 	// ========== BUILD DETECTION ========== //
 	void CheckForExistingBuild();
@@ -115,12 +162,36 @@ private:
 	FReply OnManageAppClicked();
 	FReply OnCancelUploadClicked();
 	
-	// ========== BUILD METHODS ========== //
-	void BuildGame(bool bCompressOnly = false);
-	void CompressOnly(const FString& BuildPath);
-	void CompressAndUpload(const FString& BuildPath);
-	bool CompressBuild(const FString& SourcePath, const FString& ZipPath);
+	// ========== BUILD PROFILE ========== //
+	void SyncBuildProfile();
+	void OnBuildModeSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo);
+	void OnBuildConfigurationSelected(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo);
+	
+	// ========== BUILD MATRIX ========== //
+	FReply OnBuildMatrixClicked();
+	bool IsMatrixJob(int64 JobId) const;
+	void OnMatrixChanged();
+	void OnMatrixFinished();
+	FText GetMatrixStatusText() const;
+	bool IsMatrixRunning() const;
+	
+	// ========== JOBS ========== //
+	static FGLCJobScheduler& GetJobScheduler();
+	
+	/** Most recent job of a type that is pending or running */
+	FGLCJobPtr FindActiveJob(EGLCJobType Type) const;
+	
+	bool IsBuilding() const;
+	bool IsUploading() const;
+	bool IsMonitoringBuild() const;
+	
+	/** Server build of the running upload or monitor job, 0 if none */
+	int64 GetCurrentBuildId() const;
+	
+	void OnJobChanged(const FGLCJobPtr& Job);
+	void OnMonitorJobFinished(const FGLCJobPtr& Job);
+	void CancelJobWithConfirmation(const FGLCJobPtr& Job);
 	
-	// ========== UPLOAD METHODS ========== //
-	void UploadBuildToCloud(const FString& ZipPath);
+	TSharedRef<SWidget> ConstructJobList();
+	void RefreshJobList();
 };
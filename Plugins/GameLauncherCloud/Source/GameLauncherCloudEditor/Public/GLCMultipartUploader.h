@@ -0,0 +1,80 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCApiClient.h"
+#include "GLCFileHasher.h"
+#include "Templates/Atomic.h"
+
+struct FGLCUploadJournal;
+
+/// <summary>
+/// Drives a multipart upload of a file on disk
+/// Hashes the file on a worker thread first (whole-file XXH3/SHA-256 and a SHA-256 per part),
+/// then keeps up to MaxConcurrency parts in flight, collects the part ETags
+/// and completes the upload once every part has been acknowledged
+/// When a journal is supplied, parts already recorded in it are skipped and
+/// every newly acknowledged part is persisted so the upload can be resumed
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCMultipartUploader : public TSharedFromThis<FGLCMultipartUploader, ESPMode::ThreadSafe>
+{
+public:
+	FGLCMultipartUploader(FGLCApiClient* InApiClient, const FGLCStartMultipartUploadResponse& InUpload, const FString& InFilePath, int64 InFileSize, int32 InMaxConcurrency, TSharedPtr<FGLCUploadJournal> InJournal = nullptr);
+	
+	/** Starts uploading. ProgressCallback follows the FGLCApiClient::UploadFileAsync contract */
+	void Start(TFunction<void(bool, FString, float)> InProgressCallback);
+	
+	/** Cancels every in-flight part; the callback reports a cancellation */
+	void Cancel();
+	
+	bool IsFinished() const { return bFinished; }
+	
+	/** Byte range covered by a part */
+	static int64 GetPartOffset(int32 PartNumber, int64 PartSize) { return (int64)(PartNumber - 1) * PartSize; }
+	static int64 GetPartLength(int32 PartNumber, int64 PartSize, int64 FileSize);
+	
+	/** Smallest part the storage backend accepts, except for the last one */
+	static constexpr int64 MinPartSize = 5 * 1024 * 1024;
+	
+	/** Checks that parts of PartSize bytes are allowed for a file of FileSize bytes; fills OutError otherwise */
+	static bool ValidatePartSize(int64 PartSize, int64 FileSize, FString& OutError);
+	
+	/** Also checks that PartNumbers are exactly 1 to ceil(FileSize / PartSize), each once */
+	static bool ValidateParts(int64 PartSize, int64 FileSize, const TArray<int32>& PartNumbers, FString& OutError);
+
+private:
+	void OnFileHashed(bool bSuccess);
+	void LaunchPendingParts();
+	void OnPartBytesSent(int32 PartIndex, int64 BytesSent);
+	void OnPartFinished(int32 PartIndex, bool bSuccess, const FString& Error, const FString& ETag);
+	void CompleteUpload();
+	void Finish(bool bSuccess, const FString& Message, float Progress);
+	
+	FGLCApiClient* ApiClient;
+	FGLCStartMultipartUploadResponse Upload;
+	FString FilePath;
+	int64 FileSize;
+	int32 MaxConcurrency;
+	TFunction<void(bool, FString, float)> ProgressCallback;
+	TSharedPtr<FGLCUploadJournal> Journal;
+	
+	// Total number of parts in the file; Upload.Parts may only list the missing ones
+	int32 TotalPartCount;
+	
+	// Indices into Upload.Parts that have not been started yet, in upload order
+	TArray<int32> PendingParts;
+	TMap<int32, FGLCRetryingRequestPtr> InFlightRequests;
+	TArray<int64> PartBytesSent;
+	TArray<FGLCCompletedPart> CompletedParts;
+	int64 CompletedBytes;
+	
+	// Written by the hashing task, read on the game thread once it has finished
+	FGLCFileHash FileHash;
+	TArray<FString> PartChecksums;
+	TAtomic<bool> bCancelRequested;
+	
+	bool bCancelled;
+	bool bFailed;
+	bool bFinished;
+};
@@ -0,0 +1,94 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+
+/// <summary>
+/// Progress of one piece of work, written from any thread and sampled by the UI at its own rate
+/// Writers only store into atomics, so a transfer reporting thousands of times a second costs no
+/// allocation, lock or game thread task. The stage text is the exception: it takes a short lock, but
+/// only when it actually changes. The reader (one, on the game thread) samples the latest values and
+/// smooths throughput and progress rate with an exponential moving average, from which it estimates
+/// the time left. Fields written together may be sampled from two different writes; the next
+/// sample catches up.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCProgressChannel
+{
+public:
+	struct FSample
+	{
+		/** 0 to 1 */
+		float Progress = 0.0f;
+		FString Stage;
+
+		/** Negative when the work does not report bytes */
+		int64 BytesDone = -1;
+
+		/** 0 or less when the size is not known */
+		int64 BytesTotal = 0;
+
+		/** Smoothed; 0 until known */
+		double BytesPerSecond = 0.0;
+
+		/** Smoothed estimate; negative until the rate settled or while nothing moves */
+		double SecondsRemaining = -1.0;
+	};
+
+	FGLCProgressChannel();
+
+	/** Any thread, lock-free. For work that does not report bytes */
+	void Update(float Progress);
+
+	/** Any thread, lock-free. Progress is given separately as not every transfer knows its size */
+	void UpdateBytes(float Progress, int64 BytesDone, int64 BytesTotal);
+
+	/** Any thread; an unchanged stage costs a hash compare */
+	void SetStage(const FString& Stage);
+
+	/** Reader side: forgets the values and the smoothing, for work that starts over */
+	void Reset();
+
+	/**
+	 * Reader side, meant to be called at a fixed rate so the averages decay while nothing is reported
+	 * Returns true if anything was written since the last sample.
+	 */
+	bool Sample(double Now, FSample& OutSample);
+
+	/** "Stage (42% of 120.50 MB, 12.3 MB/s, 1m 05s left)", as much of it as the sample knows */
+	static FString FormatMessage(const FSample& Sample);
+
+	/** "1h 02m", "3m 05s" or "42s" */
+	static FString FormatDuration(double Seconds);
+
+	/** Time constant of the moving averages, in seconds */
+	static constexpr double SmoothingSeconds = 5.0;
+
+private:
+	// ========== Writer side ========== //
+
+	TAtomic<int32> ProgressPpm;
+	TAtomic<int64> BytesDone;
+	TAtomic<int64> BytesTotal;
+	TAtomic<uint32> StageHash;
+	TAtomic<uint32> Version;
+
+	FCriticalSection StageLock;
+	FString Stage;
+
+	// ========== Reader side ========== //
+
+	uint32 SampledVersion;
+	uint32 SampledStageHash;
+	FString SampledStage;
+	double LastSampleTime;
+	float LastProgress;
+	int64 LastBytesDone;
+	double SmoothedProgressRate;
+	double SmoothedBytesPerSecond;
+
+	/** Weight the averages have gathered, to correct their bias towards 0 while they warm up */
+	double SmoothingWeight;
+};
@@ -0,0 +1,95 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+
+/// <summary>
+/// When and how often a failed HTTP request is sent again
+/// Transient failures are retried: no response (connection, timeout), 408, 425, 429 and 5xx other than
+/// 501/505. The delay doubles from InitialDelay up to MaxDelay with jitter, so parts failing together
+/// do not come back together; a Retry-After header is honoured up to MaxRetryAfter.
+/// Requests must be safe to repeat: requests changing server state carry an Idempotency-Key instead.
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCRetryPolicy
+{
+	/** Attempts including the first one; 1 disables retries */
+	int32 MaxAttempts = 5;
+
+	/** Delay before the first retry, in seconds */
+	float InitialDelay = 1.0f;
+
+	/** Upper bound of the backoff delay, in seconds */
+	float MaxDelay = 30.0f;
+
+	/** Longest Retry-After waited for, in seconds; the request fails when the server asks for more */
+	float MaxRetryAfter = 120.0f;
+
+	/** True if the attempt that just finished should be retried */
+	bool ShouldRetry(int32 Attempt, FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded) const;
+
+	/** Seconds to wait before the attempt after Attempt, or a negative value when Retry-After is too long */
+	float GetRetryDelay(int32 Attempt, FHttpResponsePtr Response) const;
+
+	static bool IsTransientStatus(int32 ResponseCode);
+
+	/** Retry-After in seconds (delta-seconds or HTTP date), or a negative value when absent */
+	static float ParseRetryAfter(const FString& Value);
+
+	/** Single attempt */
+	static FGLCRetryPolicy NoRetry();
+};
+
+/// <summary>
+/// HTTP request sent again per a retry policy until it succeeds, fails permanently or is cancelled
+/// Each attempt is a fresh request built by the caller's factory (a stream body cannot be replayed);
+/// retries are scheduled on the core ticker. The completion runs once, with the last attempt.
+/// Game thread.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCRetryingRequest : public TSharedFromThis<FGLCRetryingRequest, ESPMode::ThreadSafe>
+{
+public:
+	typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FRequestRef;
+
+	/** Builds the request of an attempt, without a completion delegate; null fails the request */
+	typedef TFunction<FHttpRequestPtr(int32 /*Attempt*/)> FMakeRequest;
+
+	/** Sends an attempt; defaults to IHttpRequest::ProcessRequest */
+	typedef TFunction<void(const FRequestRef&)> FSendRequest;
+
+	/** Cancels an attempt sent by FSendRequest, which must then complete; defaults to IHttpRequest::CancelRequest */
+	typedef TFunction<void(const FRequestRef&)> FCancelRequest;
+
+	/** Starts the first attempt; returns null when the factory could not build it */
+	static TSharedPtr<FGLCRetryingRequest, ESPMode::ThreadSafe> Start(const FGLCRetryPolicy& Policy, FMakeRequest MakeRequest, FHttpRequestCompleteDelegate OnComplete, FSendRequest SendRequest = nullptr, FCancelRequest CancelRequest = nullptr);
+
+	/** Cancels the current attempt and any pending retry; the completion runs with a failed request */
+	void Cancel();
+
+	bool IsCancelled() const { return bCancelled; }
+	int32 GetAttempt() const { return Attempt; }
+	FHttpRequestPtr GetCurrentRequest() const { return CurrentRequest; }
+
+private:
+	FGLCRetryingRequest(const FGLCRetryPolicy& InPolicy, FMakeRequest InMakeRequest, FHttpRequestCompleteDelegate InOnComplete, FSendRequest InSendRequest, FCancelRequest InCancelRequest);
+
+	bool SendAttempt();
+	void OnAttemptComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+	void Complete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+
+	FGLCRetryPolicy Policy;
+	FMakeRequest MakeRequest;
+	FHttpRequestCompleteDelegate OnComplete;
+	FSendRequest SendRequest;
+	FCancelRequest CancelRequest;
+
+	FHttpRequestPtr CurrentRequest;
+	FTSTicker::FDelegateHandle RetryTickerHandle;
+	int32 Attempt;
+	bool bCancelled;
+	bool bCompleted;
+};
+
+typedef TSharedPtr<FGLCRetryingRequest, ESPMode::ThreadSafe> FGLCRetryingRequestPtr;
@@ -0,0 +1,96 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCCompressionPolicy.h"
+#include "GLCChunker.h"
+#include "GLCRetryPolicy.h"
+
+/// <summary>
+/// Tuning options read from glc_config.json
+/// Missing keys keep their defaults so older config files keep working
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCSettings
+{
+	// ========== ACCOUNT ========== //
+	
+	/** Backend the API client talks to */
+	FString ApiUrl = TEXT("https://api.gamelauncher.cloud");
+	
+	/** Token saved by the last login; empty when logged out */
+	FString AuthToken;
+	
+	/** Apps requested per page of the app list (1 to 500); further pages load as the list is scrolled */
+	int32 AppListPageSize = 100;
+	
+	// ========== UPLOAD ========== //
+	
+	/** Split large archives into parts and upload them concurrently; requires the multipart upload endpoints on the server */
+	bool bUseMultipartUpload = false;
+	
+	/** Maximum number of parts in flight at once */
+	int32 UploadConcurrency = 4;
+	
+	/** Requested part size; the server may override it */
+	int32 UploadPartSizeMB = 64;
+	
+	/** When no archive exists yet, compress and upload at the same time instead of writing the archive to disk first; uses multipart uploads */
+	bool bStreamCompressedUpload = false;
+	
+	/** Upload the build directory as content-defined chunks, sending only chunks the server does not have */
+	bool bChunkedUpload = false;
+	
+	/** Target chunk size for chunked uploads; chunks range from a quarter to four times this */
+	int32 ChunkAverageSizeKB = 1024;
+	
+	/** Send each part's SHA-256 as a checksum header; requires part URLs signed for it */
+	bool bSendPartChecksumHeader = false;
+	
+	// ========== RETRIES ========== //
+	
+	/** Attempts per API request or upload part, including the first one */
+	int32 RetryMaxAttempts = 5;
+	
+	/** Delay before the first retry; doubles with every further retry */
+	float RetryInitialDelaySeconds = 1.0f;
+	
+	/** Upper bound of the delay between two attempts */
+	float RetryMaxDelaySeconds = 30.0f;
+	
+	// ========== MONITORING ========== //
+	
+	/** Longest wait between two build status requests, reached when the status stops changing and used while the editor is in the background */
+	float StatusPollMaxIntervalSeconds = 60.0f;
+	
+	/** Receive build status changes over a WebSocket; polling only runs while it is disconnected */
+	bool bUseStatusStream = true;
+	
+	/** WebSocket URL of the status stream; empty derives it from ApiUrl */
+	FString StatusStreamUrl;
+	
+	// ========== BUILD ========== //
+	
+	/** Build jobs run at once, each for another platform; 0 picks a value from the machine's cores and memory */
+	int32 MaxConcurrentBuilds = 0;
+	
+	// ========== COMPRESSION ========== //
+	
+	/** Per-file compression rules used when building the archive */
+	FGLCCompressionPolicy Compression;
+	
+	/** Chunk size bounds derived from ChunkAverageSizeKB */
+	FGLCChunkingParams GetChunkingParams() const { return FGLCChunkingParams(ChunkAverageSizeKB * 1024); }
+	
+	/** Retry policy for API requests and upload parts */
+	FGLCRetryPolicy GetRetryPolicy() const;
+	
+	/** Status stream URL, StatusStreamUrl or the stream endpoint of ApiUrl */
+	FString GetStatusStreamUrl() const;
+	
+	/** Path of the plugin config file */
+	static FString GetConfigPath();
+	
+	/** Loads the settings from glc_config.json, falling back to defaults */
+	static FGLCSettings Load();
+};
@@ -0,0 +1,39 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/// <summary>
+/// Incremental SHA-256 (FIPS 180-4)
+/// The engine only ships SHA-1 and MD5 in Core, while storage backends verify uploads with SHA-256.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCSha256
+{
+public:
+	struct FDigest
+	{
+		uint8 Bytes[32];
+
+		FString ToHex() const;
+
+		/** Base64 form used by the x-amz-checksum-sha256 header */
+		FString ToBase64() const;
+	};
+
+	FGLCSha256();
+
+	void Reset();
+	void Update(const uint8* Data, int64 Num);
+	FDigest Finalize();
+
+	static FDigest HashBuffer(const uint8* Data, int64 Num);
+
+private:
+	void ProcessBlock(const uint8* Block);
+
+	uint32 State[8];
+	uint8 Buffer[64];
+	int32 BufferLength;
+	uint64 TotalLength;
+};
@@ -0,0 +1,98 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCApiClient.h"
+#include "GLCCompressionPolicy.h"
+#include "GLCFileHasher.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+
+class FEvent;
+
+/// <summary>
+/// Compresses a build directory and uploads the archive as a multipart upload at the same time
+/// The ZIP writer runs on a background thread and fills parts of Upload.PartSize bytes; finished
+/// parts go through a bounded in-memory ring to the game thread, which requests a presigned URL
+/// and uploads them with up to MaxConcurrency requests in flight. When the ring is full the
+/// compressor waits, so memory stays at roughly (MaxConcurrency + 2) parts and the archive is
+/// never written to disk. Total time approaches max(compress, upload).
+/// Each part's SHA-256 and the whole archive's XXH3/SHA-256 are computed as the data is produced.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCStreamingUploader : public TSharedFromThis<FGLCStreamingUploader, ESPMode::ThreadSafe>
+{
+public:
+	FGLCStreamingUploader(FGLCApiClient* InApiClient, const FGLCStartMultipartUploadResponse& InUpload, int32 InMaxConcurrency);
+	~FGLCStreamingUploader();
+
+	/** Starts compressing and uploading. ProgressCallback follows the FGLCApiClient::UploadFileAsync contract */
+	void Start(const FString& SourceDirectory, const FGLCCompressionPolicy& Policy, TFunction<void(bool, FString, float)> InProgressCallback);
+
+	/** Stops the compressor and cancels every in-flight part; the callback reports a cancellation */
+	void Cancel();
+
+	bool IsFinished() const { return bFinished; }
+
+private:
+	class FPartSink;
+
+	struct FReadyPart
+	{
+		int32 PartNumber = 0;
+		TArray<uint8> Data;
+		FString ChecksumSha256;
+	};
+
+	// ========== COMPRESSION THREAD ========== //
+	void RunCompression(const FString& SourceDirectory, const FGLCCompressionPolicy& Policy);
+	bool WriteCompressed(const uint8* Data, int64 Num);
+	bool PushCurrentPart();
+
+	// ========== GAME THREAD ========== //
+	void LaunchReadyParts();
+	void UploadPart(int32 PartNumber, TArray<uint8>&& Data, const FString& ChecksumSha256, const FString& Url);
+	void OnPartBytesSent(int32 PartNumber, int64 BytesSent);
+	void OnPartFinished(int32 PartNumber, int64 PartLength, const FString& ChecksumSha256, bool bSuccess, const FString& Error, const FString& ETag);
+	void OnCompressionFinished(bool bSuccess, const FString& Error);
+	void ReleaseSlot();
+	void ReportProgress();
+	void CompleteUpload();
+	void Fail(const FString& Message);
+	void Stop();
+	void Finish(bool bSuccess, const FString& Message, float Progress);
+
+	FGLCApiClient* ApiClient;
+	FGLCStartMultipartUploadResponse Upload;
+	int32 MaxConcurrency;
+	int32 RingCapacity;
+	TFunction<void(bool, FString, float)> ProgressCallback;
+
+	// Shared between the compression thread and the game thread
+	FCriticalSection Mutex;
+	TArray<FReadyPart> ReadyParts;
+	int32 PartsInRing;
+	FEvent* SlotFreedEvent;
+	TAtomic<bool> bCancelRequested;
+	TAtomic<int64> UncompressedProcessed;
+	TAtomic<int64> UncompressedTotal;
+	TAtomic<int64> ProducedBytes;
+	TAtomic<int32> ProducedPartCount;
+
+	// Compression thread only
+	TArray<uint8> CurrentPart;
+	int32 NextPartNumber;
+	FGLCFileHasher ArchiveHasher;
+
+	// Written by the compression thread, read on the game thread once compression has finished
+	FGLCFileHash ArchiveHash;
+
+	// Game thread only
+	int32 PartsAwaitingUrl;
+	TMap<int32, FGLCRetryingRequestPtr> InFlightRequests;
+	TMap<int32, int64> PartBytesSent;
+	TArray<FGLCCompletedPart> CompletedParts;
+	int64 UploadedBytes;
+	bool bCompressionFinished;
+	bool bFinished;
+};
@@ -0,0 +1,107 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+class FArchive;
+
+/// <summary>
+/// Phases of a BuildCookRun invocation, in the order UAT runs them
+/// </summary>
+enum class EGLCUatStage : uint8
+{
+	Starting,
+	Build,
+	Cook,
+	Stage,
+	Package,
+	Archive,
+	Finished
+};
+
+/// <summary>
+/// Log file that starts over in a new file once it reaches MaxFileSize
+/// Older files are kept as Name.1.log, Name.2.log... up to MaxBackups
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCRotatingLog
+{
+public:
+	FGLCRotatingLog(const FString& InFilePath, int64 InMaxFileSize, int32 InMaxBackups);
+	~FGLCRotatingLog();
+
+	/** Rotates existing files and opens a fresh log */
+	bool Open();
+
+	/** Appends one line of UTF-8 text; the newline is added */
+	void WriteLine(const uint8* Utf8Data, int32 Num);
+
+	void Close();
+
+	const FString& GetFilePath() const { return FilePath; }
+
+private:
+	void Rotate();
+	FString GetBackupPath(int32 Index) const;
+
+	FString FilePath;
+	int64 MaxFileSize;
+	int32 MaxBackups;
+	TUniquePtr<FArchive> Writer;
+};
+
+/// <summary>
+/// Runs RunUAT with its output read through a pipe while the process is running
+/// Every line goes to a rotating log file and is scanned for the UAT stage banners
+/// ("********** COOK COMMAND STARTED **********") and cook progress, so callers can show the
+/// live stage. Memory stays constant: only the current line and the last few errors are kept.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCUatRunner
+{
+public:
+	/** Called from the running thread when the stage or its progress changes; Progress covers the whole run (0..1) */
+	typedef TFunction<void(EGLCUatStage Stage, float Progress)> FProgressCallback;
+
+	FGLCUatRunner(const FString& InUatPath, const FString& InArguments, const FString& InLogPath);
+
+	/**
+	 * Launches UAT and blocks until it exits. Call from a background thread
+	 * Returns the process exit code, or -1 if it could not be started or was cancelled
+	 */
+	int32 Run(FProgressCallback OnProgress, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Error lines seen during the last run, most recent last */
+	const TArray<FString>& GetErrorLines() const { return ErrorLines; }
+
+	const FString& GetLogPath() const { return LogPath; }
+
+	static FString GetStageDisplayName(EGLCUatStage Stage);
+
+	/** Default UAT log location inside the project's Saved/Logs directory */
+	static FString GetDefaultLogPath();
+
+	/** Number of error lines kept for the failure report */
+	static constexpr int32 MaxErrorLines = 20;
+
+	/** Longer lines are split so a runaway line cannot grow the buffer */
+	static constexpr int32 MaxLineLength = 64 * 1024;
+
+private:
+	void ProcessOutput(const TArray<uint8>& Chunk);
+	void ProcessLine(const uint8* Utf8Data, int32 Num);
+	void ReportProgress();
+
+	FString UatPath;
+	FString Arguments;
+	FString LogPath;
+
+	FProgressCallback ProgressCallback;
+	TUniquePtr<FGLCRotatingLog> Log;
+	TArray<uint8> PendingLine;
+	TArray<FString> ErrorLines;
+
+	EGLCUatStage Stage;
+	float StageProgress;
+	int32 LastReportedPercent;
+};
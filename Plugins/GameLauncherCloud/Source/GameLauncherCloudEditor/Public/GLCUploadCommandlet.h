@@ -0,0 +1,58 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GLCJobScheduler.h"
+#include "GLCUploadCommandlet.generated.h"
+
+/** Process exit codes of the GLCUpload commandlet */
+enum class EGLCUploadExitCode : int32
+{
+	Success = 0,
+	InvalidArguments = 1,
+	AuthenticationFailed = 2,
+	BuildFailed = 3,
+	CompressionFailed = 4,
+	UploadFailed = 5,
+	ProcessingFailed = 6,
+	Cancelled = 7
+};
+
+/// <summary>
+/// Builds, compresses and uploads the project without the manager window, for CI pipelines
+/// Runs the same jobs as the window on an in-memory job scheduler and pumps the ticker, HTTP and
+/// game thread tasks itself. Progress is printed as one JSON object per line, prefixed with GLC_EVENT.
+/// Usage: UnrealEditor-Cmd.exe Project.uproject -run=GLCUpload -AppId=123 [-Notes="..."] [-Platform=Win64]
+///        [-Configuration=Shipping] [-FastIteration] [-BuildDir=Path | -Zip=Path] [-Method=archive|streamed|chunked]
+///        [-ApiUrl=Url] [-Token=Token | -ApiKey=Key] [-Wait]
+/// </summary>
+UCLASS()
+class GAMELAUNCHERCLOUDEDITOR_API UGLCUploadCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGLCUploadCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Signs in with an API key, pumping until the server answered */
+	bool Login(const TSharedPtr<FGLCApiClient>& ApiClient, const FString& ApiKey);
+
+	/** Ticks the core ticker, HTTP requests and game thread tasks until Done returns true */
+	void PumpUntil(TFunctionRef<bool()> Done, FGLCJobScheduler* Scheduler = nullptr);
+
+	void OnJobChanged(const FGLCJobPtr& Job);
+
+	/** Prints a GLC_EVENT line */
+	static void PrintEvent(const FString& Event, const TSharedRef<FJsonObject>& Fields);
+
+	static void PrintUsage();
+
+	/** Last printed state and percentage per job, so events are printed only when they change */
+	TMap<int64, EGLCJobState> PrintedStates;
+	TMap<int64, int32> PrintedProgress;
+};
@@ -0,0 +1,59 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GLCApiClient.h"
+
+/// <summary>
+/// On-disk record of an in-progress multipart upload
+/// Saved after every acknowledged part so an interrupted upload (network drop,
+/// editor crash or restart) can resume by sending only the missing parts. One journal per app and
+/// archive, so uploads waiting in the queue keep theirs while another one runs or is cancelled.
+/// </summary>
+struct GAMELAUNCHERCLOUDEDITOR_API FGLCUploadJournal
+{
+	int64 AppId = 0;
+	int64 AppBuildId = 0;
+	FString Key;
+	FString UploadId;
+	
+	// Identity of the archive being uploaded; any change invalidates the journal
+	FString FilePath;
+	int64 FileSize = 0;
+	FString FileTimestamp;
+	
+	int64 PartSize = 0;
+	int32 PartCount = 0;
+	TArray<FGLCCompletedPart> CompletedParts;
+	
+	/** Set once CompleteMultipartUpload succeeded; only the file-ready notification is left */
+	bool bUploadCompleted = false;
+	
+	/** Location of the journal of an app and archive inside the project's Intermediate directory */
+	static FString GetJournalPath(int64 InAppId, const FString& InFilePath);
+	
+	/** Loads the journal of an app and archive, returns false if there is none or it is unreadable */
+	static bool Load(int64 InAppId, const FString& InFilePath, FGLCUploadJournal& OutJournal);
+	
+	/** Removes the journal of an app and archive from disk */
+	static void Delete(int64 InAppId, const FString& InFilePath);
+	
+	/** Removes the journal of a server build from disk, whichever archive it was for */
+	static void DeleteForBuild(int64 InAppBuildId);
+	
+	/** Writes the journal atomically (temp file + rename) */
+	bool Save() const;
+	
+	/** True if the journal was written for this app and this exact archive */
+	bool Matches(int64 InAppId, const FString& InFilePath) const;
+	
+	/** Records an acknowledged part (replacing any previous ETag) and saves */
+	void AddCompletedPart(const FGLCCompletedPart& Part);
+	
+	/** Part numbers (1-based) that still have to be uploaded */
+	TArray<int32> GetMissingPartNumbers() const;
+	
+	/** Current timestamp of a file in the format stored in FileTimestamp */
+	static FString GetFileTimestamp(const FString& InFilePath);
+};
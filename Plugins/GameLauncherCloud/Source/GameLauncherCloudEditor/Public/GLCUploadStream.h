@@ -0,0 +1,82 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+class IFileHandle;
+
+/// <summary>
+/// Read-only archive over a byte range of a file on disk
+/// Used as the HTTP request body so uploads stream from disk through a fixed-size buffer
+/// instead of loading the whole archive into memory
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCFileRangeReader : public FArchive
+{
+public:
+	/** Size of the read buffer used when the caller does not provide one */
+	static constexpr int32 DefaultBufferSize = 4 * 1024 * 1024;
+
+	/**
+	 * Opens a file for streaming
+	 * @param FilePath    File to read
+	 * @param Offset      First byte of the range
+	 * @param Length      Number of bytes in the range, or -1 for "until end of file"
+	 * @param BufferSize  Size of the read buffer
+	 * @return The reader, or nullptr if the file could not be opened or the range is invalid
+	 */
+	static TSharedPtr<FGLCFileRangeReader, ESPMode::ThreadSafe> Open(const FString& FilePath, int64 Offset = 0, int64 Length = -1, int32 BufferSize = DefaultBufferSize);
+
+	virtual ~FGLCFileRangeReader() override;
+
+	// FArchive interface
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Seek(int64 InPos) override;
+	virtual int64 Tell() override;
+	virtual int64 TotalSize() override;
+	virtual bool Close() override;
+	virtual FString GetArchiveName() const override;
+
+private:
+	FGLCFileRangeReader(IFileHandle* InHandle, const FString& InFilePath, int64 InRangeStart, int64 InRangeLength, int32 InBufferSize);
+
+	/** Refills the buffer starting at the current position */
+	bool FillBuffer();
+
+	TUniquePtr<IFileHandle> Handle;
+	FString FilePath;
+
+	// Range inside the file exposed by this archive
+	int64 RangeStart;
+	int64 RangeLength;
+
+	// Current position, relative to RangeStart
+	int64 Position;
+
+	// Buffered window of the range, relative to RangeStart
+	TArray<uint8> Buffer;
+	int64 BufferStart;
+	int64 BufferCount;
+};
+
+/// <summary>
+/// Read-only archive over an in-memory buffer shared with its owner
+/// Lets every attempt of a retried request stream the same bytes instead of copying them
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCSharedBufferReader : public FArchive
+{
+public:
+	explicit FGLCSharedBufferReader(TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> InData);
+
+	// FArchive interface
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Seek(int64 InPos) override;
+	virtual int64 Tell() override;
+	virtual int64 TotalSize() override;
+	virtual FString GetArchiveName() const override;
+
+private:
+	TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> Buffer;
+	int64 Position;
+};
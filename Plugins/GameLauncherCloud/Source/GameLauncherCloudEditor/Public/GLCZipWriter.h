@@ -0,0 +1,119 @@
+// Copyright Game Launcher Cloud. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+#include "GLCCompressionPolicy.h"
+
+/// <summary>
+/// Destination for the bytes produced by FGLCZipWriter
+/// The writer only ever appends, so a sink can be a file or a network stream
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCZipSink
+{
+public:
+	virtual ~FGLCZipSink() {}
+
+	/** Appends bytes to the archive, returns false on failure */
+	virtual bool Write(const uint8* Data, int64 Num) = 0;
+};
+
+/// <summary>
+/// Sink writing the archive to a file on disk
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCZipFileSink : public FGLCZipSink
+{
+public:
+	explicit FGLCZipFileSink(const FString& InFilePath);
+	virtual ~FGLCZipFileSink() override;
+
+	bool IsValid() const { return Writer.IsValid(); }
+	virtual bool Write(const uint8* Data, int64 Num) override;
+	bool Close();
+
+private:
+	TUniquePtr<FArchive> Writer;
+	FString FilePath;
+};
+
+/// <summary>
+/// Native ZIP64 writer
+/// Files are split into fixed-size chunks that are read and deflated on all cores,
+/// then appended in order. Every chunk is compressed independently and entries use a
+/// fixed timestamp and sorted paths, so identical inputs always produce byte-identical
+/// archives regardless of the number of worker threads.
+/// The compression policy picks Store, fast or high deflate per file; the choice is recorded
+/// in each entry's method and general purpose flags.
+/// </summary>
+class GAMELAUNCHERCLOUDEDITOR_API FGLCZipWriter
+{
+public:
+	/** Progress callback: uncompressed bytes processed so far and total uncompressed bytes */
+	typedef TFunction<void(int64, int64)> FProgressCallback;
+
+	/** Size of the independently compressed chunks */
+	static constexpr int64 ChunkSize = 1024 * 1024;
+
+	explicit FGLCZipWriter(const FGLCCompressionPolicy& InPolicy = FGLCCompressionPolicy());
+
+	/**
+	 * Writes every file below SourceDirectory into the sink, with paths relative to SourceDirectory
+	 * ProgressCallback is invoked from the calling thread
+	 * Setting *bCancelRequested aborts the operation
+	 */
+	bool WriteDirectory(const FString& SourceDirectory, FGLCZipSink& Sink, FProgressCallback ProgressCallback = nullptr, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Convenience wrapper writing to a temp file that is renamed to ZipPath on success */
+	bool WriteDirectoryToFile(const FString& SourceDirectory, const FString& ZipPath, FProgressCallback ProgressCallback = nullptr, const TAtomic<bool>* bCancelRequested = nullptr);
+
+	/** Error message of the last failed operation */
+	const FString& GetLastError() const { return LastError; }
+
+	/** Total size of the files in the last written directory */
+	int64 GetUncompressedSize() const { return UncompressedSize; }
+
+private:
+	struct FEntry
+	{
+		FString AbsolutePath;
+		TArray<uint8> Name;
+		int64 UncompressedSize = 0;
+		int64 CompressedSize = 0;
+		int64 LocalHeaderOffset = 0;
+		uint32 Crc = 0;
+		uint16 Method = 0;
+		uint16 Flags = 0;
+		int32 Level = 0;
+		bool bZip64Local = false;
+	};
+
+	struct FChunk
+	{
+		int32 EntryIndex = 0;
+		int64 Offset = 0;
+		int64 Length = 0;
+		bool bFirst = false;
+		bool bLast = false;
+
+		// Filled by the workers
+		TArray<uint8> Output;
+		uint32 Crc = 0;
+		bool bFailed = false;
+	};
+
+	bool ProcessChunk(FChunk& Chunk) const;
+	bool Emit(const TArray<uint8>& Bytes);
+	bool Emit(const uint8* Data, int64 Num);
+	bool WriteLocalHeader(FEntry& Entry);
+	bool WriteDataDescriptor(const FEntry& Entry);
+	bool WriteCentralDirectory();
+	bool Fail(const FString& Error);
+
+	FGLCCompressionPolicy Policy;
+	TArray<FEntry> Entries;
+	FGLCZipSink* Sink;
+	int64 BytesWritten;
+	int64 UncompressedSize;
+	FString LastError;
+};
@@ -7,6 +7,7 @@
 
 class FToolBarBuilder;
 class FMenuBuilder;
+class FGLCJobScheduler;
 
 /// <summary>
 /// Editor module for Game Launcher Cloud plugin
@@ -21,10 +22,16 @@ public:
 	
 	/** Opens the Game Launcher Cloud Manager window */
 	void OpenManagerWindow();
+	
+	/** Build, upload and monitoring jobs; they keep running while the manager window is closed */
+	FGLCJobScheduler& GetJobScheduler() { return *JobScheduler; }
+	
+	static FGameLauncherCloudEditorModule& Get();
 
 private:
 	void RegisterMenus();
 
 	TSharedPtr<class FUICommandList> PluginCommands;
 	TSharedPtr<class FSlateStyleSet> StyleSet;
+	TUniquePtr<FGLCJobScheduler> JobScheduler;
 };
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+# Copyright Game Launcher Cloud. All Rights Reserved.
+"""
+Local stand-in for the Game Launcher Cloud build status stream.
+
+Accepts WebSocket connections on /api/cli/build/status-stream and answers
+{"type":"subscribe","appBuildIds":[...]} by pushing a simulated run through
+the processing stages of every subscribed build, ending in Completed.
+
+    python Tools/glc_status_stream_server.py [--port 8765] [--step 0.5]
+
+Then set "statusStreamUrl": "ws://localhost:8765/api/cli/build/status-stream"
+in glc_config.json. Python 3.8+, standard library only.
+"""
+
+import argparse
+import asyncio
+import base64
+import hashlib
+import json
+import struct
+
+WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+STREAM_PATH = "/api/cli/build/status-stream"
+
+# Stages with progress steps the server reports; the rest are reported once
+STAGES = [
+    ("Enqueued", False),
+    ("DownloadingBuild", True),
+    ("UnzippingBuild", True),
+    ("CreatingPatch", True),
+    ("DeployingPatch", True),
+    ("Completed", False),
+]
+
+
+async def read_frame(reader):
+    """Returns (opcode, payload) of the next client frame; client frames are always masked"""
+    header = await reader.readexactly(2)
+    opcode = header[0] & 0x0F
+    length = header[1] & 0x7F
+    if length == 126:
+        length = struct.unpack(">H", await reader.readexactly(2))[0]
+    elif length == 127:
+        length = struct.unpack(">Q", await reader.readexactly(8))[0]
+    mask = await reader.readexactly(4) if header[1] & 0x80 else b"\0\0\0\0"
+    payload = await reader.readexactly(length)
+    return opcode, bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+
+
+def make_frame(opcode, payload):
+    header = bytes([0x80 | opcode])
+    if len(payload) < 126:
+        header += bytes([len(payload)])
+    elif len(payload) < 65536:
+        header += bytes([126]) + struct.pack(">H", len(payload))
+    else:
+        header += bytes([127]) + struct.pack(">Q", len(payload))
+    return header + payload
+
+
+class Connection:
+    def __init__(self, writer, step):
+        self.writer = writer
+        self.step = step
+        self.builds = {}
+
+    def send_status(self, app_build_id, status, progress):
+        message = {
+            "appBuildId": app_build_id,
+            "appId": 1,
+            "status": status,
+            "stageProgress": progress,
+            "fileName": "Build.zip",
+        }
+        print(f"  -> #{app_build_id} {status} {progress}%")
+        self.writer.write(make_frame(0x1, json.dumps(message).encode("utf-8")))
+
+    async def simulate(self, app_build_id):
+        for status, has_progress in STAGES:
+            for progress in (range(0, 101, 20) if has_progress else [0]):
+                self.send_status(app_build_id, status, progress)
+                await self.writer.drain()
+                await asyncio.sleep(self.step)
+
+    def on_message(self, text):
+        message = json.loads(text)
+        for app_build_id in message.get("appBuildIds", []):
+            if message.get("type") == "subscribe" and app_build_id not in self.builds:
+                print(f"Subscribed to build #{app_build_id}")
+                self.builds[app_build_id] = asyncio.ensure_future(self.simulate(app_build_id))
+            elif message.get("type") == "unsubscribe" and app_build_id in self.builds:
+                print(f"Unsubscribed from build #{app_build_id}")
+                self.builds.pop(app_build_id).cancel()
+
+    def close(self):
+        for task in self.builds.values():
+            task.cancel()
+
+
+async def handle_client(reader, writer, step):
+    request = (await reader.readuntil(b"\r\n\r\n")).decode("latin-1").split("\r\n")
+    path = request[0].split(" ")[1] if len(request[0].split(" ")) > 1 else ""
+    headers = {}
+    for line in request[1:]:
+        if ":" in line:
+            name, value = line.split(":", 1)
+            headers[name.strip().lower()] = value.strip()
+
+    if path.split("?")[0] != STREAM_PATH or "sec-websocket-key" not in headers:
+        writer.write(b"HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n")
+        await writer.drain()
+        writer.close()
+        return
+
+    accept = base64.b64encode(hashlib.sha1((headers["sec-websocket-key"] + WEBSOCKET_GUID).encode()).digest()).decode()
+    writer.write(("HTTP/1.1 101 Switching Protocols\r\n"
+                  "Upgrade: websocket\r\n"
+                  "Connection: Upgrade\r\n"
+                  f"Sec-WebSocket-Accept: {accept}\r\n\r\n").encode())
+    await writer.drain()
+    print(f"Client connected ({'authorized' if 'authorization' in headers else 'no token'})")
+
+    connection = Connection(writer, step)
+    try:
+        while True:
+            opcode, payload = await read_frame(reader)
+            if opcode == 0x1:
+                connection.on_message(payload.decode("utf-8"))
+            elif opcode == 0x9:
+                writer.write(make_frame(0xA, payload))
+            elif opcode == 0x8:
+                writer.write(make_frame(0x8, payload[:2]))
+                break
+    except (asyncio.IncompleteReadError, ConnectionError):
+        pass
+    finally:
+        connection.close()
+        writer.close()
+        print("Client disconnected")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local stand-in for the build status stream")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--step", type=float, default=0.5, help="seconds between two pushed statuses")
+    args = parser.parse_args()
+
+    async def serve():
+        server = await asyncio.start_server(lambda r, w: handle_client(r, w, args.step), "127.0.0.1", args.port)
+        print(f"Build status stream on ws://localhost:{args.port}{STREAM_PATH}")
+        async with server:
+            await server.serve_forever()
+
+    try:
+        asyncio.run(serve())
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()